@@ -0,0 +1,16 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+
+// monotonic host clock in nanoseconds
+uint64_t bench_now(void);
+
+// each bench prints its own table to stdout
+void bench_walls(void);
+void bench_shade(void);
+void bench_textures(void);
+void bench_dda(void);
+void bench_sprites(void);
+
+#endif
@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "bench.h"
+#include "map.h"
+#include "raycast.h"
+#include "screen.h"
+#include "assets/wall_texture.h"
+
+#define DDA_BENCH_MAPS 300
+#define DDA_BENCH_POSES 50
+#define DDA_BENCH_WORST 8
+
+typedef struct {
+    int lineHeight, texX;
+} Column;
+
+// the float loop render() used before raycast.c, walls only
+static Column float_column(float posX, float posY, float dirX, float dirY, float planeX, float planeY, int x) {
+    float cameraX = 2 * x / (float)SCREEN_WIDTH - 1;
+    float rayDirX = dirX + planeX * cameraX;
+    float rayDirY = dirY + planeY * cameraX;
+    int mapX = (int)posX, mapY = (int)posY;
+    float sideDistX, sideDistY;
+    float deltaDistX = (rayDirX == 0) ? 1e30f : fabsf(1 / rayDirX);
+    float deltaDistY = (rayDirY == 0) ? 1e30f : fabsf(1 / rayDirY);
+    int stepX, stepY, hit = 0, side = 0;
+
+    if (rayDirX < 0) { stepX = -1; sideDistX = (posX - mapX) * deltaDistX; }
+    else { stepX = 1; sideDistX = (mapX + 1.0f - posX) * deltaDistX; }
+    if (rayDirY < 0) { stepY = -1; sideDistY = (posY - mapY) * deltaDistY; }
+    else { stepY = 1; sideDistY = (mapY + 1.0f - posY) * deltaDistY; }
+
+    int iter = 0;
+    while (hit == 0 && iter < 64) {
+        if (sideDistX < sideDistY) { sideDistX += deltaDistX; mapX += stepX; side = 0; }
+        else { sideDistY += deltaDistY; mapY += stepY; side = 1; }
+        if (map_opaque(mapX, mapY)) hit = 1;
+        iter++;
+    }
+
+    float perpWallDist = (side == 0) ? (sideDistX - deltaDistX) : (sideDistY - deltaDistY);
+    if (perpWallDist < 0.1f) perpWallDist = 0.1f;
+    float wallX = (side == 0) ? (posY + perpWallDist * rayDirY) : (posX + perpWallDist * rayDirX);
+    wallX -= (float)((int)wallX);
+    int texX = (int)(wallX * (float)TEX_WIDTH);
+    if ((side == 0 && rayDirX > 0) || (side == 1 && rayDirY < 0)) texX = TEX_WIDTH - texX - 1;
+    return (Column){ (int)(SCREEN_HEIGHT / perpWallDist), texX };
+}
+
+// the same column through raycast.c, scaled like wall_draw_column() does
+static Column fixed_column(fix_t posX, fix_t posY, int x) {
+    RayHit hit;
+    raycast_column(posX, posY, x, &hit);
+    return (Column){ (SCREEN_HEIGHT << FIX_SHIFT) / hit.perpDist, (hit.texU * TEX_WIDTH) >> FIX_SHIFT };
+}
+
+static float to_float(fix_t f) {
+    return f / (float)FIX_ONE;
+}
+
+// doors are thin panels in raycast.c and didn't exist for the float loop
+static void remove_doors(void) {
+    for (int i = 0; i < doorCount; i++) map_set(doors[i].x, doors[i].y, TILE_EMPTY);
+    doorCount = 0;
+    buildDistanceField();
+}
+
+static int bucket(int diff) {
+    return diff == 0 ? 0 : diff == 1 ? 1 : diff == 2 ? 2 : diff <= 8 ? 3 : 4;
+}
+
+// column heights and texture columns of the fixed point raycaster against the
+// old float loop over random poses, plus host time for a frame of each. the
+// host has an fpu, so the timings say nothing about the soft float sh4 build
+void bench_dda(void) {
+    static const char *bucketNames[] = { "0", "1", "2", "3-8", ">8" };
+    long heights[5] = { 0 }, visible[5] = { 0 }, rounded[5] = { 0 }, texels[5] = { 0 }, columns = 0;
+    int worst = 0;
+    uint64_t floatTime = 0, fixedTime = 0;
+    volatile int sink = 0;
+
+    srand(1);
+    for (int m = 0; m < DDA_BENCH_MAPS; m++) {
+        generateMap();
+        remove_doors();
+        for (int p = 0; p < DDA_BENCH_POSES; p++) {
+            float posX, posY;
+            do {
+                posX = 1 + (MAP_WIDTH - 2) * (rand() / (float)RAND_MAX);
+                posY = 1 + (MAP_HEIGHT - 2) * (rand() / (float)RAND_MAX);
+            } while (map_opaque((int)posX, (int)posY));
+            float angle = (rand() % 3600) * (6.2831853f / 3600);
+            float dirX = cosf(angle), dirY = sinf(angle);
+            float planeX = -dirY * 0.66f, planeY = dirX * 0.66f;
+            raycast_set_view(dirX, dirY, planeX, planeY);
+            fix_t fixX = fix_from_float(posX), fixY = fix_from_float(posY);
+
+            static Column floats[SCREEN_WIDTH], fixeds[SCREEN_WIDTH], roundeds[SCREEN_WIDTH];
+            uint64_t t0 = bench_now();
+            for (int x = 0; x < SCREEN_WIDTH; x++) floats[x] = float_column(posX, posY, dirX, dirY, planeX, planeY, x);
+            uint64_t t1 = bench_now();
+            for (int x = 0; x < SCREEN_WIDTH; x++) fixeds[x] = fixed_column(fixX, fixY, x);
+            uint64_t t2 = bench_now();
+            floatTime += t1 - t0;
+            fixedTime += t2 - t1;
+
+            // the float loop again from the pose raycast.c actually sees, so
+            // what's left is the fixed point loop and not the 16.16 inputs
+            for (int x = 0; x < SCREEN_WIDTH; x++)
+                roundeds[x] = float_column(to_float(fixX), to_float(fixY), to_float(ray_view.dirX), to_float(ray_view.dirY),
+                                           to_float(ray_view.planeX), to_float(ray_view.planeY), x);
+
+            for (int x = 0; x < SCREEN_WIDTH; x++) {
+                int dh = abs(floats[x].lineHeight - fixeds[x].lineHeight);
+                // walls taller than the screen only differ in rows that are clipped
+                int floatRows = floats[x].lineHeight < SCREEN_HEIGHT ? floats[x].lineHeight : SCREEN_HEIGHT;
+                int fixedRows = fixeds[x].lineHeight < SCREEN_HEIGHT ? fixeds[x].lineHeight : SCREEN_HEIGHT;
+                int dv = abs(floatRows - fixedRows);
+                int roundedRows = roundeds[x].lineHeight < SCREEN_HEIGHT ? roundeds[x].lineHeight : SCREEN_HEIGHT;
+                int dr = abs(roundedRows - fixedRows);
+                int dt = abs(floats[x].texX - fixeds[x].texX);
+                if (dt > TEX_WIDTH / 2) dt = TEX_WIDTH - dt;
+                heights[bucket(dh)]++;
+                visible[bucket(dv)]++;
+                rounded[bucket(dr)]++;
+                texels[bucket(dt)]++;
+                sink += fixeds[x].lineHeight;
+                columns++;
+                if (dv > 2 && worst++ < DDA_BENCH_WORST)
+                    printf("map %d pos %.4f,%.4f dir %.4f,%.4f column %d: float %d px, fixed %d px\n",
+                           m, posX, posY, dirX, dirY, x, floats[x].lineHeight, fixeds[x].lineHeight);
+            }
+        }
+    }
+
+    printf("%ld columns, %d maps x %d poses, doors removed\n", columns, DDA_BENCH_MAPS, DDA_BENCH_POSES);
+    printf("difference  column height      on screen        16.16 pose       texture column\n");
+    for (int b = 0; b < 5; b++)
+        printf("%-10s  %8ld %6.3f%%  %8ld %6.3f%%  %8ld %6.3f%%  %8ld %6.3f%%\n", bucketNames[b],
+               heights[b], 100.0 * heights[b] / columns, visible[b], 100.0 * visible[b] / columns,
+               rounded[b], 100.0 * rounded[b] / columns, texels[b], 100.0 * texels[b] / columns);
+    int frames = DDA_BENCH_MAPS * DDA_BENCH_POSES;
+    printf("host us per frame: float %.1f, fixed %.1f\n", floatTime / 1000.0 / frames, fixedTime / 1000.0 / frames);
+}
@@ -0,0 +1,36 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+
+static const struct {
+    const char *name;
+    void (*run)(void);
+} benches[] = {
+    { "walls", bench_walls },
+    { "shade", bench_shade },
+    { "textures", bench_textures },
+    { "dda", bench_dda },
+    { "sprites", bench_sprites },
+};
+
+#define BENCH_COUNT (int)(sizeof(benches) / sizeof(benches[0]))
+
+uint64_t bench_now(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000u + t.tv_nsec;
+}
+
+// runs the benches named on the command line, or all of them
+int main(int argc, char **argv) {
+    for (int i = 0; i < BENCH_COUNT; i++) {
+        bool wanted = argc < 2;
+        for (int a = 1; a < argc; a++) wanted |= !strcmp(argv[a], benches[i].name);
+        if (!wanted) continue;
+        printf("== %s\n", benches[i].name);
+        benches[i].run();
+    }
+    return 0;
+}
@@ -0,0 +1,377 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "sprite.h"
+#include "screen.h"
+#include "assets/enemy_melee_walk.h"
+#include "assets/gun_idle.h"
+
+#define SPRITE_BENCH_ENEMIES 10
+#define SPRITE_BENCH_FRAMES 200
+#define SPRITE_BENCH_RUNS 5
+// random overlapping scenes per depth band
+#define SPRITE_BENCH_SCENES 200
+
+static uint16_t pixels[SCREEN_WIDTH * SCREEN_HEIGHT] __attribute__((aligned(4)));
+static uint16_t refPixels[SCREEN_WIDTH * SCREEN_HEIGHT] __attribute__((aligned(4)));
+static fix_t zbuf[SCREEN_WIDTH];
+
+// a frame as the converter stored it before the span encoding, one palette
+// index per texel and a transparent index
+typedef struct {
+    const uint8_t *pixels;
+    int w, h;
+    const uint16_t *palette;
+    int transparent;
+} RawImage;
+
+static uint8_t rawEnemy[ENEMY_MELEE_WALK_FRAMES][ENEMY_MELEE_WALK_WIDTH * ENEMY_MELEE_WALK_HEIGHT];
+static uint8_t rawGun[GUN_IDLE_WIDTH * GUN_IDLE_HEIGHT];
+
+// expands the spans of img back to a row-major w x h index array, lines are
+// columns when `columns` is set
+static RawImage decode_spans(uint8_t *out, const SpriteImage *img, bool columns, int transparent) {
+    int lines = columns ? img->w : img->h;
+    memset(out, transparent, img->w * img->h);
+    for (int l = 0; l < lines; l++) {
+        const uint8_t *line = img->spans + img->lines[l];
+        int spans = *line++, t = 0;
+        while (spans--) {
+            t += line[0];
+            int run = line[1];
+            for (int i = 0; i < run; i++, t++)
+                out[columns ? t * img->w + l : l * img->w + t] = line[2 + i];
+            line += 2 + run;
+        }
+    }
+    return (RawImage){ out, img->w, img->h, img->palette, transparent };
+}
+
+static long divides;
+
+// the loop render_world() had before sprite.c: two divides per pixel
+static void divide_draw(const RenderTarget *rt, fix_t depth, int x, int y, int scrW, int scrH, const RawImage *img) {
+    int fw = img->w, fh = img->h;
+    for (int dy = 0; dy < scrH; dy++) {
+        int py = y + dy;
+        if (py < 0 || py >= rt->height) continue;
+        int texY = dy * fh / scrH;
+        divides++;
+        for (int dx = 0; dx < scrW; dx++) {
+            int px = x + dx;
+            if (px < 0 || px >= rt->width) continue;
+            if (depth >= zbuf[px]) continue;
+            int texX = dx * fw / scrW;
+            divides++;
+            uint8_t idx = img->pixels[texY * fw + texX];
+            if (idx != img->transparent) rt->pixels[py * rt->width + px] = img->palette[idx];
+        }
+    }
+}
+
+static uint16_t colTexel[SCREEN_WIDTH], rowOffset[SCREEN_HEIGHT];
+
+static void build_steps(uint16_t *out, int n, int first, int size, int scr, int stride) {
+    int tex = first * size / scr, rem = first * size % scr;
+    int stepQ = size / scr, stepR = size % scr;
+    for (int i = 0; i < n; i++) {
+        out[i] = tex * stride;
+        tex += stepQ;
+        rem += stepR;
+        if (rem >= scr) { rem -= scr; tex++; }
+    }
+}
+
+// the first sprite_draw(): texel tables, rows outer, a depth test per pixel
+static void table_draw(const RenderTarget *rt, fix_t depth, int x, int y, int scrW, int scrH, const RawImage *img) {
+    int x0 = (x < 0) ? 0 : x, x1 = (x + scrW > rt->width) ? rt->width : x + scrW;
+    int y0 = (y < 0) ? 0 : y, y1 = (y + scrH > rt->height) ? rt->height : y + scrH;
+    if (x0 >= x1 || y0 >= y1) return;
+    build_steps(colTexel, x1 - x0, x0 - x, img->w, scrW, 1);
+    build_steps(rowOffset, y1 - y0, y0 - y, img->h, scrH, img->w);
+    for (int py = y0; py < y1; py++) {
+        const uint8_t *src = img->pixels + rowOffset[py - y0];
+        uint16_t *dst = rt->pixels + py * rt->width;
+        for (int px = x0; px < x1; px++) {
+            if (depth >= zbuf[px]) continue;
+            uint8_t idx = src[colTexel[px - x0]];
+            if (idx != img->transparent) dst[px] = img->palette[idx];
+        }
+    }
+}
+
+// columns outer, one depth test per column, still every texel tested for
+// transparency
+static void column_draw(const RenderTarget *rt, fix_t depth, int x, int y, int scrW, int scrH, const RawImage *img) {
+    int x0 = (x < 0) ? 0 : x, x1 = (x + scrW > rt->width) ? rt->width : x + scrW;
+    int y0 = (y < 0) ? 0 : y, y1 = (y + scrH > rt->height) ? rt->height : y + scrH;
+    if (x0 >= x1 || y0 >= y1) return;
+    int rows = y1 - y0, stride = rt->width;
+    build_steps(colTexel, x1 - x0, x0 - x, img->w, scrW, 1);
+    build_steps(rowOffset, rows, y0 - y, img->h, scrH, img->w);
+    for (int px = x0; px < x1; px++) {
+        if (depth >= zbuf[px]) continue;
+        const uint8_t *src = img->pixels + colTexel[px - x0];
+        uint16_t *dst = rt->pixels + y0 * stride + px;
+        for (int r = 0; r < rows; r++, dst += stride) {
+            uint8_t idx = src[rowOffset[r]];
+            if (idx != img->transparent) *dst = img->palette[idx];
+        }
+    }
+}
+
+// the unscaled overlay loop before sprite_blit()
+static void raw_blit(const RenderTarget *rt, int x, int y, const RawImage *img) {
+    for (int dy = 0; dy < img->h; dy++) {
+        for (int dx = 0; dx < img->w; dx++) {
+            uint8_t idx = img->pixels[dy * img->w + dx];
+            if (idx == img->transparent) continue;
+            int px = x + dx, py = y + dy;
+            if (px >= 0 && px < rt->width && py >= 0 && py < rt->height) rt->pixels[py * rt->width + px] = img->palette[idx];
+        }
+    }
+}
+
+// one enemy placed like render_world() does for a target of the screen size
+typedef struct {
+    fix_t depth;
+    float ty;
+    int x, y, w, h;
+    int frame;
+    SpriteImage img;
+} Enemy;
+
+static Enemy place(float ty, int screenX, int frame, bool lods) {
+    int h = (int)(SCREEN_HEIGHT / ty);
+    int spr_w = ENEMY_MELEE_WALK_WIDTH, spr_h = ENEMY_MELEE_WALK_HEIGHT;
+    int w = (int)(h * (float)spr_w / spr_h);
+    int lod = 0;
+    while (lods && lod < ENEMY_MELEE_WALK_LODS - 1 && (spr_h >> (lod + 1)) >= h) lod++;
+    spr_w >>= lod;
+    spr_h >>= lod;
+    const enemy_melee_walk_frame_t *fi = &enemy_melee_walk_frame_info[lod][frame];
+    float scale_x = (float)w / spr_w, scale_y = (float)h / spr_h;
+    Enemy e = { fix_from_float(ty), ty, screenX - w / 2 + (int)(fi->x * scale_x),
+                SCREEN_HEIGHT / 2 - h / 2 + (int)(fi->y * scale_y), (int)(fi->w * scale_x), (int)(fi->h * scale_y), frame,
+                { &enemy_melee_walk_spans[fi->spans], &enemy_melee_walk_lines[fi->lines], fi->w, fi->h, enemy_melee_walk_palette } };
+    return e;
+}
+
+// bytes of span data sprite_draw() reads for the columns it doesn't skip
+static int span_bytes(const Enemy *e) {
+    int bytes = 0;
+    for (int px = (e->x < 0 ? 0 : e->x); px < e->x + e->w && px < SCREEN_WIDTH; px++) {
+        if (e->depth >= zbuf[px]) continue;
+        const uint8_t *line = e->img.spans + e->img.lines[(px - e->x) * e->img.w / e->w];
+        int spans = *line++;
+        bytes++;
+        while (spans--) {
+            bytes += 2 + line[1];
+            line += 2 + line[1];
+        }
+    }
+    return bytes;
+}
+
+typedef void (*raw_draw_t)(const RenderTarget *rt, fix_t depth, int x, int y, int scrW, int scrH, const RawImage *img);
+
+static RawImage rawFrames[ENEMY_MELEE_WALK_FRAMES];
+
+// best of a few runs, microseconds per frame of all enemies, back to front
+static double time_raw(raw_draw_t draw, const Enemy *e, int count) {
+    RenderTarget rt = { refPixels, SCREEN_WIDTH, SCREEN_HEIGHT };
+    memset(refPixels, 0, sizeof(refPixels));
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < SPRITE_BENCH_RUNS; run++) {
+        uint64_t start = bench_now();
+        for (int f = 0; f < SPRITE_BENCH_FRAMES; f++)
+            for (int i = count - 1; i >= 0; i--) draw(&rt, e[i].depth, e[i].x, e[i].y, e[i].w, e[i].h, &rawFrames[e[i].frame]);
+        uint64_t t = bench_now() - start;
+        if (t < best) best = t;
+    }
+    return best / 1000.0 / SPRITE_BENCH_FRAMES;
+}
+
+// the same with the current span blitter. painter's order resets the coverage
+// before every sprite, which leaves sprite_draw() as the plain span blitter
+static double time_spans(const Enemy *e, int count, bool frontToBack) {
+    RenderTarget rt = { pixels, SCREEN_WIDTH, SCREEN_HEIGHT };
+    memset(pixels, 0, sizeof(pixels));
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < SPRITE_BENCH_RUNS; run++) {
+        uint64_t start = bench_now();
+        for (int f = 0; f < SPRITE_BENCH_FRAMES; f++) {
+            sprite_clip_reset(SCREEN_WIDTH);
+            for (int n = 0; n < count; n++) {
+                const Enemy *s = frontToBack ? &e[n] : &e[count - 1 - n];
+                if (!frontToBack) sprite_clip_reset(SCREEN_WIDTH);
+                sprite_draw(&rt, zbuf, s->depth, s->x, s->y, s->w, s->h, &s->img);
+            }
+        }
+        uint64_t t = bench_now() - start;
+        if (t < best) best = t;
+    }
+    return best / 1000.0 / SPRITE_BENCH_FRAMES;
+}
+
+// pillars nearer than every enemy over `hidden` of each 50 columns
+static void set_pillars(int hidden) {
+    for (int x = 0; x < SCREEN_WIDTH; x++) zbuf[x] = (x % 50 < hidden) ? FIX_ONE / 4 : FIX_ONE * 20;
+}
+
+// 10 enemies at point-blank range, ty 0.35 to 0.8, spread over the view
+static void point_blank(void) {
+    Enemy e[SPRITE_BENCH_ENEMIES];
+    for (int i = 0; i < SPRITE_BENCH_ENEMIES; i++)
+        e[i] = place(0.35f + 0.05f * i, 20 + i * 40, i % ENEMY_MELEE_WALK_FRAMES, false);
+
+    printf("%d enemies at ty 0.35-0.8 (%d-%d px tall), us per frame\n", SPRITE_BENCH_ENEMIES,
+           (int)(SCREEN_HEIGHT / 0.8f), (int)(SCREEN_HEIGHT / 0.35f));
+    printf("hidden   divides  per-pixel divide  texel table  column-major  spans\n");
+    static const int hidden[] = { 10, 25, 40 };
+    for (int k = 0; k < 3; k++) {
+        set_pillars(hidden[k]);
+        divides = 0;
+        double div = time_raw(divide_draw, e, SPRITE_BENCH_ENEMIES);
+        long perFrame = divides / (SPRITE_BENCH_RUNS * SPRITE_BENCH_FRAMES);
+        double table = time_raw(table_draw, e, SPRITE_BENCH_ENEMIES);
+        double column = time_raw(column_draw, e, SPRITE_BENCH_ENEMIES);
+        double spans = time_spans(e, SPRITE_BENCH_ENEMIES, false);
+        // the enemies don't overlap, so every blitter draws the same pixels
+        bool same = !memcmp(pixels, refPixels, sizeof(pixels));
+        printf("%3d%%    %7ld  %16.1f  %11.1f  %12.1f  %5.1f%s\n", hidden[k] * 2, perFrame, div, table, column, spans,
+               same ? "" : "  (different pixels)");
+    }
+}
+
+// the gun at its hud position: raw indices, row spans, pre-decoded overlay
+static void gun(void) {
+    const gun_idle_frame_t *fi = &gun_idle_frame_info[0];
+    SpriteImage img = { &gun_idle_spans[fi->spans], &gun_idle_lines[fi->lines], fi->w, fi->h, gun_idle_palette };
+    RawImage raw = decode_spans(rawGun, &img, false, GUN_IDLE_TRANSPARENT_IDX);
+    int x = SCREEN_WIDTH - GUN_IDLE_WIDTH + fi->x, y = SCREEN_HEIGHT - GUN_IDLE_HEIGHT + fi->y;
+    static SpriteOverlay overlay;
+    sprite_prepare_overlay(&overlay, SCREEN_WIDTH, SCREEN_HEIGHT, x, y, &img);
+
+    int opaque = 0;
+    for (int i = 0; i < fi->w * fi->h; i++) opaque += rawGun[i] != GUN_IDLE_TRANSPARENT_IDX;
+
+    RenderTarget rt = { pixels, SCREEN_WIDTH, SCREEN_HEIGHT };
+    double best[3] = { 1e30, 1e30, 1e30 };
+    for (int run = 0; run < SPRITE_BENCH_RUNS; run++) {
+        for (int v = 0; v < 3; v++) {
+            uint64_t start = bench_now();
+            for (int f = 0; f < SPRITE_BENCH_FRAMES * 10; f++) {
+                if (v == 0) raw_blit(&rt, x, y, &raw);
+                else if (v == 1) sprite_blit(&rt, x, y, &img);
+                else sprite_blit_overlay(&rt, &overlay);
+            }
+            double t = (bench_now() - start) / 1000.0 / (SPRITE_BENCH_FRAMES * 10);
+            if (t < best[v]) best[v] = t;
+        }
+    }
+    printf("gun idle frame, %d texels, %d opaque: raw %.2f us, spans %.2f us, overlay %.2f us\n",
+           fi->w * fi->h, opaque, best[0], best[1], best[2]);
+}
+
+// 10 walk frames at a small height from the full size frame or the level
+// render_world() picks
+static void lods(void) {
+    set_pillars(0);
+    RenderTarget rt = { pixels, SCREEN_WIDTH, SCREEN_HEIGHT };
+    static const int heights[] = { 64, 32 };
+    printf("10 enemies     full size          level\n");
+    for (int k = 0; k < 2; k++) {
+        float ty = (float)SCREEN_HEIGHT / heights[k];
+        double us[2];
+        int bytes[2] = { 0 };
+        for (int l = 0; l < 2; l++) {
+            Enemy e[SPRITE_BENCH_ENEMIES];
+            for (int i = 0; i < SPRITE_BENCH_ENEMIES; i++) {
+                e[i] = place(ty, 20 + i * 40, i % ENEMY_MELEE_WALK_FRAMES, l);
+                bytes[l] += span_bytes(&e[i]);
+            }
+            uint64_t best = UINT64_MAX;
+            for (int run = 0; run < SPRITE_BENCH_RUNS; run++) {
+                uint64_t start = bench_now();
+                for (int f = 0; f < SPRITE_BENCH_FRAMES * 10; f++) {
+                    sprite_clip_reset(SCREEN_WIDTH);
+                    for (int i = 0; i < SPRITE_BENCH_ENEMIES; i++)
+                        sprite_draw(&rt, zbuf, e[i].depth, e[i].x, e[i].y, e[i].w, e[i].h, &e[i].img);
+                }
+                uint64_t t = bench_now() - start;
+                if (t < best) best = t;
+            }
+            us[l] = best / 1000.0 / (SPRITE_BENCH_FRAMES * 10);
+        }
+        printf("h %3d    %5.1f us %5.1f KB   %5.1f us %5.1f KB\n", heights[k], us[0], bytes[0] / 1024.0, us[1],
+               bytes[1] / 1024.0);
+    }
+}
+
+static int by_depth(const void *a, const void *b) {
+    float x = ((const Enemy *)a)->ty, y = ((const Enemy *)b)->ty;
+    return (x > y) - (x < y);
+}
+
+// random hordes of 10 closing in on the player, nearest drawn first with the
+// coverage lists against painter's order
+static void hordes(void) {
+    set_pillars(0);
+    RenderTarget rt = { pixels, SCREEN_WIDTH, SCREEN_HEIGHT }, ref = { refPixels, SCREEN_WIDTH, SCREEN_HEIGHT };
+    static const float nears[] = { 0.4f, 0.7f, 1.0f, 2.0f };
+    printf("hordes         painter's  front to back  different pixels\n");
+    srand(1);
+    for (int k = 0; k < 4; k++) {
+        uint64_t painter = 0, front = 0;
+        long diff = 0;
+        for (int scene = 0; scene < SPRITE_BENCH_SCENES; scene++) {
+            Enemy e[SPRITE_BENCH_ENEMIES];
+            for (int i = 0; i < SPRITE_BENCH_ENEMIES; i++) {
+                float ty = nears[k] * (1 + (rand() % 1000) / 1000.0f);
+                int screenX = SCREEN_WIDTH / 2 + (rand() % 2001 - 1000) * 120 / 1000;
+                e[i] = place(ty, screenX, rand() % ENEMY_MELEE_WALK_FRAMES, true);
+            }
+            qsort(e, SPRITE_BENCH_ENEMIES, sizeof(Enemy), by_depth);
+            memset(pixels, 0, sizeof(pixels));
+            memset(refPixels, 0, sizeof(refPixels));
+
+            uint64_t t0 = bench_now();
+            for (int f = 0; f < 20; f++) {
+                for (int i = SPRITE_BENCH_ENEMIES - 1; i >= 0; i--) {
+                    sprite_clip_reset(SCREEN_WIDTH);
+                    sprite_draw(&ref, zbuf, e[i].depth, e[i].x, e[i].y, e[i].w, e[i].h, &e[i].img);
+                }
+            }
+            uint64_t t1 = bench_now();
+            for (int f = 0; f < 20; f++) {
+                sprite_clip_reset(SCREEN_WIDTH);
+                for (int i = 0; i < SPRITE_BENCH_ENEMIES; i++)
+                    sprite_draw(&rt, zbuf, e[i].depth, e[i].x, e[i].y, e[i].w, e[i].h, &e[i].img);
+            }
+            uint64_t t2 = bench_now();
+            painter += t1 - t0;
+            front += t2 - t1;
+            for (int p = 0; p < SCREEN_WIDTH * SCREEN_HEIGHT; p++) diff += pixels[p] != refPixels[p];
+        }
+        int frames = SPRITE_BENCH_SCENES * 20;
+        printf("ty %.1f-%.1f  %6.1f us  %10.1f us  %16ld\n", nears[k], 2 * nears[k], painter / 1000.0 / frames,
+               front / 1000.0 / frames, diff);
+    }
+}
+
+// enemy and hud sprite blitters from the per-pixel divide loop up to front
+// to back drawing, each against the one it replaced
+void bench_sprites(void) {
+    for (int f = 0; f < ENEMY_MELEE_WALK_FRAMES; f++) {
+        const enemy_melee_walk_frame_t *fi = &enemy_melee_walk_frame_info[0][f];
+        SpriteImage img = { &enemy_melee_walk_spans[fi->spans], &enemy_melee_walk_lines[fi->lines], fi->w, fi->h, enemy_melee_walk_palette };
+        rawFrames[f] = decode_spans(rawEnemy[f], &img, true, ENEMY_MELEE_WALK_TRANSPARENT_IDX);
+    }
+    point_blank();
+    gun();
+    lods();
+    hordes();
+}
@@ -0,0 +1,13 @@
+// host stand-in for the parts of gint's display.h the renderer sources use
+#ifndef BENCH_GINT_DISPLAY_H
+#define BENCH_GINT_DISPLAY_H
+
+#include <stdint.h>
+
+typedef uint16_t color_t;
+
+#define C_RGB(r, g, b) (((r) << 11) | ((g) << 6) | (b))
+#define C_WHITE 0xffff
+#define C_BLACK 0x0000
+
+#endif
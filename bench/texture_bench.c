@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "bench.h"
+#include "map.h"
+#include "raycast.h"
+#include "screen.h"
+#include "assets/wall_texture.h"
+
+#define TEX_BENCH_MAPS 20
+#define TEX_BENCH_POSES 10
+#define TEX_BENCH_COLUMNS (TEX_BENCH_MAPS * TEX_BENCH_POSES * SCREEN_WIDTH)
+#define TEX_BENCH_RUNS 5
+
+#define TEX_COUNT (int)(sizeof(wall_textures) / sizeof(wall_textures[0]))
+#define CACHE_LINE 32
+#define CACHE_WAYS 4
+#define CACHE_MAX_SETS 256
+
+// one wall column as wall_draw_column() samples it
+typedef struct {
+    uint8_t mip, texture, texX;
+    uint8_t rows, yStart;
+    uint16_t x;
+    fix_t texPos, step;
+} TexColumn;
+
+static TexColumn columns[TEX_BENCH_COLUMNS];
+static int columnCount;
+
+// the same textures stored row-major, the layout before convert_wall
+// transposed them
+static uint8_t rowMajor[TEX_MIP_LEVELS][TEX_COUNT * TEX_WIDTH * TEX_HEIGHT];
+
+// set associative, least recently used, allocates on reads and writes
+typedef struct {
+    int sets;
+    uint32_t tags[CACHE_MAX_SETS][CACHE_WAYS];
+    uint32_t age[CACHE_MAX_SETS][CACHE_WAYS];
+    uint32_t clock, misses;
+} Cache;
+
+static void cache_init(Cache *c, int bytes) {
+    memset(c, 0, sizeof(*c));
+    c->sets = bytes / (CACHE_LINE * CACHE_WAYS);
+    memset(c->tags, 0xFF, sizeof(c->tags));
+}
+
+static void cache_access(Cache *c, uint32_t addr) {
+    uint32_t line = addr / CACHE_LINE;
+    int set = line % c->sets;
+    int oldest = 0;
+    c->clock++;
+    for (int w = 0; w < CACHE_WAYS; w++) {
+        if (c->tags[set][w] == line) { c->age[set][w] = c->clock; return; }
+        if (c->age[set][w] < c->age[set][oldest]) oldest = w;
+    }
+    c->misses++;
+    c->tags[set][oldest] = line;
+    c->age[set][oldest] = c->clock;
+}
+
+// frame buffer addresses sit above all the textures
+#define FRAME_BASE (TEX_MIP_LEVELS * TEX_COUNT * TEX_WIDTH * TEX_HEIGHT)
+
+// offset of a texel in either layout, mips one after the other
+static uint32_t texel_offset(const TexColumn *col, int texY, bool columnMajor) {
+    int size = TEX_HEIGHT >> col->mip;
+    uint32_t base = (uint32_t)col->mip * TEX_COUNT * TEX_WIDTH * TEX_HEIGHT;
+    return base + (columnMajor ? (col->texture * size + col->texX) * size + texY
+                               : (col->texture * size + texY) * size + col->texX);
+}
+
+static void build_row_major(void) {
+    for (int m = 0; m < TEX_MIP_LEVELS; m++) {
+        int size = TEX_HEIGHT >> m;
+        for (int t = 0; t < TEX_COUNT; t++)
+            for (int x = 0; x < size; x++)
+                for (int y = 0; y < size; y++)
+                    rowMajor[m][(t * size + y) * size + x] = wall_texture_mips[m][(t * size + x) * size + y];
+    }
+}
+
+// full resolution frames from random poses over generated maps
+static void record_columns(void) {
+    columnCount = 0;
+    srand(1);
+    for (int m = 0; m < TEX_BENCH_MAPS; m++) {
+        generateMap();
+        int level = m % WALL_LEVEL_TEXTURES;
+        for (int p = 0; p < TEX_BENCH_POSES; p++) {
+            int cx, cy;
+            do { cx = 1 + rand() % (MAP_WIDTH - 2); cy = 1 + rand() % (MAP_HEIGHT - 2); } while (map_get(cx, cy) != TILE_EMPTY);
+            float angle = (rand() % 3600) * (6.2831853f / 3600);
+            float dirX = cosf(angle), dirY = sinf(angle);
+            raycast_set_view(dirX, dirY, -dirY * 0.66f, dirX * 0.66f);
+            fix_t posX = fix_from_int(cx) + FIX_ONE / 2, posY = fix_from_int(cy) + FIX_ONE / 2;
+
+            for (int x = 0; x < SCREEN_WIDTH; x++) {
+                RayHit hit;
+                raycast_column(posX, posY, x, &hit);
+                int texture = (tileInfo[hit.tile].texture == TEX_LEVEL) ? level : tileInfo[hit.tile].texture;
+
+                // wall_draw_column() without the drawing
+                int height = SCREEN_HEIGHT;
+                int lineHeight = (height << FIX_SHIFT) / hit.perpDist;
+                if (lineHeight < 1) lineHeight = 1;
+                int drawStart = -lineHeight / 2 + height / 2;
+                int drawEnd = lineHeight / 2 + height / 2;
+                int mip = 0;
+                while (mip < TEX_MIP_LEVELS - 1 && (lineHeight << (mip + 1)) <= TEX_HEIGHT) mip++;
+                int size = TEX_HEIGHT >> mip;
+                fix_t step = (size << FIX_SHIFT) / lineHeight;
+                int yStart = (drawStart < 0) ? 0 : drawStart;
+                int yEnd = (drawEnd >= height) ? height - 1 : drawEnd;
+
+                TexColumn *col = &columns[columnCount++];
+                col->mip = mip;
+                col->texture = texture;
+                col->texX = (hit.texU * size) >> FIX_SHIFT;
+                col->texPos = (drawStart - height / 2 + lineHeight / 2) * step;
+                col->step = step;
+                col->rows = yEnd - yStart + 1;
+                col->x = x;
+                col->yStart = yStart;
+            }
+        }
+    }
+}
+
+// misses of texel reads only, the frame buffer stores go through the cache
+// too when `stores` is set
+static void simulate(int cacheBytes, bool stores) {
+    static Cache rowCache, colCache;
+    cache_init(&rowCache, cacheBytes);
+    cache_init(&colCache, cacheBytes);
+    uint32_t reads = 0, rowMisses = 0, colMisses = 0;
+    for (int i = 0; i < columnCount; i++) {
+        const TexColumn *col = &columns[i];
+        int size = TEX_HEIGHT >> col->mip;
+        fix_t texPos = col->texPos;
+        for (int r = 0; r < col->rows; r++, texPos += col->step) {
+            int texY = (texPos >> FIX_SHIFT) & (size - 1);
+            uint32_t before = rowCache.misses;
+            cache_access(&rowCache, texel_offset(col, texY, false));
+            rowMisses += rowCache.misses - before;
+            before = colCache.misses;
+            cache_access(&colCache, texel_offset(col, texY, true));
+            colMisses += colCache.misses - before;
+            reads++;
+            if (stores) {
+                uint32_t pixel = FRAME_BASE + ((col->yStart + r) * SCREEN_WIDTH + col->x) * 2;
+                cache_access(&rowCache, pixel);
+                cache_access(&colCache, pixel);
+            }
+        }
+    }
+    printf("%2d KiB %-7s %9u %9u %5.1f%% %9u %5.1f%%  x%.1f\n", cacheBytes / 1024, stores ? "+vram" : "",
+           reads, rowMisses, 100.0 * rowMisses / reads, colMisses, 100.0 * colMisses / reads,
+           (double)rowMisses / colMisses);
+}
+
+static uint16_t out[SCREEN_HEIGHT];
+static uint32_t checksum;
+
+// host time to sample every recorded column, best of a few runs
+static double time_sampling(bool columnMajor) {
+    uint64_t best = UINT64_MAX;
+    for (int run = 0; run < TEX_BENCH_RUNS; run++) {
+        uint64_t start = bench_now();
+        for (int i = 0; i < columnCount; i++) {
+            const TexColumn *col = &columns[i];
+            int size = TEX_HEIGHT >> col->mip;
+            fix_t texPos = col->texPos;
+            if (columnMajor) {
+                const uint8_t *column = &wall_texture_mips[col->mip][(col->texture * size + col->texX) * size];
+                for (int r = 0; r < col->rows; r++, texPos += col->step)
+                    out[r] = wall_palette[column[(texPos >> FIX_SHIFT) & (size - 1)]];
+            } else {
+                const uint8_t *tex = &rowMajor[col->mip][col->texture * size * size + col->texX];
+                for (int r = 0; r < col->rows; r++, texPos += col->step)
+                    out[r] = wall_palette[tex[((texPos >> FIX_SHIFT) & (size - 1)) * size]];
+            }
+            checksum += out[col->rows - 1];
+        }
+        uint64_t t = bench_now() - start;
+        if (t < best) best = t;
+    }
+    return (double)best / (TEX_BENCH_MAPS * TEX_BENCH_POSES);
+}
+
+// wall texel reads of real full resolution frames replayed through an operand
+// cache with the sh4's 32-byte lines, row-major against column-major storage.
+// floors, sprites and the stack are left out
+void bench_textures(void) {
+    build_row_major();
+    record_columns();
+
+    printf("%d frames, %d-way lru cache with %d-byte lines, texel read misses\n",
+           TEX_BENCH_MAPS * TEX_BENCH_POSES, CACHE_WAYS, CACHE_LINE);
+    printf("cache            reads  row-major misses  column-major misses\n");
+    for (int kb = 8; kb <= 32; kb *= 2) {
+        simulate(kb * 1024, false);
+        simulate(kb * 1024, true);
+    }
+
+    double row = time_sampling(false), col = time_sampling(true);
+    printf("host us per frame: row-major %.1f, column-major %.1f (checksum %u)\n", row / 1000, col / 1000, (unsigned)checksum);
+}
@@ -0,0 +1,258 @@
+#include <stdio.h>
+#include <string.h>
+#include "bench.h"
+#include "wall.h"
+#include "screen.h"
+#include "assets/wall_texture.h"
+
+// screens of columns drawn per height and width
+#define WALL_BENCH_FRAMES 20
+#define WALL_BENCH_RUNS 3
+// heights are reported in buckets of this many rows
+#define WALL_BENCH_BUCKET 16
+
+static uint16_t pixels[SCREEN_WIDTH * SCREEN_HEIGHT] __attribute__((aligned(4)));
+static uint16_t refPixels[SCREEN_WIDTH * SCREEN_HEIGHT] __attribute__((aligned(4)));
+
+typedef void (*draw_column_t)(const RenderTarget *rt, int x, int width, const RayHit *hit, int horiz, int texture);
+
+#define WALL_PALETTE_SIZE (sizeof(wall_palette) / sizeof(wall_palette[0]))
+
+// same banks and pick as wall.c, so both sides draw the same pixels
+static uint16_t ref_banks[SHADE_BANKS][WALL_PALETTE_SIZE];
+static int16_t refCeilEnd[SCREEN_WIDTH], refFloorStart[SCREEN_WIDTH];
+
+static void ref_init(void) {
+    for (int b = 0; b < SHADE_BANKS; b++) {
+        int shade = (b * 256 + 128) / SHADE_BANKS;
+        for (unsigned i = 0; i < WALL_PALETTE_SIZE; i++) {
+            uint16_t color = wall_palette[i];
+            int r = ((color >> 11) * shade) >> 8;
+            int g = (((color >> 6) & 0x1F) * shade) >> 8;
+            int b5 = ((color & 0x1F) * shade) >> 8;
+            ref_banks[b][i] = (r << 11) | (g << 6) | b5;
+        }
+    }
+}
+
+static const uint16_t *ref_palette(int shade, fix_t dist) {
+    int final_shade = (shade << FIX_SHIFT) / (FIX_ONE + dist / 5);
+    return (final_shade < SHADE_FULL) ? ref_banks[final_shade * SHADE_BANKS >> 8] : wall_palette;
+}
+
+// the column loop before the per-width blitters: a masked texel index and
+// 16-bit stores for every pixel. textured floors only, like the bench runs
+static void ref_draw_column(const RenderTarget *rt, int x, int width, const RayHit *hit, int horiz, int texture) {
+    int height = rt->height;
+    int lineHeight = (height << FIX_SHIFT) / hit->perpDist;
+    if (lineHeight < 1) lineHeight = 1;
+    int drawStart = -lineHeight / 2 + height / 2 + horiz;
+    int drawEnd = lineHeight / 2 + height / 2 + horiz;
+
+    int mip = 0;
+    while (mip < TEX_MIP_LEVELS - 1 && (lineHeight << (mip + 1)) <= TEX_HEIGHT) mip++;
+    int size = TEX_HEIGHT >> mip;
+
+    int texX = (hit->texU * size) >> FIX_SHIFT;
+
+    fix_t step_tex = (size << FIX_SHIFT) / lineHeight;
+    fix_t texPos = (drawStart - horiz - height / 2 + lineHeight / 2) * step_tex;
+
+    int y_start = (drawStart < 0) ? 0 : drawStart;
+    int y_end = (drawEnd >= height) ? height - 1 : drawEnd;
+    refCeilEnd[x] = (y_start > height) ? height : y_start;
+    refFloorStart[x] = (y_end < -1) ? 0 : y_end + 1;
+    if (y_start > y_end) return;
+
+    const uint16_t *palette = ref_palette((hit->side == 1) ? 180 : 255, hit->perpDist);
+    const uint8_t *column = &wall_texture_mips[mip][(texture * size + texX) * size];
+    uint16_t *dest = &rt->pixels[y_start * rt->width + x];
+    for (int y = y_start; y <= y_end; y++) {
+        int texY = (texPos >> FIX_SHIFT) & (size - 1);
+        texPos += step_tex;
+        uint16_t color = palette[column[texY]];
+        switch (width) {
+            case 4: dest[3] = color; dest[2] = color; /* fallthrough */
+            case 2: dest[1] = color; /* fallthrough */
+            default: dest[0] = color;
+        }
+        dest += rt->width;
+    }
+}
+
+// the loop before the shade banks: every texel is unpacked, multiplied by
+// the column's shade and repacked
+static void unbanked_draw_column(const RenderTarget *rt, int x, int width, const RayHit *hit, int horiz, int texture) {
+    int height = rt->height;
+    int lineHeight = (height << FIX_SHIFT) / hit->perpDist;
+    if (lineHeight < 1) lineHeight = 1;
+    int drawStart = -lineHeight / 2 + height / 2 + horiz;
+    int drawEnd = lineHeight / 2 + height / 2 + horiz;
+
+    int mip = 0;
+    while (mip < TEX_MIP_LEVELS - 1 && (lineHeight << (mip + 1)) <= TEX_HEIGHT) mip++;
+    int size = TEX_HEIGHT >> mip;
+
+    int texX = (hit->texU * size) >> FIX_SHIFT;
+
+    fix_t step_tex = (size << FIX_SHIFT) / lineHeight;
+    fix_t texPos = (drawStart - horiz - height / 2 + lineHeight / 2) * step_tex;
+
+    int y_start = (drawStart < 0) ? 0 : drawStart;
+    int y_end = (drawEnd >= height) ? height - 1 : drawEnd;
+    refCeilEnd[x] = (y_start > height) ? height : y_start;
+    refFloorStart[x] = (y_end < -1) ? 0 : y_end + 1;
+    if (y_start > y_end) return;
+
+    int shade = (hit->side == 1) ? 180 : 255;
+    int final_shade = (shade << FIX_SHIFT) / (FIX_ONE + hit->perpDist / 5);
+    const uint8_t *column = &wall_texture_mips[mip][(texture * size + texX) * size];
+    uint16_t *dest = &rt->pixels[y_start * rt->width + x];
+    for (int y = y_start; y <= y_end; y++) {
+        int texY = (texPos >> FIX_SHIFT) & (size - 1);
+        texPos += step_tex;
+        uint16_t color = wall_palette[column[texY]];
+        if (final_shade < SHADE_FULL) {
+            int r = ((color >> 11) * final_shade) >> 8;
+            int g = (((color >> 6) & 0x1F) * final_shade) >> 8;
+            int b = ((color & 0x1F) * final_shade) >> 8;
+            color = (r << 11) | (g << 6) | b;
+        }
+        switch (width) {
+            case 4: dest[3] = color; dest[2] = color; /* fallthrough */
+            case 2: dest[1] = color; /* fallthrough */
+            default: dest[0] = color;
+        }
+        dest += rt->width;
+    }
+}
+
+// nanoseconds per column for a screen of columns about `rows` pixels tall,
+// best of a few runs
+static double time_columns(draw_column_t draw, uint16_t *target, int rows, int width) {
+    RenderTarget rt = { target, SCREEN_WIDTH, SCREEN_HEIGHT };
+    RayHit hit = { .perpDist = (SCREEN_HEIGHT << FIX_SHIFT) / rows, .side = 0 };
+    memset(target, 0, sizeof(pixels));
+    uint64_t best = UINT64_MAX;
+    int columns = 0;
+    for (int run = 0; run < WALL_BENCH_RUNS; run++) {
+        columns = 0;
+        uint64_t start = bench_now();
+        for (int f = 0; f < WALL_BENCH_FRAMES; f++) {
+            for (int x = 0; x + width <= SCREEN_WIDTH; x += width) {
+                // walk across the texture and the level textures like a real wall
+                hit.texU = (x * 331) & FIX_FRAC_MASK;
+                draw(&rt, x, width, &hit, 0, x % WALL_LEVEL_TEXTURES);
+                columns++;
+            }
+        }
+        uint64_t t = bench_now() - start;
+        if (t < best) best = t;
+    }
+    return (double)best / columns;
+}
+
+// every column height from 1 to the full screen at each column width, old
+// per-pixel loop against the current blitters
+void bench_walls(void) {
+    static const int widths[] = { 1, 2, 4 };
+    texturedFloor = true; // no flat fills, only the wall span is drawn
+    wall_init();
+    ref_init();
+    time_columns(wall_draw_column, pixels, SCREEN_HEIGHT, 1); // warm up
+    int mismatches = 0;
+
+    printf("ns per column, old loop / blitter\n");
+    printf("rows     ");
+    for (int w = 0; w < 3; w++) printf("      width %d      ", widths[w]);
+    printf("\n");
+
+    double total[3][2] = { { 0 } };
+    for (int lo = 1; lo <= SCREEN_HEIGHT; lo += WALL_BENCH_BUCKET) {
+        int hi = lo + WALL_BENCH_BUCKET - 1;
+        if (hi > SCREEN_HEIGHT) hi = SCREEN_HEIGHT;
+        printf("%3d-%-3d  ", lo, hi);
+        for (int w = 0; w < 3; w++) {
+            double ref = 0, cur = 0;
+            for (int rows = lo; rows <= hi; rows++) {
+                ref += time_columns(ref_draw_column, refPixels, rows, widths[w]);
+                cur += time_columns(wall_draw_column, pixels, rows, widths[w]);
+                mismatches += memcmp(pixels, refPixels, sizeof(pixels)) != 0;
+            }
+            total[w][0] += ref;
+            total[w][1] += cur;
+            printf("%7.1f %7.1f x%.2f ", ref / (hi - lo + 1), cur / (hi - lo + 1), ref / cur);
+        }
+        printf("\n");
+    }
+    printf("all      ");
+    for (int w = 0; w < 3; w++)
+        printf("%7.1f %7.1f x%.2f ", total[w][0] / SCREEN_HEIGHT, total[w][1] / SCREEN_HEIGHT, total[w][0] / total[w][1]);
+    printf("\n");
+
+    // walls taller than the screen, only the middle 224 rows are drawn
+    static const int tall[] = { 256, 384, 512, 1024, 2048 };
+    for (unsigned t = 0; t < sizeof(tall) / sizeof(tall[0]); t++) {
+        printf("%-7d  ", tall[t]);
+        for (int w = 0; w < 3; w++) {
+            double ref = time_columns(ref_draw_column, refPixels, tall[t], widths[w]);
+            double cur = time_columns(wall_draw_column, pixels, tall[t], widths[w]);
+            mismatches += memcmp(pixels, refPixels, sizeof(pixels)) != 0;
+            printf("%7.1f %7.1f x%.2f ", ref, cur, ref / cur);
+        }
+        printf("\n");
+    }
+    printf("%d of %d heights and widths drew different pixels\n", mismatches, 3 * (SCREEN_HEIGHT + 5));
+}
+
+// rows wall_draw_column() fills for a wall `rows` pixels tall
+static int visible_rows(int rows) {
+    int lineHeight = (SCREEN_HEIGHT << FIX_SHIFT) / ((SCREEN_HEIGHT << FIX_SHIFT) / rows);
+    int drawStart = -lineHeight / 2 + SCREEN_HEIGHT / 2;
+    int drawEnd = lineHeight / 2 + SCREEN_HEIGHT / 2;
+    if (drawStart < 0) drawStart = 0;
+    if (drawEnd >= SCREEN_HEIGHT) drawEnd = SCREEN_HEIGHT - 1;
+    return drawEnd - drawStart + 1;
+}
+
+// cost per wall pixel of shading every texel against one palette load from a
+// pre-multiplied bank. both sides are the per-pixel loop otherwise, so only
+// the shading differs
+void bench_shade(void) {
+    static const int widths[] = { 1, 2, 4 };
+    texturedFloor = true;
+    wall_init();
+    ref_init();
+    time_columns(ref_draw_column, refPixels, SCREEN_HEIGHT, 1); // warm up
+
+    printf("ns per pixel, unpack and multiply / shade bank\n");
+    printf("rows     ");
+    for (int w = 0; w < 3; w++) printf("     width %d       ", widths[w]);
+    printf("\n");
+
+    double total[3][2] = { { 0 } };
+    long pixelCount = 0;
+    for (int lo = 1; lo <= SCREEN_HEIGHT; lo += WALL_BENCH_BUCKET) {
+        int hi = lo + WALL_BENCH_BUCKET - 1;
+        if (hi > SCREEN_HEIGHT) hi = SCREEN_HEIGHT;
+        long bucketPixels = 0;
+        for (int rows = lo; rows <= hi; rows++) bucketPixels += visible_rows(rows);
+        pixelCount += bucketPixels;
+        printf("%3d-%-3d  ", lo, hi);
+        for (int w = 0; w < 3; w++) {
+            double old = 0, banked = 0;
+            for (int rows = lo; rows <= hi; rows++) {
+                old += time_columns(unbanked_draw_column, pixels, rows, widths[w]);
+                banked += time_columns(ref_draw_column, refPixels, rows, widths[w]);
+            }
+            total[w][0] += old;
+            total[w][1] += banked;
+            printf("%6.2f %6.2f x%.2f ", old / bucketPixels, banked / bucketPixels, old / banked);
+        }
+        printf("\n");
+    }
+    printf("all      ");
+    for (int w = 0; w < 3; w++)
+        printf("%6.2f %6.2f x%.2f ", total[w][0] / pixelCount, total[w][1] / pixelCount, total[w][0] / total[w][1]);
+    printf("\n");
+}
@@ -54,22 +54,26 @@ def _bbox_non_transparent(img, alpha_thresh=128):
                 max_x, max_y = max(max_x, x), max(max_y, y)
     return (min_x, min_y, max_x, max_y) if max_x >= 0 else None
 
-def compress_rle(indices):
-    if not indices: return []
-    compressed = []
-    curr_idx = indices[0]
-    curr_count = 0
-    for idx in indices:
-        if idx == curr_idx and curr_count < 255:
-            curr_count += 1
-        else:
-            compressed.append(curr_count)
-            compressed.append(curr_idx)
-            curr_idx = idx
-            curr_count = 1
-    compressed.append(curr_count)
-    compressed.append(curr_idx)
-    return compressed
+def encode_spans(indices, w, h, trans_idx, by_column=False):
+    # one line per row (or per column): span count, then for each opaque run
+    # the transparent pixels to skip before it, its length and its indices
+    assert w < 256 and h < 256
+    lines = []
+    for a in range(w if by_column else h):
+        n = h if by_column else w
+        line = [indices[b * w + a] if by_column else indices[a * w + b] for b in range(n)]
+        out, spans, pos = [], 0, 0
+        while pos < n:
+            start = pos
+            while start < n and line[start] == trans_idx: start += 1
+            if start == n: break
+            end = start
+            while end < n and line[end] != trans_idx: end += 1
+            out += [start - pos, end - start] + line[start:end]
+            spans += 1
+            pos = end
+        lines.append([spans] + out)
+    return lines
 
 def convert_enemy(image_path, output_header):
     img = Image.open(image_path).convert("RGBA")
@@ -89,6 +93,78 @@ def convert_enemy(image_path, output_header):
             if (i + 1) % width == 0: f.write("\n")
         f.write("};\n\n#endif\n")
 
+def _nearest_palette_idx(palette, r5, g5, b5):
+    best_idx = 0
+    best_diff = 1000000
+    for i, pc in enumerate(palette):
+        diff = abs((pc >> 11) - r5) + abs(((pc >> 6) & 0x1F) - g5) + abs((pc & 0x1F) - b5)
+        if diff < best_diff:
+            best_diff = diff
+            best_idx = i
+    return best_idx
+
+def _downsample_indexed(tex, size, palette):
+    # 2x2 box filter of a row-major indexed texture, averaged in rgb565 and mapped back to the palette
+    half = size // 2
+    out = []
+    cache = {}
+    for y in range(half):
+        for x in range(half):
+            quad = [tex[(2 * y + dy) * size + 2 * x + dx] for dy in (0, 1) for dx in (0, 1)]
+            r5 = (sum(palette[i] >> 11 for i in quad) + 2) // 4
+            g5 = (sum((palette[i] >> 6) & 0x1F for i in quad) + 2) // 4
+            b5 = (sum(palette[i] & 0x1F for i in quad) + 2) // 4
+            if (r5, g5, b5) not in cache:
+                cache[(r5, g5, b5)] = _nearest_palette_idx(palette, r5, g5, b5)
+            out.append(cache[(r5, g5, b5)])
+    return out
+
+WALL_MIP_LEVELS = 4 # 128, 64, 32, 16
+
+def write_wall_header(output_header, palette, tiles, tex_size, level_count, named):
+    # tiles are row-major indexed textures, one per level then the named extras
+    mips = []
+    for tex in tiles:
+        levels = [tex]
+        for m in range(1, WALL_MIP_LEVELS):
+            levels.append(_downsample_indexed(levels[-1], tex_size >> (m - 1), palette))
+        mips.append(levels)
+
+    with open(output_header, "w") as f:
+        f.write("#ifndef WALL_TEXTURE_H\n#define WALL_TEXTURE_H\n\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write(f"#define TEX_WIDTH {tex_size}\n")
+        f.write(f"#define TEX_HEIGHT {tex_size}\n")
+        f.write(f"#define TEX_MIP_LEVELS {WALL_MIP_LEVELS}\n\n")
+        f.write("// textures 0 to WALL_LEVEL_TEXTURES - 1 belong to the levels (walls, floor and\n// ceiling), the ones after them are never picked by a level\n")
+        f.write(f"#define WALL_LEVEL_TEXTURES {level_count}\n")
+        for i, name in enumerate(named):
+            f.write(f"#define WALL_TEX_{name} {level_count + i}\n")
+        f.write("\n")
+        f.write(f"static const uint16_t wall_palette[{len(palette)}] = {{\n")
+        f.write(", ".join(map(str, palette)) + "\n};\n\n")
+        # column-major (one texture column per line) so the renderer reads a column contiguously
+        f.write("// stored column-major: wall_textures[level][x * TEX_HEIGHT + y]\n")
+        for m in range(WALL_MIP_LEVELS):
+            size = tex_size >> m
+            name = "wall_textures" if m == 0 else f"wall_textures_mip{m}"
+            f.write(f"static const uint8_t {name}[{len(tiles)}][{size} * {size}] = {{\n")
+            for levels in mips:
+                tex = levels[m]
+                f.write("{\n")
+                for x in range(size):
+                    for y in range(size):
+                        f.write(f"{tex[y * size + x]}, ")
+                    f.write("\n")
+                f.write("},\n")
+            f.write("};\n\n")
+        f.write("// first texture of each mip level, level n is (TEX_WIDTH >> n) square\n")
+        f.write("static const uint8_t *const wall_texture_mips[TEX_MIP_LEVELS] = {\n")
+        f.write("  wall_textures[0],\n")
+        for m in range(1, WALL_MIP_LEVELS):
+            f.write(f"  wall_textures_mip{m}[0],\n")
+        f.write("};\n\n#endif\n")
+
 def convert_wall(image_path, output_header):
     img = Image.open(image_path).convert("RGB")
     tex_size = 128
@@ -96,27 +172,19 @@ def convert_wall(image_path, output_header):
     
     # tiles for levels 1-7
     tiles_coords = [(0, 0), (1, 0), (0, 1), (3, 2), (3, 0), (0, 2), (0, 3)]
+    # tiles used by no level, for special cells
+    named_coords = [("DOOR", (2, 1))]
     
-    with open(output_header, "w") as f:
-        f.write("#ifndef WALL_TEXTURE_H\n#define WALL_TEXTURE_H\n\n")
-        f.write("#include <stdint.h>\n\n")
-        f.write(f"#define TEX_WIDTH {tex_size}\n")
-        f.write(f"#define TEX_HEIGHT {tex_size}\n\n")
-        f.write(f"static const uint16_t wall_palette[{len(palette)}] = {{\n")
-        f.write(", ".join(map(str, palette)) + "\n};\n\n")
-        f.write(f"static const uint8_t wall_textures[7][128 * 128] = {{\n")
-        
-        for tx, ty in tiles_coords:
-            f.write("{\n")
-            for y in range(ty * tex_size, (ty + 1) * tex_size):
-                for x in range(tx * tex_size, (tx + 1) * tex_size):
-                    idx = indices[y * img.width + x]
-                    f.write(f"{idx}, ")
-                f.write("\n")
-            f.write("},\n")
-        f.write("};\n\n#endif\n")
+    tiles = []
+    for tx, ty in tiles_coords + [c for _, c in named_coords]:
+        tex = []
+        for y in range(ty * tex_size, (ty + 1) * tex_size):
+            for x in range(tx * tex_size, (tx + 1) * tex_size):
+                tex.append(indices[y * img.width + x])
+        tiles.append(tex)
+    write_wall_header(output_header, palette, tiles, tex_size, len(tiles_coords), [n for n, _ in named_coords])
 
-def convert_sprite_strip_cropped(folder_path, output_header, prefix, scale=1):
+def convert_sprite_strip_cropped(folder_path, output_header, prefix, scale=1, by_column=False, lods=1):
     folder = os.path.abspath(folder_path)
     frame_files = []
     for name in os.listdir(folder):
@@ -147,50 +215,81 @@ def convert_sprite_strip_cropped(folder_path, output_header, prefix, scale=1):
     frame_infos = []
     packed_indices = []
 
-    for img in frames:
-        bbox = _bbox_non_transparent(img)
-        if bbox is None:
-            frame_infos.append((0, 0, 1, 1, len(packed_indices)))
-            packed_indices.append(trans_idx)
-            continue
+    # level 0 is the strip itself, every further level halves it for distant sprites
+    for lod in range(lods):
+        for img in frames:
+            if lod > 0:
+                img = img.resize((sw >> lod, sh >> lod), Image.LANCZOS)
+            bbox = _bbox_non_transparent(img)
+            if bbox is None:
+                frame_infos.append((0, 0, 1, 1, len(packed_indices)))
+                packed_indices.append(trans_idx)
+                continue
         
-        min_x, min_y, max_x, max_y = bbox
-        w, h = max_x - min_x, max_y - min_y
+            min_x, min_y, max_x, max_y = bbox
+            w, h = max_x - min_x, max_y - min_y
         
-        offset = len(packed_indices)
-        frame_infos.append((min_x, min_y, w, h, offset))
+            offset = len(packed_indices)
+            frame_infos.append((min_x, min_y, w, h, offset))
         
-        for dy in range(h):
-            for dx in range(w):
-                r, g, b, a = img.getpixel((min_x + dx, min_y + dy))
-                if a < 128:
-                    packed_indices.append(trans_idx)
-                else:
-                    # Find closest color
-                    c565 = to_rgb565_gint(r, g, b)
-                    best_idx = 0
-                    best_diff = 1000000
-                    for i, pc in enumerate(palette):
-                        if i == trans_idx: continue
-                        diff = abs((pc >> 11) - (c565 >> 11)) + abs(((pc >> 6) & 0x1F) - ((c565 >> 6) & 0x1F)) + abs((pc & 0x1F) - (c565 & 0x1F))
-                        if diff < best_diff:
-                            best_diff = diff
-                            best_idx = i
-                    packed_indices.append(best_idx)
+            for dy in range(h):
+                for dx in range(w):
+                    r, g, b, a = img.getpixel((min_x + dx, min_y + dy))
+                    if a < 128:
+                        packed_indices.append(trans_idx)
+                    else:
+                        # Find closest color
+                        c565 = to_rgb565_gint(r, g, b)
+                        best_idx = 0
+                        best_diff = 1000000
+                        for i, pc in enumerate(palette):
+                            if i == trans_idx: continue
+                            diff = abs((pc >> 11) - (c565 >> 11)) + abs(((pc >> 6) & 0x1F) - ((c565 >> 6) & 0x1F)) + abs((pc & 0x1F) - (c565 & 0x1F))
+                            if diff < best_diff:
+                                best_diff = diff
+                                best_idx = i
+                        packed_indices.append(best_idx)
+
+    # frames are stored as opaque spans only, see encode_spans()
+    span_data, line_offsets = [], []
+    for i, (x, y, w, h, off) in enumerate(frame_infos):
+        base = len(span_data)
+        first_line = len(line_offsets)
+        for line in encode_spans(packed_indices[off:off + w * h], w, h, trans_idx, by_column):
+            line_offsets.append(len(span_data) - base)
+            span_data += line
+        frame_infos[i] = (x, y, w, h, base, first_line)
 
     guard = prefix + "_H"
     with open(output_header, "w") as f:
         f.write(f"#ifndef {guard}\n#define {guard}\n\n#include <stdint.h>\n\n")
         f.write(f"#define {prefix}_FRAMES {num_frames}\n#define {prefix}_WIDTH {logical_w}\n#define {prefix}_HEIGHT {logical_h}\n#define {prefix}_TRANSPARENT_IDX {trans_idx}\n\n")
-        f.write(f"typedef struct {{ int x, y, w, h; int offset; }} {prefix.lower()}_frame_t;\n\n")
-        f.write(f"static const {prefix.lower()}_frame_t {prefix.lower()}_frame_info[{num_frames}] = {{\n")
-        for (x, y, w, h, off) in frame_infos: f.write(f"  {{ {x}, {y}, {w}, {h}, {off} }},\n")
+        if lods > 1:
+            f.write(f"// level l of a frame is its WIDTH >> l by HEIGHT >> l version\n#define {prefix}_LODS {lods}\n\n")
+        f.write(f"// spans: offset of the frame in {prefix.lower()}_spans, lines: index of its first {'column' if by_column else 'row'} in {prefix.lower()}_lines\n")
+        f.write(f"typedef struct {{ int x, y, w, h; int spans, lines; }} {prefix.lower()}_frame_t;\n\n")
+        if lods > 1:
+            f.write(f"static const {prefix.lower()}_frame_t {prefix.lower()}_frame_info[{lods}][{num_frames}] = {{\n")
+            for lod in range(lods):
+                f.write("  {\n")
+                for (x, y, w, h, spans, lines) in frame_infos[lod * num_frames:(lod + 1) * num_frames]:
+                    f.write(f"    {{ {x}, {y}, {w}, {h}, {spans}, {lines} }},\n")
+                f.write("  },\n")
+        else:
+            f.write(f"static const {prefix.lower()}_frame_t {prefix.lower()}_frame_info[{num_frames}] = {{\n")
+            for (x, y, w, h, spans, lines) in frame_infos: f.write(f"  {{ {x}, {y}, {w}, {h}, {spans}, {lines} }},\n")
         f.write("};\n\n")
         f.write(f"static const uint16_t {prefix.lower()}_palette[{len(palette)}] = {{\n")
         f.write(", ".join(map(str, palette)) + "\n};\n\n")
-        f.write(f"static const uint8_t {prefix.lower()}_pixels[{len(packed_indices)}] = {{\n")
-        for i in range(0, len(packed_indices), 16):
-            f.write("  " + ", ".join(map(str, packed_indices[i:i+16])) + ",\n")
+        f.write(f"// start of each {'column' if by_column else 'row'} in {prefix.lower()}_spans, relative to its frame\n")
+        f.write(f"static const uint16_t {prefix.lower()}_lines[{len(line_offsets)}] = {{\n")
+        for i in range(0, len(line_offsets), 16):
+            f.write("  " + ", ".join(map(str, line_offsets[i:i+16])) + ",\n")
+        f.write("};\n\n")
+        f.write(f"// per {'column' if by_column else 'row'}: span count, then {{ skip, run, run indices }} for each span\n")
+        f.write(f"static const uint8_t {prefix.lower()}_spans[{len(span_data)}] = {{\n")
+        for i in range(0, len(span_data), 16):
+            f.write("  " + ", ".join(map(str, span_data[i:i+16])) + ",\n")
         f.write("};\n\n#endif\n")
 
 def convert_screen(image_path, output_header, var_name):
@@ -212,8 +311,10 @@ if __name__ == "__main__":
     convert_sprite_strip_cropped("scripts/spr_player_gun_shoot_effect", "src/assets/shoot_effect.h", "SHOOT_EFFECT", scale=2)
     convert_sprite_strip_cropped("scripts/spr_player_gun_idle", "src/assets/gun_idle.h", "GUN_IDLE", scale=2)
     convert_sprite_strip_cropped("scripts/spr_gun_shoot", "src/assets/gun_shoot.h", "GUN_SHOOT", scale=2)
-    convert_sprite_strip_cropped("scripts/spr_enemy_melee_walk", "src/assets/enemy_melee_walk.h", "ENEMY_MELEE_WALK", scale=1)
-    convert_sprite_strip_cropped("scripts/spr_enemy_melee_attack_loop", "src/assets/enemy_melee_attack.h", "ENEMY_MELEE_ATTACK", scale=1)
+    # enemies are scaled and drawn column by column, so their spans run down
+    # columns. half and quarter size levels are picked by on-screen height
+    convert_sprite_strip_cropped("scripts/spr_enemy_melee_walk", "src/assets/enemy_melee_walk.h", "ENEMY_MELEE_WALK", scale=1, by_column=True, lods=3)
+    convert_sprite_strip_cropped("scripts/spr_enemy_melee_attack_loop", "src/assets/enemy_melee_attack.h", "ENEMY_MELEE_ATTACK", scale=1, by_column=True, lods=3)
     convert_screen("graphics/startscreen.png", "src/screens/startscreen.h", "startscreen")
     convert_screen("graphics/controls/preset1.png", "src/screens/preset1.h", "preset1")
     convert_screen("graphics/controls/preset2.png", "src/screens/preset2.h", "preset2")
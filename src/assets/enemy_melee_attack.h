@@ -8,354 +8,340 @@
 #define ENEMY_MELEE_ATTACK_HEIGHT 128
 #define ENEMY_MELEE_ATTACK_TRANSPARENT_IDX 12
 
-typedef struct { int x, y, w, h; int offset; } enemy_melee_attack_frame_t;
+// level l of a frame is its WIDTH >> l by HEIGHT >> l version
+#define ENEMY_MELEE_ATTACK_LODS 3
 
-static const enemy_melee_attack_frame_t enemy_melee_attack_frame_info[2] = {
-  { 49, 38, 34, 79, 0 },
-  { 46, 48, 34, 79, 2686 },
+// spans: offset of the frame in enemy_melee_attack_spans, lines: index of its first column in enemy_melee_attack_lines
+typedef struct { int x, y, w, h; int spans, lines; } enemy_melee_attack_frame_t;
+
+static const enemy_melee_attack_frame_t enemy_melee_attack_frame_info[3][2] = {
+  {
+    { 49, 38, 34, 79, 0, 0 },
+    { 46, 48, 34, 79, 1840, 34 },
+  },
+  {
+    { 24, 19, 17, 39, 3532, 68 },
+    { 23, 24, 17, 39, 4025, 85 },
+  },
+  {
+    { 12, 10, 8, 18, 4483, 102 },
+    { 12, 12, 7, 19, 4610, 110 },
+  },
 };
 
 static const uint16_t enemy_melee_attack_palette[13] = {
 44631, 40143, 25617, 39826, 21261, 10697, 4421, 14595, 4230, 2115, 1, 0, 63519
 };
 
-static const uint8_t enemy_melee_attack_pixels[5372] = {
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 2, 2, 2, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  5, 4, 4, 8, 8, 8, 8, 8, 8, 6, 10, 10, 10, 12, 12, 12,
-  12, 10, 10, 2, 2, 2, 10, 10, 12, 12, 12, 12, 12, 8, 8, 5,
-  10, 8, 8, 8, 7, 7, 7, 7, 7, 7, 7, 8, 8, 6, 10, 5,
-  10, 10, 12, 10, 2, 2, 2, 2, 2, 10, 12, 12, 12, 12, 8, 10,
-  5, 5, 8, 7, 7, 7, 1, 1, 7, 1, 1, 7, 1, 7, 8, 8,
-  6, 4, 5, 5, 10, 10, 2, 2, 4, 2, 2, 10, 12, 12, 12, 8,
-  10, 5, 4, 8, 7, 1, 1, 7, 0, 1, 7, 0, 0, 6, 0, 1,
-  7, 7, 8, 8, 4, 5, 10, 10, 3, 3, 4, 4, 2, 10, 12, 12,
-  12, 8, 10, 5, 8, 7, 7, 0, 1, 6, 0, 1, 6, 0, 1, 6,
-  1, 0, 7, 7, 7, 8, 8, 4, 5, 10, 3, 4, 4, 4, 2, 2,
-  12, 12, 12, 8, 5, 5, 8, 7, 7, 0, 10, 6, 0, 10, 6, 10,
-  10, 6, 10, 0, 6, 1, 1, 7, 8, 4, 5, 10, 10, 4, 4, 4,
-  2, 2, 12, 12, 12, 8, 5, 4, 7, 7, 1, 6, 10, 6, 10, 10,
-  6, 10, 10, 6, 10, 10, 6, 1, 0, 7, 7, 8, 4, 5, 10, 4,
-  4, 4, 4, 2, 12, 12, 12, 8, 6, 4, 7, 1, 1, 6, 10, 6,
-  10, 10, 10, 9, 10, 9, 10, 10, 6, 10, 0, 7, 7, 8, 4, 5,
-  10, 4, 4, 4, 4, 2, 12, 12, 12, 8, 6, 4, 7, 0, 10, 6,
-  10, 10, 10, 9, 10, 9, 10, 9, 10, 10, 6, 10, 10, 10, 1, 8,
-  6, 5, 10, 4, 4, 4, 4, 2, 12, 12, 12, 8, 6, 8, 7, 7,
-  10, 10, 10, 10, 9, 9, 10, 9, 10, 9, 9, 10, 6, 10, 10, 10,
-  1, 8, 6, 10, 10, 4, 4, 4, 4, 2, 12, 12, 12, 10, 6, 8,
-  1, 1, 10, 10, 10, 10, 9, 9, 10, 9, 10, 9, 9, 9, 10, 9,
-  10, 10, 10, 8, 6, 10, 4, 4, 4, 4, 4, 2, 12, 12, 12, 10,
-  6, 8, 1, 8, 10, 10, 9, 10, 9, 9, 9, 9, 9, 9, 9, 9,
-  10, 9, 10, 10, 10, 8, 6, 10, 4, 4, 3, 3, 4, 2, 12, 12,
-  12, 10, 6, 6, 8, 8, 10, 9, 9, 10, 9, 9, 9, 9, 9, 9,
-  9, 9, 10, 9, 9, 9, 10, 8, 6, 10, 4, 4, 2, 2, 3, 10,
-  12, 12, 12, 10, 6, 6, 8, 8, 10, 10, 9, 10, 9, 9, 9, 9,
-  9, 10, 9, 9, 10, 9, 10, 10, 10, 8, 6, 10, 4, 4, 4, 2,
-  2, 10, 12, 12, 12, 12, 10, 6, 6, 10, 10, 10, 9, 10, 9, 9,
-  10, 9, 9, 10, 9, 9, 10, 9, 10, 10, 10, 7, 10, 10, 4, 4,
-  4, 6, 2, 10, 12, 12, 12, 12, 10, 6, 6, 10, 1, 10, 10, 10,
-  10, 9, 10, 9, 9, 10, 9, 10, 10, 10, 10, 10, 0, 7, 10, 10,
-  4, 3, 4, 6, 6, 10, 12, 12, 12, 12, 10, 10, 8, 1, 1, 10,
-  10, 6, 10, 10, 10, 9, 10, 10, 9, 10, 6, 10, 10, 1, 1, 6,
-  10, 2, 2, 2, 3, 3, 6, 10, 12, 12, 12, 12, 10, 10, 6, 7,
-  0, 10, 6, 6, 10, 10, 6, 9, 10, 10, 10, 10, 6, 1, 10, 7,
-  7, 10, 10, 8, 2, 2, 2, 3, 6, 10, 12, 12, 12, 12, 6, 10,
-  6, 8, 7, 7, 1, 6, 10, 10, 6, 10, 6, 10, 10, 10, 6, 0,
-  1, 7, 8, 10, 10, 8, 2, 8, 8, 2, 6, 10, 12, 12, 12, 10,
-  6, 10, 6, 4, 8, 7, 0, 6, 1, 10, 6, 10, 6, 10, 10, 1,
-  6, 0, 7, 8, 8, 10, 8, 4, 4, 10, 8, 8, 6, 10, 12, 12,
-  10, 6, 3, 8, 10, 6, 4, 8, 7, 7, 0, 1, 6, 1, 6, 10,
-  1, 0, 7, 7, 7, 8, 10, 10, 10, 4, 10, 10, 6, 8, 6, 10,
-  12, 12, 6, 3, 2, 2, 8, 10, 6, 4, 8, 7, 0, 1, 6, 0,
-  1, 6, 1, 1, 7, 7, 8, 4, 10, 10, 4, 4, 4, 4, 6, 6,
-  8, 10, 12, 10, 6, 3, 2, 2, 8, 10, 10, 6, 4, 8, 7, 7,
-  7, 0, 1, 7, 7, 7, 7, 8, 4, 6, 8, 4, 4, 3, 3, 3,
-  4, 6, 6, 10, 12, 10, 3, 2, 4, 2, 4, 8, 10, 10, 6, 4,
-  4, 8, 7, 7, 7, 7, 8, 8, 4, 6, 6, 10, 4, 4, 3, 2,
-  2, 2, 4, 10, 6, 10, 10, 8, 2, 4, 4, 2, 4, 4, 8, 10,
-  10, 6, 6, 4, 8, 8, 8, 8, 4, 4, 6, 6, 10, 10, 2, 2,
-  2, 2, 2, 2, 4, 10, 6, 10, 10, 8, 4, 4, 4, 2, 4, 4,
-  8, 4, 4, 10, 10, 10, 6, 6, 6, 6, 6, 10, 10, 10, 4, 4,
-  4, 4, 4, 2, 2, 4, 4, 4, 10, 10, 10, 8, 4, 4, 4, 4,
-  4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 4, 4,
-  4, 4, 4, 4, 4, 2, 2, 4, 4, 6, 10, 10, 10, 8, 4, 10,
-  4, 4, 4, 4, 4, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
-  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 4, 10, 12, 10, 8,
-  4, 10, 10, 4, 4, 4, 10, 10, 2, 4, 4, 4, 4, 4, 4, 4,
-  4, 4, 4, 2, 4, 4, 2, 4, 10, 4, 4, 10, 10, 4, 10, 12,
-  10, 2, 2, 10, 8, 4, 4, 4, 10, 4, 2, 4, 2, 4, 4, 4,
-  4, 10, 2, 4, 4, 2, 4, 4, 2, 4, 10, 4, 4, 10, 4, 2,
-  10, 12, 10, 2, 2, 6, 6, 8, 4, 4, 10, 2, 4, 4, 2, 4,
-  4, 4, 4, 10, 10, 2, 4, 4, 2, 4, 2, 4, 10, 4, 10, 10,
-  4, 2, 10, 12, 10, 2, 2, 4, 6, 8, 4, 10, 4, 2, 4, 2,
-  4, 2, 10, 10, 4, 4, 10, 4, 2, 4, 2, 4, 2, 10, 10, 4,
-  8, 4, 4, 2, 10, 12, 10, 10, 2, 4, 6, 6, 4, 10, 4, 2,
-  4, 2, 4, 2, 10, 4, 4, 4, 4, 10, 2, 4, 2, 4, 2, 10,
-  4, 10, 8, 4, 2, 2, 10, 12, 12, 10, 2, 4, 4, 6, 8, 10,
-  2, 4, 2, 4, 2, 10, 10, 4, 4, 4, 4, 10, 10, 2, 4, 2,
-  2, 10, 10, 8, 8, 4, 2, 2, 10, 12, 12, 10, 2, 2, 4, 4,
-  10, 10, 2, 4, 2, 4, 10, 10, 4, 4, 3, 4, 4, 6, 6, 10,
-  2, 2, 10, 0, 10, 8, 4, 4, 2, 2, 10, 12, 12, 10, 10, 2,
-  4, 10, 10, 0, 10, 2, 4, 10, 10, 8, 4, 2, 3, 3, 2, 4,
-  4, 8, 8, 10, 3, 3, 10, 8, 4, 4, 2, 10, 10, 12, 12, 10,
-  10, 2, 4, 10, 0, 3, 3, 10, 10, 10, 6, 6, 3, 2, 2, 2,
-  2, 2, 2, 6, 8, 10, 10, 10, 10, 4, 4, 2, 2, 10, 12, 12,
-  12, 10, 10, 2, 4, 10, 10, 10, 10, 10, 10, 10, 8, 4, 4, 2,
-  2, 4, 10, 8, 8, 6, 6, 8, 8, 8, 4, 4, 2, 2, 2, 10,
-  12, 12, 12, 10, 10, 2, 3, 4, 6, 6, 6, 6, 6, 10, 10, 10,
-  10, 10, 10, 10, 8, 8, 6, 6, 8, 6, 6, 4, 4, 3, 2, 2,
-  4, 10, 12, 12, 12, 12, 10, 2, 3, 4, 4, 4, 4, 6, 6, 8,
-  8, 10, 12, 12, 12, 10, 10, 10, 6, 10, 8, 6, 4, 4, 4, 3,
-  2, 2, 10, 10, 12, 12, 12, 12, 10, 2, 2, 4, 4, 4, 4, 4,
-  6, 8, 8, 10, 12, 12, 12, 12, 12, 10, 10, 10, 6, 6, 4, 4,
-  4, 3, 2, 4, 10, 12, 12, 12, 12, 12, 10, 8, 2, 3, 4, 4,
-  4, 4, 6, 10, 10, 12, 12, 12, 12, 12, 12, 10, 10, 6, 6, 4,
-  4, 4, 3, 2, 2, 10, 10, 12, 12, 12, 12, 12, 10, 8, 2, 3,
-  4, 2, 4, 4, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 10, 6,
-  6, 4, 4, 4, 3, 2, 2, 10, 12, 12, 12, 12, 12, 12, 12, 8,
-  10, 2, 3, 2, 4, 4, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 6, 4, 4, 4, 3, 2, 4, 10, 12, 12, 12, 12, 12, 12,
-  12, 8, 10, 2, 3, 2, 4, 4, 6, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 10, 8, 6, 4, 2, 4, 2, 4, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 8, 10, 2, 2, 2, 4, 4, 6, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 6, 4, 2, 4, 2, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 4, 2, 2, 4, 4, 6, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 4, 4, 2, 2, 4, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 4, 2, 4, 4, 10, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4, 4, 2, 2, 4, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 4, 4, 4, 4,
-  4, 8, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 4, 4, 2, 2,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 4, 4,
-  4, 4, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 4, 4,
-  2, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  6, 3, 4, 4, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6,
-  4, 4, 4, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 3, 3, 2, 4, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 4, 4, 2, 3, 3, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 2, 4, 4, 10, 4, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 4, 4, 2, 2, 2, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 4, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 10, 4, 6, 4, 8, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 6, 6, 4, 10, 10, 12,
-  12, 12, 12, 12, 12, 10, 10, 4, 6, 6, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 6, 4, 8, 10,
-  10, 12, 12, 12, 12, 12, 12, 10, 10, 10, 8, 6, 8, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 10, 8,
-  8, 10, 10, 12, 12, 12, 12, 12, 12, 10, 10, 8, 6, 6, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  4, 10, 6, 10, 10, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 6,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 8, 10, 8, 10, 10, 12, 12, 12, 12, 12, 12, 10, 8, 10,
-  8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 4, 10, 10, 8, 10, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 4, 10, 6, 10, 12, 12, 12, 12, 12,
-  12, 10, 8, 8, 6, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 10, 10, 12, 12, 12,
-  12, 12, 12, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 8, 10, 12,
-  12, 12, 12, 12, 12, 10, 8, 10, 6, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 10, 10,
-  10, 12, 12, 12, 12, 12, 12, 10, 8, 6, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  10, 10, 10, 12, 12, 12, 12, 12, 10, 10, 8, 6, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 8, 8, 10, 12, 12, 12, 12, 12, 10, 10, 6, 6, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 6, 8, 10, 12, 12, 12, 12, 12, 10, 10, 10, 10,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 10, 12, 12, 12, 12, 12, 10, 10,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 12, 12, 12, 12,
-  10, 10, 10, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 10, 12, 12,
-  12, 12, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10,
-  12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  10, 10, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 10, 10, 12, 12, 12, 10, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 10, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 10, 10, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 4, 4, 10, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 2, 2, 4,
-  4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 4, 2,
-  2, 2, 2, 2, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6,
-  6, 4, 4, 4, 2, 2, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  6, 6, 4, 4, 4, 4, 4, 4, 6, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 6, 4, 4, 4, 4, 2, 2, 4, 6, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 6, 6, 4, 4, 4, 4, 4, 2, 2, 6, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 6, 2, 2, 2, 2, 4, 4, 6, 2, 6, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 6, 6, 6, 6, 4, 2, 2, 4, 4, 6,
-  8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 6, 8, 8, 4, 4, 4, 4, 4,
-  4, 4, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 6, 8, 4, 2, 2, 4,
-  4, 8, 2, 4, 8, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 5, 5, 10, 10, 6, 4, 2, 2,
-  8, 4, 6, 8, 2, 2, 10, 8, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 8, 5, 5, 6, 5, 8, 8, 10, 10, 6,
-  6, 8, 8, 4, 6, 6, 4, 2, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 8, 8, 8, 10, 10, 10, 10, 10, 10, 8,
-  8, 10, 10, 10, 8, 8, 4, 6, 8, 8, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 10, 10, 10, 6, 5, 8, 8, 8, 8, 8,
-  10, 10, 10, 8, 10, 10, 10, 8, 8, 4, 6, 8, 10, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 8, 8, 5, 5, 5, 6, 6, 6, 6, 6,
-  6, 6, 6, 6, 6, 10, 5, 5, 10, 10, 10, 8, 8, 6, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 8, 5, 5, 5, 4, 4, 4, 2, 2,
-  2, 2, 4, 2, 2, 4, 6, 6, 6, 10, 5, 5, 10, 10, 8, 6,
-  10, 12, 12, 12, 12, 12, 10, 10, 6, 5, 4, 4, 8, 8, 8, 8,
-  8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 6, 6, 10, 5, 10,
-  10, 8, 10, 12, 12, 12, 12, 10, 10, 5, 6, 8, 8, 8, 8, 8,
-  8, 8, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8,
-  6, 6, 10, 10, 10, 12, 12, 12, 10, 5, 5, 6, 10, 8, 8, 7,
-  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8,
-  8, 8, 8, 6, 6, 10, 10, 12, 12, 10, 10, 5, 6, 10, 8, 7,
-  1, 1, 7, 1, 1, 7, 7, 1, 7, 7, 1, 7, 1, 7, 7, 1,
-  7, 7, 7, 7, 8, 8, 10, 6, 10, 10, 10, 10, 5, 6, 10, 8,
-  10, 7, 1, 7, 7, 1, 0, 7, 1, 0, 7, 1, 0, 7, 0, 1,
-  7, 1, 7, 7, 1, 1, 7, 7, 8, 10, 8, 10, 10, 10, 5, 10,
-  8, 8, 7, 1, 10, 10, 10, 10, 1, 7, 1, 0, 7, 1, 0, 7,
-  0, 1, 7, 0, 1, 7, 1, 10, 10, 1, 7, 10, 8, 5, 12, 10,
-  5, 6, 10, 8, 7, 7, 1, 7, 1, 1, 10, 10, 10, 10, 10, 10,
-  10, 10, 10, 10, 10, 10, 10, 10, 10, 7, 1, 7, 7, 10, 8, 5,
-  12, 10, 5, 6, 6, 4, 8, 7, 7, 7, 1, 7, 7, 0, 1, 7,
-  1, 0, 7, 0, 1, 7, 1, 0, 7, 1, 1, 7, 7, 7, 10, 8,
-  5, 10, 12, 10, 10, 5, 6, 6, 4, 8, 8, 7, 7, 7, 7, 1,
-  7, 7, 7, 1, 7, 1, 7, 7, 7, 1, 7, 7, 7, 7, 8, 8,
-  4, 6, 5, 10, 12, 12, 8, 8, 5, 6, 6, 4, 4, 8, 8, 8,
-  8, 8, 8, 8, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8,
-  8, 4, 6, 5, 10, 10, 12, 12, 10, 8, 8, 5, 5, 6, 6, 6,
-  4, 4, 2, 2, 2, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4,
-  4, 4, 4, 6, 5, 8, 10, 12, 12, 12, 12, 10, 8, 8, 10, 10,
-  5, 5, 6, 6, 6, 6, 6, 4, 4, 2, 2, 2, 4, 4, 4, 6,
-  6, 6, 6, 5, 10, 8, 10, 10, 12, 12, 12, 12, 12, 12, 10, 10,
-  8, 8, 10, 10, 8, 5, 5, 5, 5, 6, 6, 6, 6, 6, 6, 6,
-  6, 5, 5, 5, 5, 8, 10, 6, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 10, 6, 8, 10, 10, 10, 10, 10, 10, 8, 8, 8, 8, 8,
-  8, 8, 8, 8, 10, 10, 10, 10, 6, 6, 6, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 6, 8, 8, 8, 6, 6, 8, 10, 10, 10,
-  10, 10, 10, 10, 10, 10, 8, 6, 6, 6, 6, 10, 8, 10, 10, 12,
-  12, 12, 12, 12, 12, 10, 8, 8, 4, 4, 4, 4, 4, 6, 6, 8,
-  6, 6, 6, 6, 6, 6, 6, 8, 6, 6, 8, 4, 4, 10, 8, 10,
-  10, 12, 12, 12, 12, 12, 12, 10, 8, 4, 4, 4, 4, 4, 4, 4,
-  6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10,
-  8, 10, 10, 12, 12, 12, 12, 12, 10, 6, 6, 10, 2, 4, 4, 2,
-  4, 4, 6, 6, 10, 10, 4, 4, 10, 10, 2, 4, 4, 2, 4, 2,
-  10, 10, 8, 10, 10, 12, 12, 12, 12, 12, 10, 6, 10, 10, 2, 4,
-  4, 2, 4, 4, 2, 10, 6, 6, 6, 6, 6, 10, 10, 2, 4, 2,
-  4, 2, 10, 4, 4, 10, 12, 12, 12, 12, 12, 12, 10, 8, 8, 10,
-  2, 4, 2, 4, 4, 2, 10, 10, 6, 10, 10, 10, 10, 6, 10, 10,
-  2, 4, 2, 2, 10, 10, 4, 10, 12, 12, 12, 12, 12, 12, 10, 4,
-  10, 2, 4, 4, 2, 4, 2, 10, 6, 6, 8, 8, 8, 8, 8, 8,
-  6, 10, 2, 4, 2, 4, 2, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  10, 4, 10, 2, 4, 2, 4, 2, 10, 6, 6, 4, 4, 4, 4, 4,
-  4, 4, 8, 6, 10, 2, 4, 2, 4, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 10, 4, 10, 2, 2, 4, 2, 10, 8, 4, 4, 4, 4, 2,
-  2, 2, 4, 4, 8, 6, 6, 10, 2, 2, 10, 10, 0, 10, 12, 12,
-  12, 12, 12, 12, 10, 10, 0, 10, 2, 4, 2, 10, 8, 6, 4, 2,
-  2, 2, 2, 2, 2, 2, 4, 4, 6, 10, 10, 10, 10, 3, 3, 10,
-  12, 12, 12, 12, 12, 12, 10, 0, 3, 3, 10, 10, 10, 8, 6, 6,
-  4, 4, 2, 2, 2, 2, 2, 4, 4, 6, 6, 10, 10, 6, 6, 6,
-  10, 10, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 6, 6, 10,
-  10, 10, 6, 4, 4, 4, 4, 4, 4, 6, 6, 6, 10, 10, 6, 6,
-  6, 6, 8, 10, 12, 12, 12, 12, 12, 12, 10, 10, 6, 6, 6, 6,
-  6, 6, 6, 8, 10, 10, 10, 10, 10, 10, 10, 10, 10, 8, 10, 6,
-  6, 4, 4, 4, 8, 10, 12, 12, 12, 12, 12, 12, 10, 10, 4, 4,
-  4, 4, 4, 6, 6, 8, 8, 8, 8, 8, 8, 8, 8, 10, 8, 8,
-  6, 6, 4, 4, 4, 4, 8, 8, 12, 12, 12, 12, 12, 12, 10, 4,
-  4, 2, 2, 4, 4, 6, 6, 8, 8, 8, 12, 12, 12, 12, 12, 10,
-  8, 6, 6, 4, 4, 4, 4, 4, 4, 8, 12, 12, 12, 12, 12, 12,
-  10, 4, 2, 2, 2, 4, 4, 4, 6, 8, 8, 12, 12, 12, 12, 12,
-  12, 10, 10, 6, 6, 4, 4, 4, 2, 2, 4, 8, 10, 12, 12, 12,
-  12, 10, 4, 2, 2, 2, 2, 4, 4, 4, 6, 8, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 6, 2, 4, 4, 2, 2, 2, 4, 10, 12,
-  12, 12, 12, 10, 4, 2, 2, 2, 2, 4, 4, 6, 6, 8, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 6, 6, 2, 2, 2, 2, 2, 4,
-  10, 12, 12, 12, 12, 10, 4, 2, 2, 2, 4, 4, 6, 6, 8, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 6, 2, 2, 2,
-  2, 2, 10, 12, 12, 12, 12, 10, 4, 2, 2, 2, 4, 4, 6, 10,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 4, 4,
-  4, 2, 2, 2, 10, 10, 12, 12, 10, 10, 4, 2, 2, 4, 4, 4,
-  6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6,
-  6, 4, 4, 2, 2, 2, 4, 10, 12, 12, 10, 4, 2, 2, 2, 4,
-  4, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 6, 4, 4, 4, 2, 2, 4, 10, 12, 12, 10, 4, 2, 2,
-  2, 4, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 4, 4, 4, 2, 4, 10, 12, 12, 10, 4,
-  4, 4, 4, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 4, 4, 4, 6, 6, 6, 12, 12,
-  10, 6, 6, 6, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 4, 4, 2, 2, 2,
-  12, 12, 10, 2, 2, 2, 2, 4, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 4, 4,
-  2, 2, 12, 12, 10, 2, 2, 2, 4, 4, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6,
-  6, 4, 4, 4, 12, 12, 10, 6, 4, 4, 4, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  4, 10, 6, 6, 6, 6, 12, 12, 10, 6, 6, 6, 6, 10, 10, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 4, 4, 8, 8, 8, 10, 12, 12, 12, 10, 6, 6, 6, 4,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 4, 6, 4, 6, 8, 10, 12, 12, 12, 10, 8, 6,
-  6, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 6, 6, 6, 4, 8, 10, 12, 12, 12, 10,
-  10, 6, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 6, 4, 8, 10, 10, 10, 12, 12,
-  12, 12, 10, 10, 6, 4, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 6, 6, 8, 10, 12,
-  12, 12, 12, 12, 10, 6, 6, 4, 8, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 8, 10, 8,
-  10, 12, 12, 12, 12, 12, 12, 10, 8, 6, 6, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 6, 8,
-  10, 8, 10, 12, 12, 12, 12, 12, 12, 10, 8, 8, 4, 4, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4,
-  8, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 10, 6, 10, 6,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 4, 10, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  10, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 6, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 8, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 8, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12,
+// start of each column in enemy_melee_attack_spans, relative to its frame
+static const uint16_t enemy_melee_attack_lines[117] = {
+  0, 12, 32, 58, 101, 153, 209, 268, 331, 400, 472, 549, 628, 702, 757, 800,
+  843, 886, 936, 994, 1063, 1139, 1212, 1282, 1348, 1410, 1468, 1522, 1574, 1625, 1676, 1724,
+  1769, 1810, 0, 5, 14, 37, 69, 118, 173, 230, 289, 351, 414, 472, 527, 577,
+  622, 660, 698, 735, 773, 811, 849, 887, 929, 973, 1021, 1073, 1136, 1208, 1291, 1372,
+  1450, 1525, 1598, 1658, 0, 7, 20, 46, 76, 111, 150, 191, 220, 243, 274, 318,
+  355, 388, 418, 445, 471, 0, 5, 21, 49, 79, 112, 144, 169, 190, 210, 230,
+  252, 277, 309, 352, 393, 431, 0, 6, 21, 41, 61, 74, 95, 112, 0, 16,
+  33, 49, 61, 73, 88,
+};
+
+// per column: span count, then { skip, run, run indices } for each span
+static const uint8_t enemy_melee_attack_spans[4720] = {
+  1, 27, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 25, 17, 10,
+  10, 8, 8, 8, 8, 8, 2, 2, 2, 10, 10, 10, 10, 10, 10, 10,
+  1, 23, 23, 10, 6, 6, 3, 2, 4, 4, 4, 4, 2, 2, 2, 2,
+  2, 2, 10, 10, 10, 10, 10, 10, 10, 10, 2, 6, 11, 8, 8, 8,
+  8, 8, 8, 8, 10, 10, 10, 10, 5, 27, 10, 6, 3, 3, 2, 4,
+  4, 4, 10, 10, 10, 6, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2,
+  8, 8, 8, 8, 8, 1, 5, 49, 8, 10, 10, 5, 5, 6, 6, 6,
+  6, 6, 6, 6, 10, 10, 10, 10, 6, 6, 3, 2, 2, 4, 4, 4,
+  4, 4, 10, 8, 6, 6, 6, 4, 4, 4, 4, 4, 3, 3, 2, 2,
+  2, 10, 10, 10, 10, 10, 10, 10, 10, 1, 4, 53, 8, 10, 5, 5,
+  5, 4, 4, 4, 8, 8, 8, 6, 6, 6, 6, 10, 10, 10, 10, 8,
+  2, 2, 2, 2, 2, 4, 4, 4, 4, 8, 8, 6, 6, 4, 10, 10,
+  10, 4, 4, 4, 3, 3, 2, 2, 2, 4, 4, 4, 4, 10, 10, 10,
+  10, 1, 4, 56, 8, 5, 4, 8, 8, 7, 7, 7, 7, 1, 1, 8,
+  8, 6, 6, 8, 6, 6, 6, 10, 8, 8, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 8, 10, 10, 0, 10, 6, 4, 4, 4, 4, 3, 3,
+  2, 2, 4, 4, 4, 6, 3, 2, 10, 6, 10, 10, 1, 4, 60, 5,
+  5, 8, 7, 7, 7, 1, 0, 7, 1, 8, 8, 8, 10, 10, 1, 7,
+  8, 4, 6, 10, 10, 8, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10,
+  10, 0, 3, 10, 6, 4, 4, 4, 2, 2, 2, 2, 2, 2, 4, 4,
+  3, 3, 4, 10, 6, 6, 4, 10, 10, 10, 10, 1, 3, 66, 10, 10,
+  8, 7, 7, 7, 1, 1, 10, 10, 10, 10, 10, 10, 10, 1, 1, 0,
+  7, 8, 4, 6, 10, 10, 8, 8, 4, 4, 10, 10, 10, 4, 4, 2,
+  2, 10, 3, 10, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 2, 4, 10, 6, 6, 10, 4, 8, 4, 10, 10, 10, 10, 10, 10,
+  1, 3, 69, 10, 8, 7, 1, 0, 0, 6, 6, 6, 10, 10, 10, 9,
+  10, 10, 10, 10, 10, 7, 7, 8, 4, 6, 10, 10, 4, 4, 10, 10,
+  4, 2, 2, 2, 4, 4, 2, 10, 10, 6, 6, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 10, 10, 6, 4, 8, 10, 10, 10, 4,
+  10, 10, 4, 10, 10, 10, 10, 10, 1, 2, 74, 10, 5, 8, 7, 1,
+  1, 10, 10, 10, 10, 10, 10, 9, 9, 9, 9, 10, 10, 6, 1, 0,
+  7, 8, 4, 6, 10, 4, 4, 4, 2, 2, 4, 4, 4, 2, 2, 4,
+  10, 10, 6, 6, 6, 6, 6, 6, 6, 6, 6, 10, 4, 4, 4, 4,
+  4, 4, 4, 8, 8, 6, 8, 10, 10, 8, 10, 10, 10, 8, 6, 10,
+  10, 10, 10, 10, 10, 1, 2, 76, 10, 4, 8, 7, 7, 6, 6, 6,
+  6, 10, 10, 10, 10, 10, 10, 10, 10, 6, 6, 6, 6, 7, 7, 8,
+  4, 6, 10, 4, 4, 4, 4, 4, 2, 2, 4, 4, 10, 10, 10, 10,
+  8, 8, 10, 10, 10, 10, 10, 10, 10, 8, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 8, 6, 10, 8, 10, 10, 8, 8, 10, 10, 10, 10,
+  10, 10, 10, 10, 2, 2, 46, 10, 4, 7, 1, 0, 0, 0, 10, 10,
+  10, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 1, 0, 0, 7, 4,
+  6, 10, 4, 4, 4, 2, 2, 4, 4, 2, 10, 10, 6, 8, 10, 8,
+  8, 10, 10, 10, 10, 8, 23, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 8, 10, 10, 10, 10, 10, 10, 2, 2,
+  42, 10, 8, 7, 1, 1, 1, 10, 10, 10, 9, 9, 9, 9, 9, 9,
+  9, 9, 10, 10, 10, 10, 1, 1, 7, 8, 4, 10, 10, 4, 4, 4,
+  4, 2, 2, 10, 10, 8, 6, 4, 10, 10, 10, 27, 8, 10, 10, 10,
+  10, 10, 10, 10, 10, 1, 2, 40, 10, 8, 7, 7, 7, 6, 6, 6,
+  10, 10, 10, 10, 9, 9, 9, 10, 10, 10, 6, 6, 6, 6, 6, 7,
+  7, 8, 6, 10, 4, 4, 4, 4, 10, 10, 10, 4, 4, 3, 4, 10,
+  1, 2, 40, 10, 8, 7, 1, 0, 0, 10, 10, 9, 9, 9, 9, 9,
+  9, 9, 9, 9, 9, 9, 10, 10, 1, 0, 0, 7, 8, 6, 10, 4,
+  4, 4, 4, 10, 4, 4, 4, 2, 2, 2, 10, 1, 2, 40, 10, 8,
+  7, 1, 0, 1, 10, 10, 10, 10, 10, 10, 9, 9, 9, 9, 9, 10,
+  10, 6, 6, 6, 1, 1, 7, 8, 6, 10, 4, 4, 4, 4, 4, 4,
+  4, 3, 3, 2, 2, 10, 2, 2, 41, 10, 8, 7, 7, 6, 6, 6,
+  6, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 6,
+  7, 7, 8, 6, 10, 4, 4, 10, 10, 4, 4, 4, 4, 3, 2, 4,
+  10, 10, 32, 4, 10, 10, 10, 10, 2, 2, 41, 10, 8, 7, 1, 0,
+  1, 10, 10, 10, 10, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10,
+  1, 1, 7, 8, 4, 6, 10, 4, 4, 2, 10, 10, 4, 4, 4, 2,
+  2, 10, 8, 10, 24, 12, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 2, 2, 43, 10, 6, 8, 7, 1, 0, 0, 10, 10, 10, 10,
+  9, 9, 9, 9, 9, 10, 10, 10, 10, 1, 0, 1, 7, 8, 4, 10,
+  10, 4, 4, 4, 2, 4, 10, 10, 6, 4, 2, 8, 8, 10, 10, 10,
+  12, 21, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 1, 3, 73, 10, 8, 8, 7, 7, 6,
+  6, 6, 6, 6, 10, 10, 10, 10, 10, 10, 6, 6, 6, 6, 7, 7,
+  7, 4, 6, 10, 4, 4, 4, 4, 4, 2, 2, 10, 6, 4, 2, 8,
+  6, 6, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 8, 10, 8, 10, 8, 8, 8, 6, 10, 10, 10, 10,
+  10, 10, 10, 1, 3, 70, 10, 6, 8, 7, 7, 1, 1, 10, 10, 10,
+  9, 9, 9, 9, 9, 10, 10, 1, 0, 0, 7, 7, 8, 6, 6, 10,
+  4, 4, 2, 2, 4, 4, 4, 2, 10, 8, 6, 6, 6, 10, 10, 6,
+  6, 8, 8, 8, 8, 8, 6, 6, 6, 4, 4, 4, 4, 10, 8, 10,
+  10, 10, 8, 10, 10, 6, 6, 6, 10, 10, 8, 10, 1, 3, 67, 10,
+  10, 6, 8, 7, 1, 0, 0, 10, 10, 10, 10, 9, 10, 10, 10, 10,
+  10, 1, 7, 7, 8, 4, 6, 10, 4, 4, 4, 4, 4, 2, 2, 2,
+  4, 2, 8, 8, 6, 8, 8, 6, 6, 6, 6, 6, 6, 4, 4, 4,
+  4, 4, 4, 4, 6, 6, 8, 6, 10, 8, 8, 6, 10, 6, 10, 10,
+  10, 10, 1, 4, 63, 5, 4, 8, 8, 7, 7, 7, 10, 10, 10, 10,
+  9, 10, 10, 10, 1, 7, 7, 8, 8, 4, 6, 10, 10, 4, 4, 4,
+  4, 4, 4, 4, 4, 2, 2, 10, 10, 8, 6, 6, 6, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 2, 2, 4, 6, 6, 6, 6, 10, 8,
+  8, 10, 10, 10, 1, 4, 59, 10, 5, 4, 8, 8, 7, 7, 1, 1,
+  10, 10, 10, 10, 10, 0, 1, 7, 8, 8, 10, 10, 8, 4, 2, 4,
+  4, 4, 2, 2, 2, 2, 2, 2, 10, 3, 10, 8, 6, 4, 4, 4,
+  4, 4, 2, 2, 2, 2, 2, 2, 4, 3, 2, 8, 8, 8, 10, 10,
+  10, 10, 1, 4, 55, 10, 5, 5, 4, 4, 8, 8, 8, 8, 8, 8,
+  8, 8, 7, 7, 6, 10, 10, 10, 10, 10, 4, 4, 2, 4, 4, 4,
+  4, 4, 4, 10, 10, 10, 0, 3, 10, 8, 4, 4, 4, 4, 4, 4,
+  4, 4, 2, 2, 2, 4, 4, 3, 2, 10, 10, 10, 1, 5, 51, 10,
+  10, 5, 5, 4, 4, 6, 6, 6, 6, 6, 6, 10, 10, 10, 10, 10,
+  8, 10, 4, 4, 3, 2, 4, 4, 4, 10, 10, 10, 10, 4, 10, 10,
+  10, 10, 4, 4, 4, 4, 3, 3, 3, 2, 2, 4, 4, 10, 10, 10,
+  10, 10, 1, 3, 49, 10, 10, 10, 10, 10, 10, 5, 5, 5, 10, 10,
+  10, 10, 10, 10, 10, 2, 8, 8, 4, 4, 4, 3, 2, 2, 2, 2,
+  4, 4, 4, 4, 4, 10, 8, 8, 8, 4, 4, 3, 3, 3, 2, 2,
+  2, 4, 10, 10, 10, 10, 1, 1, 48, 10, 10, 10, 2, 2, 3, 3,
+  10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 2, 2, 2, 4, 10,
+  4, 3, 2, 2, 2, 2, 4, 4, 4, 10, 8, 8, 8, 4, 4, 4,
+  2, 2, 2, 2, 2, 2, 4, 10, 10, 1, 0, 48, 10, 10, 2, 2,
+  2, 2, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 2,
+  2, 8, 10, 10, 4, 3, 2, 2, 4, 4, 4, 10, 10, 10, 4, 4,
+  4, 4, 4, 2, 2, 2, 2, 4, 10, 10, 10, 10, 1, 0, 45, 10,
+  10, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 2, 4,
+  4, 4, 3, 2, 8, 8, 6, 6, 4, 4, 4, 4, 4, 10, 10, 4,
+  4, 4, 2, 2, 2, 2, 2, 2, 4, 10, 10, 10, 1, 1, 42, 10,
+  2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 3, 2, 2, 6,
+  6, 3, 3, 2, 8, 8, 6, 6, 10, 10, 4, 6, 4, 4, 2, 2,
+  2, 2, 2, 2, 10, 10, 10, 10, 10, 1, 1, 38, 10, 10, 10, 2,
+  2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 3, 2, 2, 6, 6, 6,
+  6, 6, 6, 8, 6, 6, 6, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 1, 3, 27, 10, 10, 10, 10, 2, 2, 2, 2, 2, 2, 2,
+  2, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  1, 22, 2, 10, 10, 1, 21, 6, 10, 10, 10, 10, 10, 10, 2, 20,
+  9, 10, 10, 5, 5, 5, 5, 10, 8, 10, 23, 9, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 2, 19, 11, 10, 5, 5, 6, 10, 6, 6, 5,
+  8, 8, 10, 18, 16, 10, 10, 10, 10, 10, 4, 4, 4, 6, 2, 2,
+  6, 6, 10, 10, 10, 2, 18, 13, 10, 10, 5, 6, 10, 8, 10, 6,
+  6, 5, 8, 8, 10, 4, 31, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 4, 4, 4, 4, 4, 2, 2, 4, 6, 2, 2, 4,
+  6, 6, 8, 10, 10, 10, 2, 17, 15, 10, 10, 5, 6, 10, 8, 8,
+  8, 4, 6, 6, 5, 8, 10, 10, 1, 35, 10, 10, 6, 6, 8, 4,
+  4, 4, 10, 0, 10, 10, 10, 4, 4, 2, 2, 2, 2, 2, 2, 2,
+  4, 6, 2, 2, 4, 6, 6, 6, 6, 10, 6, 10, 10, 1, 16, 54,
+  10, 10, 6, 6, 10, 8, 10, 7, 7, 8, 4, 6, 5, 10, 8, 10,
+  10, 8, 8, 6, 10, 8, 10, 10, 10, 0, 3, 10, 6, 4, 4, 2,
+  2, 2, 2, 2, 2, 2, 2, 4, 4, 2, 4, 4, 6, 6, 6, 4,
+  6, 6, 8, 8, 10, 10, 1, 16, 56, 10, 8, 5, 8, 8, 7, 7,
+  1, 7, 7, 8, 4, 6, 10, 8, 6, 10, 8, 4, 10, 10, 10, 2,
+  2, 2, 10, 3, 10, 6, 4, 2, 2, 2, 2, 2, 2, 4, 4, 4,
+  4, 4, 4, 4, 10, 10, 4, 4, 4, 4, 4, 6, 8, 6, 10, 10,
+  10, 1, 15, 59, 10, 8, 5, 4, 8, 8, 1, 1, 10, 1, 7, 8,
+  4, 6, 5, 10, 8, 6, 4, 4, 2, 2, 2, 4, 4, 2, 2, 10,
+  10, 6, 4, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 10, 10, 10,
+  10, 10, 10, 10, 10, 4, 8, 6, 4, 10, 10, 8, 10, 10, 10, 2,
+  15, 42, 10, 8, 5, 4, 8, 7, 1, 7, 10, 7, 7, 7, 8, 6,
+  5, 10, 10, 8, 4, 4, 4, 4, 4, 4, 2, 4, 4, 10, 6, 6,
+  4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 10, 10, 3, 16, 10, 10,
+  10, 10, 10, 10, 10, 4, 6, 8, 6, 10, 10, 10, 10, 10, 2, 15,
+  41, 10, 5, 5, 8, 8, 7, 7, 7, 10, 1, 1, 7, 8, 4, 6,
+  8, 10, 8, 4, 4, 4, 4, 2, 2, 4, 2, 2, 10, 6, 6, 4,
+  4, 4, 4, 4, 6, 6, 6, 10, 10, 10, 9, 12, 10, 10, 10, 10,
+  10, 8, 10, 10, 10, 10, 10, 10, 2, 15, 39, 10, 5, 4, 8, 8,
+  7, 1, 1, 10, 1, 7, 7, 8, 4, 6, 5, 10, 8, 4, 4, 2,
+  2, 4, 4, 2, 10, 10, 8, 10, 6, 6, 6, 4, 4, 6, 6, 10,
+  10, 10, 14, 11, 10, 10, 10, 10, 10, 8, 10, 10, 10, 10, 10, 2,
+  14, 38, 8, 10, 5, 4, 8, 8, 7, 1, 0, 1, 10, 7, 7, 8,
+  2, 6, 5, 10, 6, 4, 4, 4, 4, 4, 2, 10, 8, 8, 6, 10,
+  6, 6, 6, 6, 6, 6, 8, 10, 20, 7, 10, 10, 10, 10, 10, 10,
+  10, 2, 14, 36, 8, 6, 6, 4, 8, 8, 7, 7, 7, 7, 10, 0,
+  1, 8, 2, 6, 5, 10, 6, 6, 4, 4, 4, 2, 10, 6, 4, 6,
+  6, 10, 8, 8, 8, 8, 8, 8, 25, 4, 10, 10, 10, 10, 1, 13,
+  35, 8, 8, 5, 6, 2, 8, 7, 7, 7, 1, 1, 10, 1, 7, 8,
+  2, 6, 5, 10, 8, 6, 6, 6, 2, 10, 6, 6, 4, 4, 4, 6,
+  10, 8, 8, 8, 1, 12, 35, 10, 5, 10, 8, 6, 2, 8, 7, 7,
+  1, 0, 0, 10, 7, 7, 8, 8, 4, 6, 8, 10, 8, 6, 6, 10,
+  10, 6, 4, 4, 2, 4, 4, 10, 8, 8, 1, 12, 34, 10, 5, 10,
+  8, 6, 2, 8, 7, 7, 7, 7, 7, 10, 1, 7, 7, 8, 4, 6,
+  8, 10, 6, 4, 10, 6, 6, 8, 4, 4, 2, 2, 4, 10, 8, 1,
+  11, 35, 10, 10, 6, 10, 8, 6, 2, 8, 7, 7, 7, 1, 1, 10,
+  0, 1, 7, 8, 2, 6, 8, 10, 6, 4, 10, 6, 10, 8, 4, 2,
+  2, 2, 4, 10, 8, 1, 11, 35, 10, 5, 5, 10, 8, 6, 4, 8,
+  7, 7, 1, 0, 0, 10, 7, 7, 7, 8, 2, 6, 8, 10, 6, 4,
+  4, 6, 10, 8, 4, 2, 2, 2, 4, 10, 8, 1, 11, 35, 10, 5,
+  8, 10, 8, 6, 2, 8, 7, 7, 7, 7, 7, 10, 0, 1, 7, 8,
+  2, 6, 8, 10, 6, 4, 4, 6, 10, 8, 4, 2, 2, 2, 4, 10,
+  8, 1, 11, 35, 10, 10, 8, 10, 10, 6, 2, 8, 7, 7, 1, 0,
+  0, 10, 1, 7, 7, 8, 4, 6, 8, 10, 6, 4, 10, 6, 10, 8,
+  4, 4, 2, 2, 4, 10, 8, 1, 9, 39, 10, 10, 10, 10, 10, 8,
+  10, 6, 4, 8, 7, 7, 7, 1, 1, 10, 7, 7, 7, 8, 4, 6,
+  8, 10, 6, 4, 10, 10, 6, 8, 4, 4, 2, 4, 6, 10, 10, 10,
+  10, 1, 7, 41, 10, 10, 6, 6, 6, 6, 10, 8, 10, 6, 6, 8,
+  8, 7, 7, 7, 7, 10, 1, 7, 7, 8, 4, 6, 8, 10, 6, 4,
+  2, 10, 10, 6, 8, 8, 4, 4, 6, 10, 8, 8, 10, 1, 5, 45,
+  10, 10, 6, 6, 6, 8, 8, 4, 6, 10, 8, 10, 6, 4, 8, 7,
+  1, 1, 0, 10, 0, 1, 8, 8, 6, 5, 8, 10, 8, 4, 4, 2,
+  10, 10, 6, 6, 4, 6, 6, 8, 8, 6, 6, 10, 10, 1, 3, 49,
+  10, 10, 6, 6, 6, 2, 6, 8, 4, 2, 6, 10, 10, 5, 6, 4,
+  8, 7, 7, 7, 1, 10, 7, 7, 8, 4, 6, 5, 10, 8, 6, 4,
+  4, 4, 2, 2, 10, 6, 6, 6, 10, 10, 6, 6, 6, 6, 6, 10,
+  10, 2, 2, 52, 10, 10, 6, 6, 4, 4, 2, 6, 4, 2, 2, 8,
+  10, 10, 5, 10, 6, 8, 8, 7, 7, 7, 10, 1, 7, 8, 4, 6,
+  5, 10, 6, 6, 4, 2, 2, 4, 4, 2, 10, 10, 10, 10, 6, 6,
+  4, 4, 2, 6, 6, 6, 6, 10, 19, 6, 10, 10, 10, 10, 10, 10,
+  2, 1, 54, 10, 10, 4, 6, 4, 4, 4, 2, 4, 4, 2, 8, 8,
+  8, 10, 10, 5, 6, 8, 8, 7, 1, 1, 10, 1, 7, 8, 4, 6,
+  5, 10, 6, 8, 4, 4, 4, 2, 2, 4, 2, 10, 10, 6, 6, 4,
+  4, 4, 4, 2, 6, 4, 6, 6, 10, 11, 13, 10, 10, 10, 6, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 2, 0, 58, 10, 10, 2, 2, 4,
+  4, 4, 4, 2, 2, 4, 4, 4, 4, 8, 8, 10, 5, 10, 8, 8,
+  7, 1, 10, 7, 7, 7, 8, 4, 5, 8, 10, 6, 4, 4, 2, 2,
+  2, 4, 2, 2, 10, 6, 6, 4, 4, 4, 4, 4, 2, 2, 4, 4,
+  4, 10, 10, 10, 10, 1, 20, 10, 10, 10, 10, 10, 10, 10, 10, 4,
+  4, 10, 8, 10, 10, 10, 10, 10, 10, 10, 10, 1, 0, 78, 10, 4,
+  2, 2, 4, 4, 4, 4, 4, 2, 4, 4, 6, 6, 4, 8, 10, 10,
+  5, 6, 8, 8, 7, 10, 1, 7, 8, 8, 4, 10, 10, 6, 6, 4,
+  4, 10, 10, 10, 2, 4, 10, 10, 6, 6, 4, 4, 4, 2, 2, 2,
+  2, 4, 4, 4, 4, 4, 10, 10, 10, 4, 4, 4, 6, 6, 6, 4,
+  6, 8, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 0, 75, 10,
+  4, 4, 2, 4, 4, 2, 4, 4, 4, 4, 8, 8, 6, 6, 4, 8,
+  10, 10, 6, 6, 8, 7, 1, 7, 7, 8, 4, 6, 8, 6, 6, 10,
+  10, 10, 10, 4, 10, 10, 10, 10, 3, 6, 6, 4, 4, 4, 2, 2,
+  2, 2, 2, 2, 4, 4, 4, 4, 10, 6, 10, 4, 6, 6, 4, 6,
+  8, 8, 10, 8, 10, 10, 10, 10, 10, 10, 1, 1, 72, 10, 4, 2,
+  2, 4, 2, 2, 6, 4, 4, 2, 2, 4, 8, 6, 8, 8, 10, 10,
+  6, 10, 8, 7, 7, 10, 4, 6, 5, 10, 10, 6, 8, 8, 8, 8,
+  4, 4, 10, 10, 0, 3, 10, 8, 8, 8, 4, 4, 2, 2, 2, 2,
+  2, 2, 4, 4, 4, 4, 6, 6, 8, 4, 6, 8, 6, 10, 10, 10,
+  10, 10, 10, 10, 10, 3, 1, 29, 10, 10, 2, 2, 4, 4, 2, 2,
+  6, 4, 4, 2, 2, 8, 8, 6, 6, 8, 10, 10, 6, 10, 10, 10,
+  8, 6, 5, 8, 10, 1, 7, 10, 10, 10, 10, 10, 10, 10, 2, 30,
+  10, 10, 10, 10, 10, 8, 8, 8, 4, 4, 2, 2, 2, 2, 2, 6,
+  2, 4, 4, 6, 8, 6, 4, 10, 8, 8, 8, 10, 10, 10, 4, 3,
+  13, 10, 10, 6, 6, 6, 6, 8, 8, 8, 10, 10, 10, 10, 1, 12,
+  10, 10, 10, 10, 10, 8, 8, 8, 5, 5, 10, 10, 2, 5, 10, 10,
+  10, 10, 10, 11, 21, 10, 10, 10, 10, 10, 4, 4, 4, 6, 2, 2,
+  4, 6, 8, 8, 8, 10, 10, 10, 10, 10, 3, 6, 7, 10, 10, 10,
+  10, 10, 8, 8, 8, 7, 10, 10, 5, 5, 10, 10, 10, 23, 13, 10,
+  10, 10, 10, 6, 2, 2, 4, 6, 10, 10, 10, 10, 2, 14, 1, 11,
+  1, 1, 9, 1, 12, 10, 6, 5, 5, 5, 2, 4, 5, 9, 9, 9,
+  2, 3, 6, 8, 5, 6, 9, 9, 9, 1, 15, 11, 5, 2, 2, 4,
+  6, 6, 5, 2, 4, 2, 2, 4, 8, 9, 1, 2, 27, 6, 5, 5,
+  5, 4, 5, 6, 6, 9, 6, 5, 4, 4, 4, 4, 6, 6, 5, 5,
+  4, 2, 2, 2, 4, 5, 5, 9, 1, 2, 32, 6, 7, 4, 4, 7,
+  6, 10, 4, 5, 6, 9, 6, 4, 5, 5, 5, 5, 4, 6, 4, 4,
+  2, 2, 4, 2, 2, 9, 5, 6, 6, 11, 9, 1, 1, 36, 9, 8,
+  1, 5, 9, 11, 10, 9, 9, 5, 5, 6, 9, 4, 5, 4, 2, 2,
+  5, 10, 5, 5, 5, 5, 5, 4, 5, 5, 6, 8, 6, 8, 9, 9,
+  10, 11, 2, 1, 24, 6, 4, 1, 5, 10, 9, 9, 9, 10, 6, 4,
+  4, 5, 5, 2, 2, 2, 5, 10, 9, 8, 10, 11, 11, 2, 12, 9,
+  9, 10, 9, 9, 9, 10, 9, 9, 9, 10, 10, 3, 1, 20, 9, 4,
+  2, 6, 10, 9, 9, 9, 9, 10, 4, 4, 6, 9, 4, 4, 5, 6,
+  4, 5, 15, 1, 10, 1, 1, 11, 1, 1, 20, 9, 4, 1, 9, 9,
+  9, 9, 9, 9, 9, 6, 1, 6, 9, 4, 4, 5, 2, 1, 5, 3,
+  1, 21, 9, 4, 2, 6, 10, 9, 9, 9, 9, 11, 5, 4, 5, 6,
+  4, 5, 5, 4, 2, 6, 11, 12, 1, 11, 2, 2, 10, 10, 4, 1,
+  22, 9, 6, 2, 5, 10, 9, 9, 9, 9, 6, 2, 5, 5, 6, 4,
+  2, 5, 9, 4, 6, 9, 11, 1, 1, 10, 1, 1, 11, 1, 11, 9,
+  10, 10, 9, 9, 8, 9, 10, 9, 10, 10, 1, 2, 34, 6, 9, 1,
+  5, 11, 9, 10, 11, 2, 5, 6, 9, 5, 4, 4, 2, 4, 6, 6,
+  9, 6, 8, 6, 5, 5, 4, 5, 6, 9, 8, 9, 6, 9, 9, 1,
+  2, 30, 5, 5, 7, 5, 6, 10, 9, 4, 7, 9, 6, 5, 4, 4,
+  2, 4, 2, 7, 8, 5, 4, 4, 2, 2, 2, 2, 5, 6, 9, 9,
+  1, 2, 27, 10, 5, 5, 5, 6, 9, 9, 7, 10, 9, 5, 2, 4,
+  4, 5, 6, 5, 6, 5, 2, 2, 2, 2, 4, 5, 5, 9, 1, 1,
+  24, 9, 5, 5, 6, 6, 6, 5, 5, 4, 4, 5, 2, 2, 2, 4,
+  5, 6, 8, 5, 2, 2, 2, 4, 9, 1, 0, 23, 9, 2, 2, 2,
+  4, 4, 4, 2, 4, 2, 4, 9, 4, 2, 4, 5, 5, 4, 2, 2,
+  2, 5, 9, 1, 1, 19, 5, 2, 4, 2, 2, 2, 2, 4, 5, 4,
+  6, 6, 6, 6, 6, 5, 5, 5, 9, 1, 11, 2, 9, 9, 2, 10,
+  5, 6, 6, 6, 8, 9, 10, 6, 11, 6, 5, 5, 5, 9, 2, 9,
+  7, 9, 6, 9, 6, 5, 8, 10, 1, 16, 9, 9, 6, 5, 5, 11,
+  5, 4, 4, 2, 4, 4, 2, 6, 6, 10, 1, 8, 27, 9, 6, 8,
+  5, 7, 5, 6, 9, 8, 6, 6, 5, 4, 5, 5, 2, 2, 2, 2,
+  4, 4, 5, 6, 4, 5, 8, 9, 2, 8, 21, 5, 5, 4, 5, 5,
+  5, 5, 9, 5, 4, 4, 2, 2, 9, 5, 2, 2, 4, 4, 5, 9,
+  1, 7, 9, 9, 6, 5, 6, 9, 11, 2, 7, 21, 10, 5, 8, 4,
+  4, 4, 6, 5, 9, 5, 2, 2, 2, 5, 9, 6, 4, 4, 6, 9,
+  11, 5, 6, 9, 9, 9, 9, 9, 10, 2, 7, 18, 8, 5, 8, 5,
+  4, 5, 4, 5, 6, 6, 4, 4, 5, 6, 9, 8, 6, 6, 12, 2,
+  10, 10, 1, 6, 18, 6, 6, 5, 6, 7, 2, 5, 7, 5, 6, 9,
+  6, 6, 6, 2, 5, 9, 8, 1, 6, 17, 6, 9, 5, 6, 7, 4,
+  4, 5, 5, 6, 6, 5, 10, 5, 2, 4, 9, 1, 6, 17, 6, 9,
+  5, 6, 5, 2, 4, 4, 5, 6, 9, 4, 9, 5, 2, 4, 9, 1,
+  5, 19, 11, 9, 9, 5, 8, 5, 2, 5, 7, 5, 6, 6, 5, 10,
+  5, 2, 4, 9, 9, 1, 3, 22, 10, 6, 6, 6, 9, 6, 5, 7,
+  4, 4, 5, 6, 6, 8, 4, 6, 9, 5, 5, 9, 9, 11, 2, 1,
+  26, 11, 6, 4, 5, 4, 5, 11, 6, 6, 7, 4, 5, 5, 5, 6,
+  6, 4, 2, 4, 9, 9, 6, 5, 5, 9, 9, 10, 1, 11, 3, 0,
+  28, 9, 4, 4, 4, 2, 4, 5, 8, 9, 8, 7, 4, 7, 7, 5,
+  9, 5, 4, 4, 2, 5, 9, 4, 4, 2, 4, 5, 9, 2, 1, 9,
+  1, 7, 10, 6, 6, 10, 10, 9, 9, 1, 0, 38, 5, 2, 2, 4,
+  4, 4, 5, 5, 9, 6, 8, 5, 7, 5, 5, 9, 5, 6, 6, 5,
+  5, 5, 4, 2, 2, 2, 4, 4, 6, 6, 5, 6, 5, 8, 9, 10,
+  10, 10, 1, 1, 35, 4, 2, 4, 4, 4, 4, 6, 8, 9, 9, 8,
+  8, 5, 8, 9, 9, 9, 5, 9, 4, 9, 8, 5, 4, 2, 2, 4,
+  4, 5, 5, 5, 9, 9, 11, 10, 4, 2, 5, 6, 6, 9, 8, 6,
+  3, 4, 11, 8, 6, 9, 2, 1, 11, 8, 8, 9, 5, 6, 2, 5,
+  9, 9, 10, 1, 6, 3, 5, 5, 5, 1, 1, 12, 6, 5, 6, 9,
+  5, 2, 5, 5, 4, 4, 4, 5, 1, 0, 17, 6, 4, 6, 9, 5,
+  6, 5, 4, 4, 6, 5, 4, 4, 5, 6, 9, 9, 2, 0, 11, 5,
+  4, 11, 9, 9, 4, 6, 4, 4, 6, 10, 3, 4, 9, 9, 9, 9,
+  1, 0, 10, 5, 4, 10, 9, 10, 4, 6, 5, 4, 4, 1, 0, 18,
+  6, 4, 9, 10, 5, 5, 6, 4, 4, 6, 9, 6, 5, 5, 9, 9,
+  9, 10, 1, 1, 14, 5, 6, 9, 6, 6, 4, 4, 5, 5, 4, 2,
+  4, 5, 9, 1, 0, 12, 4, 4, 5, 4, 4, 4, 2, 5, 5, 4,
+  4, 6, 3, 5, 3, 6, 6, 8, 1, 1, 9, 1, 5, 6, 4, 4,
+  4, 6, 1, 4, 14, 6, 7, 5, 6, 5, 4, 5, 4, 2, 4, 5,
+  6, 6, 9, 2, 4, 9, 5, 4, 5, 6, 4, 4, 6, 5, 6, 4,
+  2, 9, 9, 1, 3, 9, 6, 5, 4, 4, 6, 6, 5, 4, 8, 1,
+  3, 9, 6, 5, 4, 4, 6, 6, 6, 2, 9, 1, 1, 12, 6, 5,
+  6, 6, 5, 5, 6, 5, 4, 6, 6, 6, 1, 0, 19, 5, 2, 2,
+  5, 9, 7, 5, 6, 5, 4, 6, 4, 2, 5, 6, 6, 6, 9, 11,
 };
 
 #endif
@@ -8,934 +8,573 @@
 #define ENEMY_MELEE_WALK_HEIGHT 128
 #define ENEMY_MELEE_WALK_TRANSPARENT_IDX 12
 
-typedef struct { int x, y, w, h; int offset; } enemy_melee_walk_frame_t;
+// level l of a frame is its WIDTH >> l by HEIGHT >> l version
+#define ENEMY_MELEE_WALK_LODS 3
 
-static const enemy_melee_walk_frame_t enemy_melee_walk_frame_info[4] = {
-  { 51, 40, 48, 87, 0 },
-  { 42, 38, 33, 89, 4176 },
-  { 29, 40, 48, 87, 7113 },
-  { 42, 46, 41, 81, 11289 },
+// spans: offset of the frame in enemy_melee_walk_spans, lines: index of its first column in enemy_melee_walk_lines
+typedef struct { int x, y, w, h; int spans, lines; } enemy_melee_walk_frame_t;
+
+static const enemy_melee_walk_frame_t enemy_melee_walk_frame_info[3][4] = {
+  {
+    { 51, 40, 48, 87, 0, 0 },
+    { 42, 38, 33, 89, 1551, 48 },
+    { 29, 40, 48, 87, 3131, 81 },
+    { 42, 46, 41, 81, 4679, 129 },
+  },
+  {
+    { 25, 20, 23, 43, 6067, 170 },
+    { 21, 19, 16, 44, 6497, 193 },
+    { 15, 20, 23, 43, 6914, 209 },
+    { 21, 23, 20, 40, 7344, 232 },
+  },
+  {
+    { 13, 10, 10, 20, 7728, 252 },
+    { 11, 10, 7, 21, 7853, 262 },
+    { 8, 10, 10, 20, 7953, 269 },
+    { 10, 12, 10, 18, 8061, 279 },
+  },
 };
 
 static const uint16_t enemy_melee_walk_palette[13] = {
 44631, 40143, 25617, 39826, 21261, 10697, 4421, 14595, 4230, 2115, 1, 0, 63519
 };
 
-static const uint8_t enemy_melee_walk_pixels[14610] = {
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 2, 2, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 5, 10, 10, 5, 10, 10,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 10, 8, 8, 10, 8, 8,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 5, 5, 5, 5, 10,
-  8, 8, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 8, 8, 8, 8, 7, 1,
-  7, 8, 5, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 8, 5, 1, 7, 1, 7, 10, 10,
-  10, 1, 7, 5, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 6, 7, 10, 10, 10, 10, 10, 10,
-  10, 10, 1, 6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 1, 10, 10, 10, 10, 10, 10, 10,
-  10, 10, 10, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 6, 10, 10, 10, 9, 9, 9, 9, 9,
-  9, 10, 10, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 6, 10, 9, 9, 9, 9, 9, 9, 9,
-  9, 9, 9, 7, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 5, 6, 8, 10, 10, 9, 9, 9, 10, 10,
-  10, 10, 1, 7, 2, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 6, 8, 1, 10, 10, 10, 10, 7, 1,
-  7, 7, 7, 8, 2, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 5, 6, 8, 7, 7, 1, 7, 8, 8,
-  8, 2, 2, 6, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 6, 6, 8, 8, 8, 8, 6, 2,
-  2, 6, 6, 4, 10, 6, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 6, 6, 6, 2, 2, 2, 6,
-  6, 6, 4, 10, 10, 6, 2, 8, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 6, 4, 4, 6, 6, 6, 6, 6,
-  4, 4, 8, 8, 6, 6, 2, 8, 0, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 4, 4, 4, 4, 4, 10,
-  10, 10, 8, 10, 2, 2, 3, 8, 2, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 8, 8, 10, 8, 8, 8, 10, 10,
-  6, 10, 10, 2, 2, 4, 3, 8, 2, 3, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 6, 10, 10, 6, 8, 10, 4, 4, 4, 4,
-  4, 3, 2, 6, 4, 4, 4, 8, 8, 0, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 0, 10, 10, 2, 10, 10, 4, 4, 4,
-  3, 3, 6, 10, 4, 3, 4, 4, 8, 2, 2, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 3, 3, 4, 4, 4, 4, 4, 4, 6,
-  4, 10, 10, 4, 2, 2, 4, 4, 4, 8, 8, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 3, 4, 4, 4, 4, 4, 6, 6, 8, 8,
-  4, 4, 2, 2, 8, 6, 4, 4, 4, 8, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 0, 4, 4, 4, 4, 4, 4, 4, 2, 2,
-  2, 4, 10, 8, 6, 4, 4, 2, 10, 3, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 3, 4, 4, 4, 2, 6, 6, 6, 6, 10,
-  10, 4, 6, 6, 4, 2, 2, 4, 10, 10, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 4, 4, 2, 4, 2, 4, 2, 4, 4, 6,
-  6, 4, 4, 4, 4, 4, 4, 2, 2, 2, 10, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 4, 10, 4, 2, 4, 2, 4, 2, 10, 4,
-  4, 4, 4, 4, 2, 2, 2, 4, 4, 10, 0, 0, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 4, 6, 10, 4, 2, 4, 2, 10, 10, 4,
-  4, 4, 4, 10, 8, 8, 8, 2, 2, 10, 3, 3, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 3, 4, 6, 10, 4, 2, 4, 2, 8, 8, 10,
-  4, 4, 10, 4, 10, 10, 10, 8, 8, 8, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 3, 6, 10, 0, 10, 4, 8, 10, 6, 10, 8,
-  4, 4, 8, 10, 4, 6, 6, 10, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 4, 6, 10, 3, 3, 8, 10, 6, 10, 8, 8,
-  2, 4, 4, 8, 10, 10, 10, 10, 6, 6, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 4, 4, 6, 10, 10, 10, 6, 10, 8, 4, 4,
-  3, 3, 4, 4, 4, 6, 6, 6, 6, 4, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 8, 8, 4, 4, 6, 6, 6, 6, 8, 4, 4, 2,
-  3, 2, 2, 2, 4, 4, 4, 4, 2, 2, 4, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 8, 8, 4, 4, 4, 4, 4, 4, 4, 2, 2, 2,
-  3, 3, 2, 4, 4, 4, 4, 2, 2, 2, 3, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 8, 8, 8, 4, 2, 2, 4, 4, 4, 4, 4, 2,
-  2, 2, 4, 4, 4, 4, 4, 4, 6, 4, 2, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 6, 8, 4, 2, 4, 4, 4, 10, 4, 4, 4, 4,
-  4, 4, 4, 4, 4, 4, 4, 10, 10, 6, 4, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 4, 2, 4, 2, 4, 4, 10, 6, 6, 6, 4,
-  4, 4, 6, 6, 10, 4, 4, 3, 3, 10, 6, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 6, 4, 2, 4, 2, 4, 4, 10, 10, 10, 10, 6,
-  6, 6, 10, 10, 4, 4, 4, 2, 3, 10, 6, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 6, 4, 4, 2, 2, 4, 4, 6, 10, 10, 10, 10,
-  10, 10, 10, 4, 4, 4, 3, 3, 2, 8, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 6, 4, 4, 2, 2, 2, 4, 6, 10, 10, 10, 10,
-  10, 10, 4, 4, 4, 2, 2, 3, 3, 4, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 6, 4, 2, 3, 3, 2, 4, 6, 8, 10, 6, 6,
-  10, 8, 10, 10, 4, 4, 2, 2, 3, 2, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 8, 4, 2, 3, 3, 2, 4, 8, 10, 10, 8, 6,
-  6, 10, 8, 4, 4, 4, 4, 2, 3, 3, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 8, 4, 2, 3, 2, 4, 4, 8, 10, 8, 8, 8,
-  6, 6, 8, 8, 4, 4, 4, 2, 2, 3, 2, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 8, 4, 2, 3, 2, 4, 4, 8, 10, 8, 6, 8,
-  8, 8, 10, 8, 4, 4, 4, 4, 2, 2, 3, 8, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 10, 10, 8, 4, 2, 3, 2, 4, 6, 8, 10, 8, 6, 6,
-  6, 8, 8, 10, 8, 4, 4, 4, 4, 2, 3, 4, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 4, 10, 8, 4, 2, 2, 2, 4, 6, 10, 10, 6, 6, 4,
-  4, 8, 8, 10, 10, 8, 4, 4, 4, 2, 2, 3, 8, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  8, 4, 6, 10, 8, 4, 2, 2, 2, 4, 6, 10, 10, 6, 4, 4,
-  8, 8, 10, 10, 10, 8, 4, 4, 4, 4, 2, 3, 4, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 4, 6, 10, 8, 4, 2, 2, 4, 4, 6, 10, 10, 8, 8, 8,
-  10, 10, 10, 12, 12, 10, 6, 4, 4, 4, 4, 2, 3, 4, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 8, 6, 8, 4, 4, 2, 4, 4, 6, 10, 10, 10, 10, 10,
-  10, 10, 12, 12, 12, 12, 10, 6, 4, 4, 4, 4, 3, 2, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 8, 8, 8, 6, 4, 2, 4, 4, 8, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 6, 4, 4, 2, 2, 10, 10, 8,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 6, 4, 2, 4, 4, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 4, 4, 10, 0, 0, 8,
-  8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 6, 4, 2, 4, 4, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 6, 10, 4, 4, 10, 2, 3, 0,
-  8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 6, 4, 4, 4, 6, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 4, 4, 2, 2, 3,
-  10, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 6, 6, 4, 4, 6, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 4, 4, 4, 4,
-  8, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 6, 6, 4, 4, 6, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 4, 4, 8,
-  6, 6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 6, 6, 4, 4, 6, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 6, 6,
-  6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 6, 4, 4, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 4, 4,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 8, 4, 4, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 2,
-  2, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 6, 6, 6, 4, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6,
-  6, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 3, 3, 3, 4, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  8, 8, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 2, 2, 4, 4, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  6, 8, 6, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 8, 4, 4, 6, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8,
-  8, 6, 10, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 8, 8, 8, 6, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  8, 10, 6, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 6, 6, 6, 6, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 8, 10, 8, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 4, 4, 4, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 6, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 4, 4, 10, 4, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 6, 10, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 4, 8, 6, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 8, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 8, 6, 6, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 8, 6, 8, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 8, 4, 4, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 8, 10, 6, 10, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 10, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 8, 10, 8, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 8, 6, 6, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 8, 10, 10, 10, 6, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 6, 8, 10, 8, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 8, 10, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 6, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 10, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 8, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 10, 10, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 6, 8, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10,
-  12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10,
-  12, 12, 12, 12, 12, 12, 12, 8, 10, 8, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 8, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 2, 2, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 5, 10, 10, 5, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 8, 10, 8, 8, 10, 8, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 8, 8, 8, 10, 5, 5, 5, 5, 10, 10, 8,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 8, 10, 10, 5, 5, 8, 8, 8, 8, 5, 10,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 8, 10, 5, 8, 7, 1, 7, 1, 7, 1,
-  5, 10, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 5, 7, 1, 10, 10, 10, 10, 10,
-  10, 7, 1, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 10, 6, 1, 10, 10, 10, 10, 10,
-  10, 10, 10, 10, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 8, 10, 10, 9, 9, 9,
-  9, 9, 10, 10, 10, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 6, 8, 10, 10, 9, 9,
-  9, 9, 9, 9, 9, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 8, 10, 9, 9,
-  9, 9, 9, 9, 9, 10, 10, 8, 6, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 2, 10, 1,
-  10, 10, 10, 10, 10, 10, 10, 1, 8, 6, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 6, 8,
-  8, 7, 7, 1, 7, 1, 7, 7, 8, 2, 8, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8,
-  6, 2, 2, 8, 8, 8, 8, 8, 8, 2, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  4, 6, 6, 6, 6, 2, 2, 2, 2, 6, 6, 4, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10,
-  10, 10, 4, 4, 4, 6, 6, 6, 6, 6, 4, 4, 4, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8,
-  8, 8, 6, 10, 10, 10, 4, 4, 4, 4, 4, 8, 10, 10, 2, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 10,
-  10, 2, 8, 8, 6, 6, 10, 10, 8, 8, 8, 10, 10, 8, 8, 2,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 2,
-  8, 2, 4, 4, 8, 3, 2, 6, 6, 6, 6, 6, 6, 8, 2, 3,
-  3, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  8, 2, 8, 4, 4, 4, 4, 3, 2, 2, 2, 2, 2, 2, 3, 3,
-  8, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  2, 8, 3, 3, 4, 4, 6, 10, 10, 3, 4, 4, 4, 4, 3, 10,
-  6, 4, 4, 3, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 2, 8, 3, 4, 4, 4, 4, 6, 6, 10, 10, 2, 4, 10, 10,
-  6, 4, 4, 4, 3, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 2, 8, 4, 4, 4, 4, 4, 4, 4, 2, 4, 2, 2, 2,
-  4, 4, 4, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 2, 2, 8, 3, 10, 4, 4, 6, 6, 10, 10, 10, 4, 10,
-  10, 10, 6, 6, 4, 2, 4, 8, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 10, 2, 8, 3, 4, 10, 4, 4, 4, 6, 6, 6, 4, 4,
-  4, 6, 6, 4, 4, 4, 2, 4, 10, 8, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 2, 8, 3, 10, 10, 2, 4, 4, 4, 4, 4, 4,
-  4, 4, 4, 4, 4, 4, 2, 4, 2, 4, 8, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 8, 8, 4, 10, 10, 4, 2, 4, 2, 4, 4, 4,
-  4, 4, 4, 4, 10, 2, 4, 2, 4, 2, 4, 8, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 4, 3, 4, 10, 2, 2, 4, 2, 4, 10, 4,
-  4, 4, 4, 4, 4, 10, 10, 2, 4, 2, 4, 4, 8, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 2, 4, 8, 0, 10, 4, 4, 2, 10, 8,
-  4, 10, 4, 4, 4, 4, 4, 10, 10, 10, 2, 4, 10, 8, 12, 12,
-  12, 12, 12, 12, 12, 10, 2, 4, 4, 8, 0, 3, 10, 2, 10, 10,
-  8, 10, 4, 4, 4, 4, 10, 10, 4, 10, 3, 10, 10, 10, 8, 12,
-  12, 12, 12, 12, 12, 12, 10, 2, 3, 4, 4, 10, 10, 10, 8, 8,
-  10, 10, 4, 4, 4, 4, 4, 6, 10, 10, 8, 0, 3, 10, 6, 10,
-  12, 12, 12, 12, 12, 12, 12, 10, 2, 3, 4, 4, 8, 6, 6, 10,
-  10, 6, 6, 4, 4, 4, 3, 4, 10, 4, 4, 10, 10, 10, 8, 6,
-  10, 12, 12, 12, 12, 12, 12, 12, 10, 3, 4, 4, 6, 4, 10, 10,
-  6, 6, 6, 4, 4, 4, 3, 3, 4, 4, 10, 10, 10, 10, 6, 6,
-  4, 10, 12, 12, 12, 12, 12, 12, 12, 10, 3, 4, 4, 4, 4, 4,
-  4, 4, 4, 4, 4, 4, 2, 2, 2, 3, 4, 4, 4, 4, 6, 6,
-  4, 4, 4, 12, 12, 12, 12, 12, 12, 10, 10, 3, 10, 4, 2, 4,
-  3, 4, 4, 8, 4, 6, 4, 4, 2, 2, 2, 4, 4, 4, 4, 4,
-  4, 4, 4, 4, 12, 12, 12, 12, 12, 12, 10, 3, 4, 10, 4, 2,
-  4, 3, 3, 4, 8, 8, 10, 4, 4, 4, 4, 4, 4, 6, 10, 8,
-  4, 3, 3, 4, 4, 12, 12, 12, 12, 12, 12, 10, 4, 10, 10, 4,
-  2, 2, 2, 3, 6, 4, 6, 10, 10, 6, 6, 6, 6, 6, 10, 10,
-  4, 4, 3, 3, 4, 8, 12, 12, 12, 12, 12, 12, 10, 4, 4, 10,
-  4, 4, 2, 2, 3, 6, 6, 8, 8, 10, 10, 10, 10, 10, 10, 8,
-  8, 4, 4, 3, 2, 4, 8, 12, 12, 12, 12, 12, 10, 10, 4, 6,
-  10, 8, 4, 4, 2, 3, 3, 8, 4, 8, 10, 10, 10, 10, 10, 6,
-  6, 8, 8, 4, 3, 2, 4, 10, 12, 12, 12, 12, 12, 10, 10, 4,
-  6, 10, 8, 4, 4, 2, 3, 3, 4, 4, 8, 6, 6, 10, 8, 10,
-  6, 6, 4, 4, 3, 3, 2, 4, 10, 12, 12, 12, 12, 10, 10, 10,
-  4, 6, 10, 8, 4, 4, 2, 3, 2, 4, 4, 8, 10, 8, 8, 8,
-  10, 8, 6, 6, 4, 3, 2, 2, 4, 10, 12, 12, 12, 12, 10, 6,
-  10, 4, 6, 10, 8, 4, 2, 2, 3, 2, 4, 8, 8, 8, 6, 6,
-  8, 10, 8, 8, 6, 4, 3, 2, 3, 4, 8, 12, 12, 12, 10, 10,
-  3, 3, 6, 10, 10, 8, 4, 4, 2, 3, 2, 4, 8, 10, 6, 8,
-  8, 8, 8, 10, 8, 6, 4, 2, 2, 3, 4, 8, 12, 12, 12, 10,
-  10, 10, 3, 10, 10, 10, 8, 4, 2, 2, 3, 4, 4, 8, 10, 10,
-  10, 10, 10, 10, 10, 8, 6, 4, 2, 2, 3, 4, 8, 12, 12, 10,
-  10, 2, 3, 8, 6, 6, 10, 8, 4, 2, 3, 3, 4, 4, 8, 10,
-  10, 10, 10, 12, 12, 10, 8, 6, 4, 2, 2, 4, 4, 8, 12, 10,
-  10, 10, 2, 4, 4, 8, 8, 10, 8, 4, 2, 3, 3, 4, 4, 10,
-  10, 12, 12, 12, 12, 12, 10, 8, 6, 4, 2, 2, 4, 4, 8, 10,
-  10, 3, 2, 4, 8, 6, 4, 10, 10, 4, 2, 2, 3, 4, 4, 4,
-  10, 10, 12, 12, 12, 12, 12, 10, 8, 4, 4, 2, 2, 4, 4, 8,
-  10, 3, 3, 4, 4, 4, 6, 8, 10, 10, 4, 2, 2, 3, 4, 4,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 8, 8, 4, 2, 3, 4, 4,
-  8, 10, 8, 8, 2, 4, 4, 8, 10, 10, 10, 4, 2, 3, 3, 4,
-  4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4, 2, 3, 4,
-  10, 8, 10, 10, 8, 8, 6, 6, 10, 10, 10, 4, 2, 2, 3, 4,
-  4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4, 2, 3,
-  4, 8, 8, 12, 10, 10, 8, 8, 8, 12, 12, 10, 4, 2, 2, 3,
-  4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 4, 2,
-  3, 4, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 4, 2,
-  4, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 4,
-  2, 2, 4, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 4,
-  2, 4, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  4, 2, 2, 4, 8, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8,
-  8, 8, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 4, 2, 2, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 3,
-  3, 3, 8, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 4, 4, 2, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  2, 2, 2, 4, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 4, 4, 4, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 6, 4, 4, 4, 4, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 8, 8, 8, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 8, 8, 8, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 3, 3, 3, 3, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 4, 6, 6, 4, 10, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 4, 2, 2, 4, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 4, 4, 6, 4, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 4, 4, 4, 8, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 6, 4, 4, 4, 6, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 8, 6, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 6, 4, 6, 4, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 6, 4, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 4, 8, 8, 4, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 6, 6, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 4, 6, 8, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 6, 4, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4, 4, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 8, 4,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 8, 8, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 4,
-  8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4, 8,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  6, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 8,
-  4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  4, 4, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 4, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 6, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 10, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 8, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 8, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 8, 6, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 6, 8, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 8, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 8, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 2, 2, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 5, 10, 10, 5,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 8, 10, 8, 8, 10,
-  8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 8, 8, 8, 10, 5, 5, 5, 5, 10,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 5, 8, 7, 1, 7, 8, 8, 8, 8,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 5, 7, 1, 10, 10, 10, 7, 1, 7, 1,
-  5, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 6, 1, 10, 10, 10, 10, 10, 10, 10, 10,
-  7, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 8, 10, 10, 10, 10, 10, 10, 10, 10, 10,
-  10, 1, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 8, 10, 10, 9, 9, 9, 9, 9, 9, 10,
-  10, 10, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 6, 7, 9, 9, 9, 9, 9, 9, 9, 9, 9,
-  9, 10, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 2, 7, 1, 10, 10, 10, 10, 9, 9, 9, 10,
-  10, 8, 6, 5, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 2, 8, 7, 7, 7, 1, 7, 10, 10, 10, 10,
-  1, 8, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 10, 10, 6, 2, 2, 8, 8, 8, 7, 1, 7, 7,
-  8, 6, 5, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 6, 6, 10, 4, 6, 6, 2, 2, 6, 8, 8, 8, 8,
-  6, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 8, 2, 6, 10, 10, 4, 6, 6, 6, 2, 2, 2, 6, 6,
-  6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 0, 8, 2, 6, 6, 8, 8, 4, 4, 6, 6, 6, 6, 6, 4,
-  4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 2, 8, 3, 2, 2, 10, 8, 10, 10, 10, 4, 4, 4, 4, 4,
-  10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  3, 2, 8, 3, 4, 2, 2, 10, 10, 6, 10, 10, 8, 8, 8, 10,
-  8, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  0, 8, 8, 4, 4, 4, 6, 2, 3, 4, 4, 4, 4, 4, 10, 8,
-  6, 10, 10, 6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 2,
-  2, 8, 4, 4, 3, 4, 10, 6, 3, 3, 4, 4, 4, 10, 10, 2,
-  10, 10, 0, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8,
-  8, 4, 4, 4, 2, 2, 4, 10, 10, 4, 6, 4, 4, 4, 4, 4,
-  4, 3, 3, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  8, 4, 4, 4, 6, 8, 2, 2, 4, 4, 8, 8, 6, 6, 4, 4,
-  4, 4, 4, 3, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  3, 10, 2, 4, 4, 6, 8, 10, 4, 2, 2, 2, 4, 4, 4, 4,
-  4, 4, 4, 0, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  10, 10, 4, 2, 2, 4, 6, 6, 4, 10, 10, 6, 6, 6, 6, 2,
-  4, 4, 4, 3, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10,
-  2, 2, 2, 4, 4, 4, 4, 4, 4, 6, 6, 4, 4, 2, 4, 2,
-  4, 2, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 0, 0,
-  10, 4, 4, 2, 2, 2, 4, 4, 4, 4, 4, 10, 2, 4, 2, 4,
-  2, 4, 10, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 3, 3,
-  10, 2, 2, 8, 8, 8, 10, 4, 4, 4, 4, 10, 10, 2, 4, 2,
-  4, 10, 6, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  8, 8, 8, 10, 10, 10, 4, 10, 4, 4, 10, 8, 8, 2, 4, 2,
-  4, 10, 6, 4, 3, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 10, 6, 6, 4, 10, 8, 4, 4, 8, 10, 6, 10, 8, 4,
-  10, 0, 10, 6, 3, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  6, 6, 10, 10, 10, 10, 8, 4, 4, 2, 8, 8, 10, 6, 10, 8,
-  3, 3, 10, 6, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  4, 6, 6, 6, 6, 4, 4, 4, 3, 3, 4, 4, 8, 10, 6, 10,
-  10, 10, 6, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4,
-  2, 2, 4, 4, 4, 4, 2, 2, 2, 3, 2, 4, 4, 8, 6, 6,
-  6, 6, 4, 4, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 3,
-  2, 2, 2, 4, 4, 4, 4, 2, 3, 3, 2, 2, 2, 4, 4, 4,
-  4, 4, 4, 4, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 2,
-  4, 6, 4, 4, 4, 4, 4, 4, 2, 2, 2, 4, 4, 4, 4, 4,
-  2, 2, 4, 8, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4,
-  6, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 4,
-  4, 4, 2, 4, 8, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6,
-  10, 3, 3, 4, 4, 10, 6, 6, 4, 4, 4, 6, 6, 6, 10, 4,
-  4, 2, 4, 2, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6,
-  10, 3, 2, 4, 4, 4, 10, 10, 6, 6, 6, 10, 10, 10, 10, 4,
-  4, 2, 4, 2, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  8, 2, 3, 3, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 6, 4,
-  4, 2, 2, 4, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  4, 3, 3, 2, 2, 4, 4, 4, 10, 10, 10, 10, 10, 10, 6, 4,
-  2, 2, 2, 4, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  2, 3, 2, 2, 4, 4, 10, 10, 8, 10, 6, 6, 10, 8, 6, 4,
-  2, 3, 3, 2, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  3, 3, 2, 4, 4, 4, 4, 8, 10, 6, 6, 8, 10, 10, 8, 4,
-  2, 3, 3, 2, 4, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 2,
-  3, 2, 2, 4, 4, 4, 8, 8, 6, 6, 8, 8, 8, 10, 8, 4,
-  4, 2, 3, 2, 4, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 3,
-  2, 2, 4, 4, 4, 4, 8, 10, 8, 8, 8, 6, 8, 10, 8, 4,
-  4, 2, 3, 2, 4, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 3,
-  2, 4, 4, 4, 4, 8, 10, 8, 8, 6, 6, 6, 8, 10, 8, 6,
-  4, 2, 3, 2, 4, 8, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 3, 2,
-  2, 4, 4, 4, 8, 10, 10, 8, 8, 4, 4, 6, 6, 10, 10, 6,
-  4, 2, 2, 2, 4, 8, 10, 4, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 3, 2,
-  4, 4, 4, 4, 8, 10, 10, 10, 8, 8, 4, 4, 6, 10, 10, 6,
-  4, 2, 2, 2, 4, 8, 10, 6, 4, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 3, 2, 4,
-  4, 4, 4, 6, 10, 12, 12, 10, 10, 10, 8, 8, 8, 10, 10, 6,
-  4, 4, 2, 2, 4, 8, 10, 6, 4, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 2, 3, 4, 4,
-  4, 4, 6, 10, 12, 12, 12, 12, 10, 10, 10, 10, 10, 10, 10, 6,
-  4, 4, 2, 4, 4, 8, 6, 8, 8, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 10, 10, 2, 2, 4,
-  4, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8,
-  4, 4, 2, 4, 6, 8, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 8, 0, 0, 10, 4, 4,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  4, 4, 2, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 0, 3, 2, 10, 4, 4,
-  10, 6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  4, 4, 2, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 8, 10, 3, 2, 2, 4, 4, 10,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  6, 4, 4, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 8, 8, 4, 4, 4, 4, 6, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  6, 4, 4, 6, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 6, 6, 8, 4, 4, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  6, 4, 4, 6, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 6, 6, 4, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  6, 4, 4, 6, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 4, 4, 10, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 4, 4, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 4, 2, 2, 6, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 4, 4, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 4, 6, 6, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  4, 6, 6, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 4, 8, 8, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  4, 3, 3, 3, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 6, 6, 8, 6, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  4, 4, 2, 2, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 4, 10, 6, 8, 8, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  6, 4, 4, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 10, 8, 6, 10, 8, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  6, 8, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 4, 8, 10, 8, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  6, 6, 6, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 6, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 4, 4, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 4, 10, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 4, 10, 4, 4, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 6, 8, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 8, 6, 6, 6, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 10, 10, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 6, 10, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 4, 4, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 8, 10, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 6, 10,
-  10, 10, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 6, 6, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  10, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  8, 10, 8, 6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10,
-  8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 8,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 10, 10, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  8, 6, 8, 10, 12, 12, 12, 12, 12, 10, 10, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  8, 10, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 2, 2, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 5, 10, 10, 5, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 8, 10, 8, 8, 10, 8, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 10, 10, 5, 5, 5,
-  5, 10, 8, 8, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 10, 5, 8, 8, 8, 8, 5, 5, 10, 10, 8, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 10, 5, 1, 7,
-  1, 7, 1, 7, 8, 5, 10, 8, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 1, 7, 10, 10, 10, 10, 10, 10, 1, 7, 5,
-  8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 10, 10,
-  10, 10, 10, 10, 10, 10, 10, 10, 1, 10, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 6, 10, 9, 9, 9, 9, 9, 9, 9, 10,
-  10, 8, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6,
-  8, 10, 10, 9, 9, 9, 9, 9, 9, 9, 10, 8, 6, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 6, 8, 1, 10, 10, 10, 10, 10,
-  10, 10, 9, 10, 6, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 8, 2, 8, 7, 1, 7, 1, 7, 7, 1, 8, 6, 6, 8, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 2, 8, 8, 8,
-  8, 8, 8, 2, 2, 6, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 4, 6, 6, 2, 2, 2, 2, 6, 6, 6, 6, 4,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 4, 4, 4,
-  6, 6, 6, 6, 6, 4, 4, 4, 10, 10, 10, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 2, 10, 10, 8, 4, 4, 4, 4, 4, 10, 10,
-  10, 6, 8, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 2, 8,
-  8, 10, 10, 8, 8, 8, 10, 10, 6, 6, 8, 8, 2, 10, 4, 6,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 8, 3, 3, 2, 8, 6, 6, 6, 6, 6,
-  6, 2, 3, 8, 4, 6, 6, 6, 8, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8,
-  8, 8, 3, 3, 2, 2, 2, 2, 2, 2, 3, 4, 4, 6, 6, 8,
-  8, 8, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 8, 8, 3, 4, 6, 10, 3, 4, 4,
-  4, 4, 3, 10, 10, 6, 10, 8, 3, 8, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  10, 4, 4, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10,
-  8, 3, 0, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 2, 4, 4, 2, 2, 4,
-  4, 2, 2, 4, 4, 4, 4, 4, 10, 8, 2, 3, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 2, 4, 2, 8, 4, 4, 4, 4, 4, 4, 4, 2, 10, 4,
-  4, 2, 8, 2, 3, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 2, 4, 2, 10, 10,
-  4, 4, 4, 10, 2, 4, 2, 10, 8, 4, 4, 8, 2, 2, 0, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 2, 4, 2, 8, 10, 4, 4, 4, 4, 10, 2, 4, 2,
-  4, 8, 4, 4, 4, 8, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 0, 10, 2, 8, 10,
-  6, 6, 4, 4, 4, 10, 10, 2, 4, 2, 8, 4, 4, 4, 2, 2,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 0, 3, 8, 10, 10, 10, 4, 4, 4, 6, 6, 10,
-  2, 4, 2, 10, 8, 4, 4, 4, 2, 2, 3, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10,
-  8, 8, 6, 4, 4, 4, 4, 8, 8, 8, 2, 10, 0, 8, 10, 10,
-  4, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 6, 4, 4, 4, 4, 4,
-  10, 10, 8, 10, 3, 3, 10, 4, 4, 4, 2, 10, 6, 6, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 6, 4, 4, 3, 3, 4, 4, 4, 4, 8, 8, 10, 10, 10,
-  10, 10, 4, 2, 4, 6, 3, 10, 6, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4, 4, 4, 2, 3,
-  3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 6, 2,
-  6, 6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 4, 10, 4, 4, 2, 2, 2, 2, 2, 2, 2, 4,
-  4, 4, 4, 2, 2, 4, 4, 4, 4, 6, 10, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 8, 4,
-  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 2, 4, 4, 8,
-  4, 4, 2, 2, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 8, 4, 4, 4, 4, 4, 10, 10, 10, 10,
-  8, 4, 4, 4, 4, 4, 4, 4, 8, 10, 8, 4, 4, 6, 4, 10,
-  10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4,
-  4, 3, 4, 4, 6, 8, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4,
-  8, 6, 10, 8, 8, 4, 6, 4, 2, 2, 10, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 4, 3, 2, 2, 2, 4, 10, 10,
-  6, 6, 10, 8, 8, 8, 8, 4, 4, 8, 6, 10, 8, 8, 4, 4,
-  4, 4, 2, 4, 2, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  8, 3, 3, 2, 4, 4, 4, 10, 8, 6, 6, 10, 8, 8, 4, 4,
-  2, 4, 8, 6, 10, 6, 4, 6, 4, 4, 4, 4, 2, 4, 2, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 3, 2, 2, 4, 4, 10,
-  10, 10, 6, 8, 10, 8, 6, 4, 4, 2, 4, 8, 6, 10, 6, 6,
-  6, 6, 6, 8, 4, 2, 8, 8, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 4, 3, 2, 4, 4, 4, 10, 10, 8, 8, 8, 10, 8, 6,
-  4, 4, 2, 4, 8, 6, 10, 8, 8, 8, 8, 10, 10, 8, 8, 8,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 3, 2, 4, 4, 4,
-  8, 10, 10, 10, 10, 10, 10, 8, 8, 4, 2, 2, 4, 4, 6, 10,
-  10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 8, 3, 2, 4, 4, 4, 6, 10, 12, 12, 12, 12, 10,
-  10, 8, 4, 2, 2, 2, 4, 6, 10, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4, 3, 4, 4,
-  4, 6, 10, 10, 12, 12, 12, 12, 12, 10, 8, 4, 4, 2, 2, 4,
-  6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 8, 3, 2, 4, 4, 4, 6, 10, 12, 12, 12, 12,
-  12, 12, 10, 8, 4, 4, 2, 4, 4, 8, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 3, 2,
-  4, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 10, 8, 4, 4, 4,
-  4, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 8, 3, 2, 4, 4, 4, 6, 10, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 6, 4, 4, 4, 8, 10, 8, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 2,
-  2, 4, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 10, 8, 6,
-  4, 4, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 2, 4, 4, 4, 10, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 10, 8, 6, 4, 4, 6, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8,
-  4, 4, 4, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 6, 4, 4, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 8, 8, 8, 8, 4, 4, 6, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4, 4, 6, 10, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 0, 3, 8, 4, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 6, 4, 6, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 0, 3, 2, 2, 4, 4, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 6, 6, 6,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 10, 4, 4, 4, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 4, 2, 2, 8, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6, 10, 4, 4, 4,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 4,
-  2, 2, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 2, 6, 10, 4, 4, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 8, 4, 2, 10, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 4, 4,
-  4, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  6, 10, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 2, 3, 4, 8, 4, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 6, 10, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 2, 4,
-  8, 4, 6, 6, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 10, 4, 6, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 8, 4, 4, 6, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 8, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 8,
-  2, 8, 4, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 6, 6, 4, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 8, 6, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 6,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 2, 4, 4, 6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 8, 10, 10, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 8, 10, 8, 6, 6, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 6,
-  6, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 4, 10, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 6, 8, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 10, 6, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 10, 8, 6, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 4, 8,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 10, 8, 10, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10,
-  8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 10, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 8, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 10, 10,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 8, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 8, 10, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 8, 10, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 10, 8, 8, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10,
-  10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 10, 10, 10, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 10, 10, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
-  12, 12,
+// start of each column in enemy_melee_walk_spans, relative to its frame
+static const uint16_t enemy_melee_walk_lines[289] = {
+  0, 7, 16, 27, 51, 91, 146, 220, 300, 387, 475, 554, 612, 665, 716, 767,
+  817, 867, 916, 963, 1008, 1050, 1091, 1132, 1173, 1213, 1253, 1291, 1327, 1349, 1365, 1381,
+  1397, 1413, 1428, 1441, 1454, 1466, 1477, 1487, 1496, 1505, 1513, 1521, 1529, 1535, 1541, 1546,
+  0, 7, 16, 26, 38, 52, 68, 87, 119, 163, 215, 275, 341, 411, 485, 548,
+  602, 654, 704, 752, 798, 845, 893, 941, 989, 1039, 1093, 1155, 1225, 1300, 1381, 1460,
+  1533, 0, 4, 9, 14, 20, 26, 34, 42, 50, 59, 68, 78, 89, 101, 114,
+  127, 142, 158, 174, 190, 206, 228, 264, 302, 342, 382, 423, 464, 505, 547, 592,
+  639, 688, 738, 788, 839, 890, 943, 1001, 1080, 1168, 1255, 1335, 1409, 1464, 1504, 1528,
+  1539, 0, 10, 25, 46, 68, 92, 115, 138, 168, 201, 241, 281, 329, 379, 427,
+  474, 520, 565, 609, 653, 696, 738, 780, 839, 913, 983, 1050, 1111, 1161, 1205, 1243,
+  1269, 1288, 1304, 1318, 1330, 1341, 1352, 1362, 1371, 1380, 0, 4, 10, 28, 65, 110,
+  156, 186, 214, 241, 266, 290, 312, 334, 355, 375, 384, 393, 401, 408, 414, 420,
+  425, 0, 6, 13, 22, 37, 62, 96, 134, 169, 196, 222, 247, 273, 301, 337,
+  379, 0, 5, 9, 15, 21, 27, 34, 42, 52, 62, 75, 95, 116, 138, 160,
+  185, 211, 237, 265, 308, 353, 393, 419, 0, 8, 20, 33, 49, 73, 98, 124,
+  149, 173, 197, 220, 253, 289, 320, 342, 355, 364, 372, 378, 0, 9, 31, 54,
+  69, 83, 96, 108, 114, 120, 0, 5, 17, 36, 51, 65, 79, 0, 4, 8,
+  13, 20, 30, 43, 56, 70, 86, 0, 1, 9, 20, 34, 47, 60, 80, 95,
+  102,
+};
+
+// per column: span count, then { skip, run, run indices } for each span
+static const uint8_t enemy_melee_walk_spans[8168] = {
+  1, 45, 4, 10, 8, 10, 10, 1, 44, 6, 10, 10, 4, 4, 8, 10,
+  1, 42, 8, 10, 10, 10, 4, 6, 6, 8, 8, 1, 29, 21, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 6, 8, 1, 25, 37, 10, 10, 10, 10, 10, 10, 10, 8, 8, 8,
+  6, 10, 6, 6, 6, 6, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 2, 11, 1, 10, 9,
+  49, 10, 10, 10, 10, 10, 10, 10, 3, 3, 4, 4, 8, 8, 8, 8,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 6,
+  6, 6, 6, 6, 8, 10, 8, 8, 8, 8, 10, 10, 10, 4, 10, 10,
+  10, 10, 2, 6, 9, 10, 10, 10, 10, 10, 5, 10, 10, 10, 2, 60,
+  10, 10, 6, 10, 10, 3, 0, 3, 4, 4, 4, 4, 6, 6, 4, 4,
+  4, 8, 4, 2, 2, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 4,
+  4, 4, 4, 4, 6, 6, 6, 6, 8, 6, 3, 2, 8, 8, 6, 4,
+  4, 4, 10, 8, 8, 10, 8, 6, 10, 10, 10, 10, 1, 4, 77, 10,
+  10, 8, 10, 10, 6, 6, 6, 6, 5, 10, 10, 10, 10, 10, 10, 0,
+  3, 4, 4, 4, 4, 10, 6, 6, 10, 10, 6, 4, 4, 4, 2, 4,
+  4, 2, 2, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 4,
+  4, 4, 4, 4, 4, 6, 3, 2, 4, 8, 6, 4, 10, 8, 10, 6,
+  4, 8, 6, 8, 8, 10, 8, 10, 8, 10, 10, 10, 1, 3, 84, 10,
+  10, 10, 8, 6, 1, 10, 10, 8, 8, 6, 6, 10, 6, 10, 8, 10,
+  10, 3, 4, 4, 4, 2, 4, 10, 10, 0, 3, 10, 6, 4, 2, 4,
+  2, 2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 6, 3, 4, 4, 8, 6, 4, 4, 6, 10,
+  8, 4, 10, 6, 10, 6, 8, 6, 10, 10, 8, 10, 10, 10, 10, 10,
+  10, 10, 10, 1, 2, 85, 10, 8, 10, 10, 5, 7, 10, 10, 9, 10,
+  1, 8, 6, 6, 4, 10, 8, 6, 10, 4, 4, 4, 4, 4, 2, 4,
+  4, 10, 3, 10, 6, 4, 2, 4, 4, 4, 4, 2, 2, 2, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 10, 10, 4, 4,
+  4, 6, 6, 6, 10, 10, 10, 10, 10, 10, 10, 10, 8, 10, 10, 8,
+  10, 8, 10, 10, 8, 10, 10, 10, 10, 10, 10, 2, 1, 64, 10, 5,
+  10, 10, 8, 1, 10, 10, 10, 9, 10, 10, 7, 8, 6, 4, 4, 10,
+  8, 2, 4, 4, 4, 2, 2, 4, 2, 2, 4, 8, 10, 6, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 6, 8, 8,
+  8, 8, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 0, 55, 10, 2, 10,
+  8, 5, 8, 7, 10, 10, 9, 9, 9, 10, 7, 8, 6, 6, 4, 8,
+  10, 10, 4, 4, 4, 6, 4, 2, 4, 4, 8, 10, 6, 6, 4, 4,
+  10, 10, 10, 6, 6, 6, 8, 8, 8, 8, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 1, 0, 50, 10, 2, 10, 8, 5, 8, 1, 10, 10,
+  9, 9, 9, 10, 1, 8, 2, 6, 4, 8, 4, 10, 4, 6, 4, 6,
+  2, 4, 2, 2, 10, 6, 10, 8, 4, 4, 4, 6, 10, 10, 10, 8,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 1, 48, 10, 5, 10, 5,
+  8, 7, 10, 10, 9, 9, 9, 10, 7, 8, 2, 6, 4, 8, 4, 4,
+  4, 6, 4, 6, 4, 2, 10, 8, 6, 10, 8, 4, 2, 4, 4, 6,
+  10, 10, 10, 10, 10, 8, 8, 8, 6, 6, 8, 10, 1, 1, 48, 10,
+  10, 8, 5, 7, 10, 10, 10, 9, 9, 10, 7, 8, 6, 2, 6, 4,
+  10, 4, 4, 4, 8, 2, 6, 4, 10, 10, 8, 10, 8, 4, 4, 2,
+  4, 4, 6, 10, 10, 10, 6, 8, 8, 6, 6, 6, 4, 8, 10, 1,
+  2, 47, 10, 8, 10, 1, 10, 10, 10, 9, 9, 10, 1, 8, 2, 6,
+  6, 10, 10, 4, 4, 6, 8, 2, 10, 6, 4, 4, 10, 8, 8, 4,
+  2, 2, 2, 4, 4, 6, 10, 10, 6, 6, 8, 8, 6, 4, 4, 8,
+  10, 1, 2, 47, 10, 10, 8, 7, 10, 10, 10, 9, 9, 10, 7, 8,
+  2, 6, 4, 10, 6, 4, 3, 4, 4, 2, 10, 6, 4, 4, 4, 4,
+  2, 3, 3, 3, 2, 4, 4, 6, 10, 10, 10, 6, 6, 8, 6, 4,
+  8, 10, 10, 1, 3, 46, 10, 8, 8, 1, 10, 10, 10, 9, 10, 7,
+  2, 6, 6, 4, 10, 10, 3, 3, 10, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 3, 2, 3, 2, 4, 4, 6, 10, 10, 8, 10, 6, 8, 8,
+  8, 8, 10, 10, 1, 4, 44, 8, 5, 7, 1, 10, 10, 9, 1, 7,
+  2, 6, 4, 8, 8, 10, 2, 6, 10, 2, 10, 6, 4, 4, 4, 10,
+  8, 4, 4, 2, 2, 4, 4, 6, 10, 10, 4, 10, 8, 8, 10, 8,
+  8, 10, 10, 1, 5, 42, 10, 5, 6, 8, 8, 7, 7, 8, 6, 4,
+  10, 8, 10, 2, 6, 10, 4, 2, 8, 6, 4, 4, 10, 4, 10, 8,
+  4, 2, 4, 4, 4, 6, 10, 4, 4, 10, 4, 8, 8, 10, 10, 10,
+  1, 8, 39, 10, 10, 6, 2, 2, 10, 10, 10, 6, 2, 2, 4, 4,
+  2, 8, 6, 4, 4, 2, 8, 10, 4, 10, 4, 4, 4, 4, 4, 10,
+  4, 4, 4, 4, 4, 4, 4, 8, 10, 10, 1, 10, 38, 10, 10, 10,
+  10, 6, 6, 6, 2, 4, 4, 3, 2, 6, 4, 2, 4, 2, 8, 10,
+  6, 10, 6, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4,
+  8, 8, 10, 1, 12, 38, 10, 10, 6, 2, 2, 3, 3, 4, 4, 4,
+  4, 4, 2, 4, 2, 8, 10, 6, 10, 6, 4, 4, 4, 4, 4, 4,
+  3, 2, 2, 4, 4, 4, 4, 4, 4, 6, 10, 10, 1, 13, 38, 10,
+  10, 8, 8, 8, 8, 8, 4, 4, 4, 2, 4, 2, 4, 2, 8, 10,
+  10, 6, 4, 2, 4, 10, 3, 2, 3, 3, 2, 2, 2, 4, 4, 4,
+  4, 4, 6, 10, 10, 1, 15, 37, 10, 0, 2, 2, 8, 8, 4, 4,
+  10, 10, 2, 4, 2, 8, 10, 6, 6, 2, 2, 6, 10, 3, 3, 2,
+  3, 3, 3, 2, 2, 4, 4, 4, 4, 4, 6, 10, 6, 1, 16, 37,
+  10, 10, 3, 0, 2, 8, 8, 3, 10, 2, 10, 10, 8, 10, 6, 4,
+  2, 2, 4, 6, 10, 10, 8, 4, 2, 3, 3, 2, 2, 2, 4, 4,
+  4, 4, 10, 10, 10, 1, 19, 35, 10, 2, 8, 10, 8, 8, 10, 0,
+  3, 10, 10, 10, 10, 4, 3, 2, 4, 6, 6, 8, 8, 8, 8, 2,
+  3, 3, 2, 2, 4, 4, 4, 4, 4, 10, 10, 2, 22, 7, 10, 10,
+  10, 10, 0, 3, 10, 2, 24, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 8, 4, 3, 3, 2, 4, 2, 4, 4, 4, 6, 10, 2,
+  25, 3, 10, 10, 10, 15, 14, 10, 10, 8, 4, 3, 3, 2, 10, 10,
+  4, 4, 10, 10, 10, 1, 45, 13, 10, 10, 4, 2, 10, 0, 2, 2,
+  4, 4, 4, 10, 10, 1, 47, 13, 10, 10, 10, 0, 3, 2, 4, 4,
+  6, 4, 6, 10, 10, 1, 49, 13, 8, 8, 0, 3, 4, 8, 6, 4,
+  2, 6, 10, 10, 8, 1, 50, 13, 8, 8, 10, 8, 6, 6, 10, 2,
+  6, 8, 6, 8, 8, 1, 52, 12, 8, 8, 6, 10, 10, 4, 4, 8,
+  8, 6, 10, 8, 1, 56, 10, 10, 10, 10, 4, 6, 10, 6, 10, 10,
+  10, 1, 58, 10, 10, 10, 6, 4, 8, 8, 6, 6, 10, 8, 1, 60,
+  9, 10, 10, 10, 4, 6, 10, 8, 6, 10, 1, 62, 8, 10, 10, 10,
+  4, 8, 6, 8, 8, 1, 64, 7, 10, 10, 10, 6, 10, 10, 8, 1,
+  66, 6, 10, 8, 10, 6, 10, 8, 1, 67, 6, 10, 10, 10, 8, 10,
+  8, 1, 69, 5, 10, 10, 10, 10, 8, 1, 70, 5, 10, 10, 10, 10,
+  8, 1, 71, 5, 6, 10, 10, 10, 10, 1, 73, 3, 10, 10, 10, 1,
+  74, 3, 10, 10, 10, 1, 75, 2, 10, 10, 1, 75, 2, 10, 10, 1,
+  47, 4, 10, 10, 10, 10, 1, 46, 6, 10, 10, 3, 8, 10, 10, 1,
+  45, 7, 10, 10, 3, 3, 8, 8, 10, 1, 43, 9, 10, 10, 10, 10,
+  2, 4, 2, 8, 8, 1, 41, 11, 10, 10, 10, 10, 2, 2, 4, 4,
+  4, 6, 8, 1, 39, 13, 10, 10, 10, 6, 3, 10, 3, 4, 8, 4,
+  4, 6, 8, 1, 35, 16, 10, 10, 10, 10, 10, 10, 10, 10, 3, 3,
+  8, 4, 6, 6, 8, 10, 2, 28, 23, 10, 10, 10, 10, 10, 10, 10,
+  10, 3, 4, 4, 4, 4, 4, 4, 6, 10, 6, 8, 4, 8, 10, 10,
+  3, 4, 10, 10, 10, 10, 1, 24, 41, 10, 10, 10, 10, 10, 10, 2,
+  2, 2, 3, 3, 3, 4, 10, 4, 6, 6, 6, 6, 10, 10, 6, 8,
+  10, 10, 10, 10, 10, 10, 10, 10, 3, 2, 6, 10, 10, 10, 6, 10,
+  10, 10, 1, 21, 49, 10, 10, 10, 10, 10, 10, 8, 4, 2, 4, 3,
+  3, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 4, 4, 4, 4, 8, 3, 2, 4, 8, 4, 4, 4, 6, 4,
+  10, 10, 10, 10, 10, 10, 1, 19, 57, 10, 10, 10, 10, 8, 2, 2,
+  2, 8, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8,
+  8, 8, 8, 8, 8, 4, 4, 4, 2, 2, 4, 4, 8, 3, 2, 4,
+  8, 6, 4, 4, 4, 8, 4, 8, 4, 8, 6, 10, 10, 10, 10, 10,
+  10, 10, 1, 18, 63, 10, 8, 10, 2, 2, 2, 2, 8, 8, 4, 4,
+  8, 8, 4, 4, 6, 4, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 2, 2, 2, 2, 2, 2, 2, 8, 8, 4, 4, 8, 6, 6,
+  4, 6, 8, 6, 4, 8, 4, 8, 8, 6, 8, 10, 8, 10, 10, 10,
+  10, 10, 10, 10, 1, 17, 67, 10, 8, 2, 8, 8, 8, 8, 8, 3,
+  3, 10, 10, 0, 0, 10, 8, 4, 4, 4, 4, 2, 2, 4, 4, 4,
+  2, 4, 2, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 6, 4, 4, 8, 4, 8, 8, 4, 8, 4, 4, 8, 6,
+  8, 10, 8, 10, 10, 10, 10, 10, 10, 10, 1, 16, 71, 10, 10, 10,
+  8, 2, 3, 3, 4, 3, 4, 10, 10, 2, 10, 3, 10, 6, 10, 4,
+  3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 4,
+  4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 8, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 4, 8, 1, 10, 1, 1, 10, 5, 44, 10, 8, 10,
+  2, 8, 3, 4, 4, 10, 10, 10, 4, 2, 4, 10, 10, 6, 10, 4,
+  4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
+  4, 4, 4, 10, 10, 10, 10, 10, 10, 19, 8, 10, 10, 10, 10, 10,
+  10, 10, 10, 1, 6, 51, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 8, 2, 4, 4, 4, 4, 4, 4, 4, 2, 2, 4, 4, 2, 8,
+  10, 6, 4, 4, 4, 6, 6, 3, 3, 2, 2, 2, 4, 4, 4, 4,
+  4, 4, 4, 10, 10, 10, 10, 10, 10, 1, 5, 49, 8, 8, 8, 10,
+  6, 6, 6, 8, 8, 10, 10, 10, 8, 8, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 2, 2, 10, 8, 10, 6, 4, 8, 8, 4, 6, 8, 4,
+  4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 1, 4, 47,
+  8, 10, 10, 5, 6, 8, 8, 8, 2, 6, 8, 4, 10, 6, 8, 8,
+  4, 6, 4, 4, 6, 4, 4, 2, 4, 10, 10, 10, 6, 6, 4, 4,
+  8, 6, 8, 4, 4, 4, 8, 8, 8, 8, 10, 10, 10, 10, 10, 1,
+  3, 45, 10, 8, 10, 5, 7, 1, 10, 10, 10, 10, 8, 6, 6, 4,
+  10, 6, 3, 4, 10, 6, 4, 6, 6, 4, 4, 10, 8, 8, 10, 6,
+  4, 4, 6, 10, 10, 8, 8, 8, 8, 8, 10, 10, 10, 10, 10, 1,
+  3, 43, 10, 8, 5, 8, 1, 10, 10, 10, 9, 1, 8, 2, 6, 4,
+  10, 6, 2, 3, 10, 6, 4, 10, 6, 4, 4, 4, 4, 10, 4, 4,
+  4, 4, 4, 4, 10, 10, 10, 6, 10, 8, 6, 10, 10, 1, 2, 44,
+  10, 8, 10, 5, 7, 10, 10, 9, 9, 9, 10, 7, 2, 6, 4, 10,
+  10, 6, 2, 3, 10, 2, 10, 6, 4, 4, 4, 10, 4, 4, 4, 4,
+  2, 4, 4, 6, 10, 10, 6, 8, 6, 8, 10, 10, 1, 1, 45, 10,
+  5, 10, 5, 8, 1, 10, 10, 9, 9, 9, 10, 7, 8, 6, 6, 4,
+  10, 6, 2, 4, 10, 4, 10, 4, 4, 4, 4, 4, 4, 4, 4, 3,
+  2, 2, 4, 6, 10, 10, 10, 8, 6, 8, 10, 10, 1, 0, 45, 10,
+  2, 10, 8, 5, 8, 7, 10, 10, 9, 9, 9, 10, 1, 8, 2, 6,
+  4, 8, 6, 2, 4, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 3,
+  3, 2, 2, 4, 6, 10, 10, 8, 8, 8, 8, 10, 1, 0, 45, 10,
+  2, 10, 8, 5, 8, 1, 10, 10, 9, 9, 9, 10, 7, 8, 2, 6,
+  4, 8, 6, 2, 4, 4, 2, 10, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 3, 2, 4, 6, 10, 10, 10, 10, 10, 8, 10, 1, 1, 47, 10,
+  5, 10, 5, 8, 7, 10, 10, 9, 9, 9, 10, 1, 8, 2, 6, 4,
+  8, 6, 2, 4, 10, 2, 10, 6, 4, 4, 4, 4, 10, 6, 10, 4,
+  4, 4, 4, 6, 10, 6, 6, 8, 8, 10, 10, 10, 10, 10, 1, 2,
+  51, 10, 8, 10, 5, 1, 10, 10, 10, 9, 9, 10, 7, 8, 2, 6,
+  4, 10, 6, 2, 3, 10, 4, 10, 6, 4, 10, 10, 4, 10, 10, 4,
+  10, 4, 4, 6, 10, 8, 6, 6, 6, 8, 8, 8, 8, 8, 8, 8,
+  10, 10, 10, 10, 1, 3, 59, 10, 10, 10, 5, 7, 10, 10, 9, 10,
+  10, 7, 8, 6, 4, 8, 10, 8, 3, 10, 6, 4, 6, 4, 4, 2,
+  10, 10, 4, 10, 4, 10, 4, 4, 10, 10, 8, 8, 4, 6, 6, 6,
+  6, 6, 6, 4, 8, 8, 8, 4, 10, 10, 10, 10, 10, 8, 10, 10,
+  10, 10, 1, 4, 67, 8, 10, 10, 1, 10, 10, 10, 10, 1, 8, 2,
+  6, 4, 10, 8, 2, 3, 6, 4, 4, 6, 4, 4, 4, 2, 10, 10,
+  8, 10, 10, 4, 4, 8, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 3, 4, 4, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 1, 4, 72, 10, 10, 8, 6, 6,
+  6, 10, 8, 8, 2, 8, 4, 4, 10, 8, 3, 8, 4, 4, 4, 4,
+  4, 2, 2, 4, 10, 3, 0, 10, 10, 6, 4, 4, 4, 4, 4, 3,
+  3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 4, 4,
+  8, 3, 2, 4, 8, 6, 4, 4, 6, 4, 8, 4, 8, 10, 10, 10,
+  10, 10, 10, 2, 4, 1, 10, 1, 75, 8, 10, 10, 10, 10, 6, 6,
+  8, 10, 10, 10, 2, 2, 3, 8, 4, 4, 4, 2, 2, 4, 4, 2,
+  2, 10, 3, 10, 6, 6, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2,
+  2, 2, 2, 3, 3, 3, 3, 2, 2, 2, 2, 4, 8, 3, 2, 4,
+  8, 6, 6, 6, 8, 4, 6, 4, 4, 6, 6, 8, 8, 8, 6, 10,
+  10, 10, 10, 10, 3, 6, 1, 10, 4, 1, 10, 4, 70, 10, 10, 10,
+  8, 8, 3, 3, 10, 4, 4, 2, 2, 4, 4, 10, 10, 8, 6, 4,
+  4, 3, 3, 2, 2, 2, 2, 3, 3, 3, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 8, 3, 4, 8, 6, 4, 6, 4, 4, 8,
+  4, 8, 4, 10, 8, 8, 6, 10, 8, 8, 10, 8, 10, 10, 10, 10,
+  10, 10, 10, 1, 19, 70, 10, 10, 10, 10, 10, 8, 10, 4, 4, 4,
+  10, 10, 6, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 10, 8, 8, 8, 8, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 8,
+  10, 10, 10, 8, 10, 10, 10, 10, 10, 10, 10, 10, 2, 25, 27, 8,
+  8, 8, 8, 8, 8, 10, 10, 10, 4, 4, 4, 8, 8, 10, 10, 10,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 10, 22, 15, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 76, 1, 10, 1,
+  75, 2, 10, 10, 1, 75, 2, 10, 10, 1, 74, 3, 10, 10, 10, 1,
+  73, 3, 10, 10, 10, 1, 71, 5, 6, 10, 10, 10, 10, 1, 70, 5,
+  10, 10, 10, 10, 8, 1, 69, 5, 10, 10, 10, 10, 8, 1, 67, 6,
+  10, 10, 10, 8, 10, 8, 1, 66, 6, 10, 8, 10, 6, 10, 8, 1,
+  64, 7, 10, 10, 10, 6, 10, 10, 8, 1, 62, 8, 10, 10, 10, 4,
+  8, 6, 8, 8, 1, 60, 9, 10, 10, 10, 4, 6, 10, 8, 6, 10,
+  1, 58, 10, 10, 10, 6, 4, 8, 8, 6, 6, 10, 8, 1, 56, 10,
+  10, 10, 10, 4, 6, 10, 6, 10, 10, 10, 1, 52, 12, 8, 8, 6,
+  10, 10, 4, 4, 8, 8, 6, 10, 8, 1, 50, 13, 8, 8, 10, 8,
+  6, 6, 10, 2, 6, 8, 6, 8, 8, 1, 49, 13, 8, 8, 0, 3,
+  4, 8, 6, 4, 2, 6, 10, 10, 8, 1, 47, 13, 10, 10, 10, 0,
+  3, 2, 4, 4, 6, 4, 6, 10, 10, 1, 45, 13, 10, 10, 4, 2,
+  10, 0, 2, 2, 4, 4, 4, 10, 10, 2, 25, 3, 10, 10, 10, 15,
+  14, 10, 10, 8, 4, 3, 3, 2, 10, 10, 4, 4, 10, 10, 10, 2,
+  22, 7, 10, 10, 10, 10, 0, 3, 10, 2, 24, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 8, 4, 3, 3, 2, 4, 2, 4, 4,
+  4, 6, 10, 1, 19, 35, 10, 2, 8, 10, 8, 8, 10, 0, 3, 10,
+  10, 10, 10, 4, 3, 2, 4, 6, 6, 8, 8, 8, 8, 2, 3, 3,
+  2, 2, 4, 4, 4, 4, 4, 10, 10, 1, 16, 37, 10, 10, 3, 0,
+  2, 8, 8, 3, 10, 2, 10, 10, 8, 10, 6, 4, 2, 2, 4, 6,
+  10, 10, 8, 4, 2, 3, 3, 2, 2, 2, 4, 4, 4, 4, 10, 10,
+  10, 1, 15, 37, 10, 0, 2, 2, 8, 8, 4, 4, 10, 10, 2, 4,
+  2, 8, 10, 6, 6, 2, 2, 6, 10, 3, 3, 2, 3, 3, 3, 2,
+  2, 4, 4, 4, 4, 4, 6, 10, 6, 1, 13, 38, 10, 10, 8, 8,
+  8, 8, 8, 4, 4, 4, 2, 4, 2, 4, 2, 8, 10, 10, 6, 4,
+  2, 4, 10, 3, 2, 3, 3, 2, 2, 2, 4, 4, 4, 4, 4, 6,
+  10, 10, 1, 12, 38, 10, 10, 6, 2, 2, 3, 3, 4, 4, 4, 4,
+  4, 2, 4, 2, 8, 10, 6, 10, 6, 4, 4, 4, 4, 4, 4, 3,
+  2, 2, 4, 4, 4, 4, 4, 4, 6, 10, 10, 1, 10, 38, 10, 10,
+  10, 10, 6, 6, 6, 2, 4, 4, 3, 2, 6, 4, 2, 4, 2, 8,
+  10, 6, 10, 6, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4, 4, 4,
+  4, 8, 8, 10, 1, 8, 39, 10, 10, 6, 2, 2, 10, 10, 10, 6,
+  2, 2, 4, 4, 2, 8, 6, 4, 4, 2, 8, 10, 4, 10, 4, 4,
+  4, 4, 4, 10, 4, 4, 4, 4, 4, 4, 4, 8, 10, 10, 1, 5,
+  42, 10, 5, 6, 8, 8, 7, 7, 8, 6, 4, 10, 8, 10, 2, 6,
+  10, 4, 2, 8, 6, 4, 4, 10, 4, 10, 8, 4, 2, 4, 4, 4,
+  6, 10, 4, 4, 10, 4, 8, 8, 10, 10, 10, 1, 4, 44, 8, 5,
+  7, 1, 10, 10, 9, 1, 7, 2, 6, 4, 8, 8, 10, 2, 6, 10,
+  2, 10, 6, 4, 4, 4, 10, 8, 4, 4, 2, 2, 4, 4, 6, 10,
+  10, 4, 10, 8, 8, 10, 8, 8, 10, 10, 1, 3, 46, 10, 8, 8,
+  1, 10, 10, 10, 9, 10, 7, 2, 6, 6, 4, 10, 10, 3, 3, 10,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 2, 3, 2, 4, 4, 6,
+  10, 10, 8, 10, 6, 8, 8, 8, 8, 10, 10, 1, 2, 47, 10, 10,
+  8, 7, 10, 10, 10, 9, 9, 10, 7, 8, 2, 6, 4, 10, 6, 4,
+  3, 4, 4, 2, 10, 6, 4, 4, 4, 4, 2, 3, 3, 3, 2, 4,
+  4, 6, 10, 10, 10, 6, 6, 8, 6, 4, 8, 10, 10, 1, 2, 47,
+  10, 8, 10, 1, 10, 10, 10, 9, 9, 10, 1, 8, 2, 6, 6, 10,
+  10, 4, 4, 6, 8, 2, 10, 6, 4, 4, 10, 8, 8, 4, 2, 2,
+  2, 4, 4, 6, 10, 10, 6, 6, 8, 8, 6, 4, 4, 8, 10, 1,
+  1, 48, 10, 10, 8, 5, 7, 10, 10, 10, 9, 9, 10, 7, 8, 6,
+  2, 6, 4, 10, 4, 4, 4, 8, 2, 6, 4, 10, 10, 8, 10, 8,
+  4, 4, 2, 4, 4, 6, 10, 10, 10, 6, 8, 8, 6, 6, 6, 4,
+  8, 10, 1, 1, 48, 10, 5, 10, 5, 8, 7, 10, 10, 9, 9, 9,
+  10, 7, 8, 2, 6, 4, 8, 4, 4, 4, 6, 4, 6, 4, 2, 10,
+  8, 6, 10, 8, 4, 2, 4, 4, 6, 10, 10, 10, 10, 10, 8, 8,
+  8, 6, 6, 8, 10, 1, 0, 50, 10, 2, 10, 8, 5, 8, 1, 10,
+  10, 9, 9, 9, 10, 1, 8, 2, 6, 4, 8, 4, 10, 4, 6, 4,
+  6, 2, 4, 2, 2, 10, 6, 10, 8, 4, 4, 4, 6, 10, 10, 10,
+  8, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 0, 55, 10, 2, 10,
+  8, 5, 8, 7, 10, 10, 9, 9, 9, 10, 7, 8, 6, 6, 4, 8,
+  10, 10, 4, 4, 4, 6, 4, 2, 4, 4, 8, 10, 6, 6, 4, 4,
+  10, 10, 10, 6, 6, 6, 8, 8, 8, 8, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 2, 1, 64, 10, 5, 10, 10, 8, 1, 10, 10, 10,
+  9, 10, 10, 7, 8, 6, 4, 4, 10, 8, 2, 4, 4, 4, 2, 2,
+  4, 2, 2, 4, 8, 10, 6, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 6, 6, 6, 6, 6, 8, 8, 8, 8, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 1, 2, 85, 10, 8, 10, 10, 5, 7, 10, 10, 9, 10,
+  1, 8, 6, 6, 4, 10, 8, 6, 10, 4, 4, 4, 4, 4, 2, 4,
+  4, 10, 3, 10, 6, 4, 2, 4, 4, 4, 4, 2, 2, 2, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 6, 6, 6, 6, 10, 10, 4, 4,
+  4, 6, 6, 6, 10, 10, 10, 10, 10, 10, 10, 10, 8, 10, 10, 8,
+  10, 8, 10, 10, 8, 10, 10, 10, 10, 10, 10, 1, 3, 84, 10, 10,
+  10, 8, 6, 1, 10, 10, 8, 8, 6, 6, 10, 6, 10, 8, 10, 10,
+  3, 4, 4, 4, 2, 4, 10, 10, 0, 3, 10, 6, 4, 2, 4, 2,
+  2, 2, 2, 3, 3, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 6, 3, 4, 4, 8, 6, 4, 4, 6, 10, 8,
+  4, 10, 6, 10, 6, 8, 6, 10, 10, 8, 10, 10, 10, 10, 10, 10,
+  10, 10, 1, 4, 77, 10, 10, 8, 10, 10, 6, 6, 6, 6, 5, 10,
+  10, 10, 10, 10, 10, 0, 3, 4, 4, 4, 4, 10, 6, 6, 10, 10,
+  6, 4, 4, 4, 2, 4, 4, 2, 2, 3, 3, 3, 3, 3, 2, 2,
+  2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 6, 3, 2, 4, 8,
+  6, 4, 10, 8, 10, 6, 4, 8, 6, 8, 8, 10, 8, 10, 8, 10,
+  10, 10, 2, 6, 9, 10, 10, 10, 10, 10, 5, 10, 10, 10, 2, 60,
+  10, 10, 6, 10, 10, 3, 0, 3, 4, 4, 4, 4, 6, 6, 4, 4,
+  4, 8, 4, 2, 2, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 4,
+  4, 4, 4, 4, 6, 6, 6, 6, 8, 6, 3, 2, 8, 8, 6, 4,
+  4, 4, 10, 8, 8, 10, 8, 6, 10, 10, 10, 10, 2, 11, 1, 10,
+  9, 49, 10, 10, 10, 10, 10, 10, 10, 3, 3, 4, 4, 8, 8, 8,
+  8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 6, 6,
+  6, 6, 6, 6, 6, 8, 10, 8, 8, 8, 8, 10, 10, 10, 4, 10,
+  10, 10, 10, 1, 25, 37, 10, 10, 10, 10, 10, 10, 10, 8, 8, 8,
+  6, 10, 6, 6, 6, 6, 8, 8, 8, 8, 8, 8, 8, 8, 8, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 29, 21, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 6, 8, 1, 42, 8, 10, 10, 10, 4, 6, 6, 8, 8, 1, 44,
+  6, 10, 10, 4, 4, 8, 10, 1, 74, 7, 10, 10, 10, 10, 10, 10,
+  10, 1, 69, 12, 10, 10, 10, 10, 10, 8, 10, 10, 10, 10, 10, 10,
+  1, 61, 18, 10, 8, 10, 10, 10, 10, 10, 10, 10, 8, 10, 10, 8,
+  8, 10, 10, 10, 10, 1, 56, 19, 10, 8, 10, 8, 10, 2, 10, 4,
+  8, 8, 4, 8, 8, 10, 10, 8, 10, 10, 10, 1, 51, 21, 10, 10,
+  10, 10, 10, 2, 2, 8, 2, 10, 4, 8, 10, 10, 6, 8, 10, 8,
+  8, 10, 10, 1, 49, 20, 8, 10, 0, 10, 6, 2, 8, 3, 4, 8,
+  8, 8, 4, 6, 6, 6, 10, 10, 10, 10, 1, 46, 20, 10, 10, 8,
+  8, 0, 3, 4, 10, 6, 4, 4, 8, 4, 4, 8, 6, 6, 10, 10,
+  10, 2, 26, 3, 10, 10, 10, 13, 22, 10, 10, 10, 8, 8, 8, 4,
+  8, 3, 2, 4, 4, 10, 4, 8, 4, 4, 8, 6, 10, 10, 10, 2,
+  23, 6, 10, 10, 10, 0, 0, 10, 10, 22, 10, 10, 10, 8, 8, 8,
+  3, 2, 2, 4, 8, 8, 2, 4, 4, 4, 4, 4, 6, 6, 10, 10,
+  1, 21, 37, 10, 10, 10, 4, 2, 10, 3, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 8, 8, 8, 4, 3, 3, 2, 2, 4, 4, 4,
+  4, 4, 6, 4, 4, 10, 10, 6, 1, 18, 37, 10, 10, 8, 10, 4,
+  2, 2, 4, 2, 8, 10, 10, 8, 8, 10, 10, 8, 8, 8, 8, 8,
+  4, 3, 3, 3, 2, 2, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10,
+  2, 6, 5, 10, 10, 10, 10, 10, 4, 38, 10, 10, 10, 8, 8, 8,
+  4, 2, 4, 4, 2, 8, 10, 8, 10, 6, 4, 4, 10, 8, 4, 4,
+  3, 3, 3, 2, 2, 4, 4, 4, 4, 4, 4, 4, 6, 6, 10, 10,
+  1, 4, 47, 10, 10, 8, 10, 6, 6, 6, 6, 8, 10, 10, 10, 2,
+  2, 3, 8, 3, 4, 4, 2, 2, 8, 10, 10, 8, 6, 4, 4, 10,
+  8, 4, 4, 3, 3, 2, 2, 4, 4, 4, 4, 4, 4, 4, 10, 10,
+  10, 10, 1, 4, 45, 8, 10, 10, 1, 10, 10, 8, 8, 2, 8, 4,
+  4, 10, 8, 3, 8, 4, 2, 4, 8, 10, 10, 6, 10, 6, 4, 4,
+  4, 4, 4, 4, 3, 2, 2, 2, 4, 4, 4, 4, 4, 4, 6, 10,
+  10, 10, 1, 3, 44, 10, 10, 10, 5, 7, 10, 9, 10, 1, 8, 2,
+  6, 4, 10, 8, 2, 3, 6, 2, 2, 4, 10, 4, 6, 4, 4, 4,
+  3, 2, 4, 4, 4, 4, 2, 4, 4, 4, 4, 4, 6, 6, 10, 10,
+  10, 1, 2, 43, 10, 8, 10, 5, 1, 10, 10, 9, 10, 10, 7, 8,
+  6, 4, 8, 10, 8, 3, 10, 4, 2, 4, 4, 4, 4, 4, 4, 4,
+  3, 3, 2, 4, 4, 4, 2, 4, 4, 4, 8, 6, 10, 10, 10, 1,
+  1, 42, 10, 5, 10, 5, 8, 7, 10, 10, 9, 9, 10, 1, 8, 2,
+  6, 4, 10, 6, 2, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  3, 2, 4, 4, 6, 4, 4, 10, 10, 10, 10, 10, 1, 0, 41, 10,
+  2, 10, 8, 5, 8, 1, 10, 10, 9, 9, 10, 7, 8, 2, 6, 4,
+  8, 6, 2, 4, 4, 4, 4, 4, 4, 4, 6, 4, 4, 4, 3, 2,
+  4, 10, 8, 10, 10, 10, 10, 10, 1, 0, 41, 10, 2, 10, 8, 5,
+  8, 7, 10, 10, 9, 9, 10, 1, 8, 2, 6, 4, 8, 6, 2, 4,
+  4, 2, 4, 10, 10, 10, 6, 8, 10, 4, 4, 2, 4, 10, 10, 10,
+  8, 10, 8, 10, 1, 1, 40, 10, 5, 10, 5, 8, 1, 10, 10, 9,
+  9, 10, 7, 8, 2, 6, 4, 8, 6, 2, 4, 4, 2, 4, 2, 2,
+  10, 10, 8, 10, 4, 4, 2, 4, 10, 10, 6, 6, 6, 8, 10, 1,
+  2, 39, 10, 8, 10, 5, 7, 10, 10, 9, 9, 10, 7, 8, 6, 6,
+  4, 10, 6, 2, 4, 4, 4, 4, 4, 4, 2, 2, 8, 8, 8, 4,
+  2, 4, 10, 10, 6, 6, 8, 8, 10, 1, 3, 39, 10, 8, 5, 8,
+  1, 10, 10, 9, 10, 1, 2, 6, 4, 10, 10, 6, 2, 3, 4, 4,
+  2, 2, 2, 4, 4, 2, 10, 8, 4, 2, 4, 8, 10, 10, 10, 10,
+  10, 10, 10, 2, 3, 45, 10, 8, 10, 5, 7, 10, 10, 9, 9, 8,
+  2, 6, 4, 10, 6, 2, 3, 10, 4, 4, 10, 10, 4, 2, 2, 10,
+  3, 10, 4, 4, 4, 4, 10, 8, 8, 8, 8, 8, 10, 10, 10, 10,
+  10, 10, 10, 19, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 1, 4,
+  71, 8, 10, 10, 5, 1, 8, 10, 10, 6, 6, 6, 4, 10, 6, 3,
+  4, 10, 4, 4, 4, 8, 8, 8, 10, 0, 3, 10, 4, 4, 4, 4,
+  10, 8, 8, 6, 6, 8, 8, 8, 8, 8, 8, 8, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 8, 10, 10, 10, 10, 10, 1, 5, 67, 8, 8, 8, 10, 6,
+  8, 6, 6, 8, 4, 10, 6, 8, 8, 4, 6, 4, 4, 4, 4, 4,
+  4, 8, 8, 10, 10, 4, 4, 2, 4, 4, 8, 4, 4, 4, 4, 4,
+  4, 4, 4, 6, 6, 8, 8, 8, 6, 4, 4, 4, 8, 6, 8, 4,
+  10, 6, 10, 8, 6, 6, 8, 10, 8, 10, 8, 10, 10, 10, 1, 6,
+  64, 10, 10, 10, 10, 6, 8, 8, 10, 10, 10, 8, 8, 4, 6, 10,
+  10, 10, 2, 4, 4, 4, 4, 10, 4, 10, 4, 4, 4, 4, 4, 8,
+  4, 4, 4, 2, 2, 4, 4, 4, 4, 4, 6, 6, 4, 4, 6, 2,
+  4, 8, 10, 6, 6, 8, 6, 10, 10, 6, 8, 10, 8, 10, 10, 10,
+  10, 1, 8, 58, 10, 10, 10, 10, 10, 10, 10, 10, 8, 2, 6, 6,
+  8, 8, 8, 8, 8, 4, 4, 4, 10, 4, 10, 4, 2, 2, 4, 4,
+  4, 2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 6, 6,
+  2, 2, 4, 8, 10, 6, 8, 4, 6, 10, 10, 10, 10, 10, 1, 15,
+  47, 10, 8, 10, 6, 8, 3, 3, 2, 2, 2, 8, 2, 4, 4, 4,
+  4, 2, 2, 4, 4, 4, 4, 4, 4, 4, 4, 2, 2, 4, 4, 4,
+  4, 4, 4, 6, 6, 6, 8, 2, 2, 8, 10, 10, 10, 10, 10, 10,
+  1, 15, 41, 10, 10, 4, 6, 8, 8, 0, 3, 3, 2, 8, 2, 2,
+  4, 2, 2, 4, 4, 4, 4, 8, 8, 8, 8, 8, 4, 4, 4, 4,
+  8, 8, 6, 6, 10, 10, 10, 10, 10, 10, 10, 10, 1, 17, 35, 6,
+  8, 8, 10, 10, 10, 10, 0, 8, 10, 2, 4, 10, 4, 4, 4, 8,
+  8, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 10, 10, 10, 10, 10,
+  10, 10, 1, 23, 23, 10, 10, 10, 10, 3, 10, 6, 6, 6, 4, 4,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 8, 1, 26, 16, 10,
+  10, 10, 6, 3, 2, 4, 4, 8, 8, 8, 6, 6, 8, 10, 10, 1,
+  29, 13, 10, 10, 6, 6, 2, 4, 8, 8, 4, 6, 8, 10, 10, 1,
+  30, 11, 6, 6, 10, 2, 4, 4, 4, 6, 6, 8, 10, 1, 32, 9,
+  10, 6, 6, 6, 4, 4, 6, 8, 10, 1, 33, 8, 10, 4, 4, 4,
+  4, 6, 10, 10, 1, 33, 8, 10, 10, 2, 4, 4, 8, 10, 10, 1,
+  34, 7, 10, 2, 2, 4, 4, 8, 10, 1, 34, 6, 10, 10, 4, 2,
+  2, 8, 1, 34, 6, 10, 10, 2, 4, 8, 8, 1, 35, 5, 10, 10,
+  2, 8, 10, 1, 23, 1, 6, 1, 22, 3, 9, 5, 8, 2, 14, 12,
+  9, 9, 9, 9, 9, 9, 9, 9, 8, 8, 8, 11, 3, 1, 11, 3,
+  5, 2, 6, 9, 2, 27, 9, 6, 4, 5, 5, 4, 5, 5, 5, 4,
+  4, 4, 2, 4, 2, 4, 5, 5, 6, 8, 5, 5, 9, 5, 6, 9,
+  8, 1, 1, 11, 2, 2, 39, 10, 6, 6, 6, 5, 9, 9, 9, 4,
+  2, 2, 5, 5, 5, 4, 2, 2, 2, 3, 2, 2, 2, 2, 2, 4,
+  4, 4, 4, 2, 6, 5, 9, 5, 6, 6, 8, 9, 9, 10, 1, 1,
+  10, 3, 1, 32, 9, 9, 5, 9, 9, 6, 6, 5, 9, 5, 4, 4,
+  4, 4, 6, 5, 4, 4, 4, 2, 4, 5, 5, 5, 5, 6, 9, 9,
+  5, 6, 9, 9, 1, 1, 9, 2, 6, 9, 9, 9, 9, 10, 10, 1,
+  0, 27, 5, 6, 5, 6, 10, 9, 7, 5, 5, 6, 5, 4, 4, 2,
+  5, 10, 5, 4, 9, 9, 8, 8, 10, 11, 11, 11, 11, 1, 0, 25,
+  9, 6, 5, 9, 9, 9, 7, 4, 5, 5, 4, 5, 5, 5, 10, 6,
+  4, 4, 9, 11, 9, 8, 6, 5, 10, 1, 1, 24, 10, 7, 9, 10,
+  9, 5, 5, 6, 5, 4, 4, 6, 4, 5, 4, 2, 2, 5, 11, 6,
+  8, 5, 5, 11, 1, 2, 22, 8, 4, 9, 7, 5, 5, 8, 5, 5,
+  5, 5, 4, 5, 2, 2, 2, 6, 9, 8, 9, 8, 9, 1, 3, 21,
+  5, 9, 5, 5, 9, 5, 4, 4, 5, 4, 5, 8, 5, 4, 4, 6,
+  4, 5, 5, 9, 11, 1, 6, 19, 9, 6, 4, 4, 2, 4, 2, 5,
+  9, 6, 4, 4, 4, 2, 4, 4, 4, 6, 11, 1, 7, 19, 6, 4,
+  5, 4, 4, 4, 4, 9, 6, 2, 5, 4, 3, 3, 2, 4, 4, 6,
+  11, 1, 9, 18, 2, 5, 8, 5, 4, 9, 6, 2, 4, 9, 5, 4,
+  2, 2, 4, 4, 5, 9, 4, 12, 2, 9, 4, 2, 1, 9, 2, 1,
+  11, 1, 7, 9, 5, 2, 2, 5, 5, 9, 1, 23, 6, 6, 5, 2,
+  2, 5, 6, 1, 25, 6, 5, 4, 6, 4, 6, 9, 1, 27, 5, 9,
+  9, 5, 6, 9, 1, 30, 4, 6, 6, 6, 8, 1, 32, 3, 6, 6,
+  9, 1, 33, 3, 9, 9, 9, 1, 35, 2, 9, 9, 1, 36, 2, 10,
+  10, 1, 23, 3, 9, 6, 11, 1, 22, 4, 11, 4, 2, 9, 1, 20,
+  6, 11, 6, 4, 4, 4, 6, 2, 15, 1, 9, 1, 9, 7, 5, 5,
+  5, 4, 5, 5, 6, 11, 1, 11, 22, 11, 9, 9, 5, 2, 2, 4,
+  6, 6, 6, 9, 10, 9, 9, 5, 6, 4, 4, 6, 5, 6, 9, 1,
+  9, 31, 9, 6, 5, 4, 5, 4, 4, 4, 4, 4, 5, 5, 5, 5,
+  4, 2, 2, 4, 5, 4, 5, 4, 5, 5, 5, 8, 6, 9, 9, 10,
+  11, 1, 8, 35, 11, 6, 4, 4, 4, 6, 4, 5, 6, 2, 2, 2,
+  2, 2, 2, 2, 3, 2, 2, 4, 4, 5, 6, 6, 6, 6, 6, 6,
+  8, 9, 9, 9, 10, 10, 10, 3, 3, 3, 10, 11, 9, 1, 22, 11,
+  9, 5, 4, 4, 5, 4, 2, 6, 9, 4, 4, 4, 3, 2, 2, 2,
+  4, 5, 6, 9, 9, 11, 3, 10, 10, 11, 1, 2, 24, 9, 6, 6,
+  6, 6, 6, 8, 5, 4, 4, 4, 2, 4, 9, 6, 5, 6, 5, 4,
+  5, 5, 5, 9, 10, 1, 1, 23, 9, 8, 5, 6, 9, 5, 5, 6,
+  5, 5, 5, 6, 4, 5, 6, 4, 4, 6, 8, 8, 9, 11, 11, 1,
+  1, 22, 9, 6, 6, 10, 9, 7, 5, 6, 6, 2, 5, 5, 4, 4,
+  4, 2, 2, 5, 11, 6, 8, 9, 1, 0, 23, 5, 6, 5, 7, 10,
+  9, 6, 5, 5, 5, 4, 4, 4, 4, 4, 4, 2, 2, 5, 11, 9,
+  8, 9, 1, 1, 25, 9, 5, 6, 11, 9, 7, 5, 5, 6, 4, 5,
+  6, 5, 5, 6, 5, 4, 6, 9, 6, 9, 9, 9, 9, 11, 2, 2,
+  30, 9, 5, 9, 9, 5, 5, 6, 5, 4, 5, 5, 4, 6, 6, 6,
+  4, 6, 5, 4, 5, 5, 4, 5, 5, 5, 5, 6, 5, 6, 10, 2,
+  1, 10, 2, 2, 36, 10, 6, 9, 9, 5, 6, 5, 4, 4, 4, 2,
+  2, 4, 4, 9, 5, 3, 2, 3, 2, 2, 2, 2, 2, 2, 2, 4,
+  2, 5, 5, 5, 5, 5, 9, 9, 9, 1, 1, 10, 1, 9, 35, 8,
+  7, 5, 5, 2, 4, 9, 5, 4, 2, 2, 4, 2, 4, 4, 4, 5,
+  5, 5, 6, 5, 6, 6, 6, 6, 6, 9, 9, 9, 9, 9, 9, 10,
+  10, 10, 1, 37, 2, 10, 10, 1, 37, 1, 10, 1, 35, 3, 9, 9,
+  9, 1, 34, 3, 9, 9, 9, 1, 33, 3, 9, 9, 8, 1, 31, 4,
+  6, 6, 6, 9, 1, 29, 5, 6, 6, 6, 9, 9, 1, 25, 7, 8,
+  8, 9, 5, 5, 8, 9, 1, 24, 7, 9, 2, 2, 5, 4, 9, 9,
+  2, 13, 1, 9, 8, 7, 9, 4, 4, 4, 4, 5, 9, 1, 10, 17,
+  5, 9, 6, 2, 9, 9, 5, 5, 10, 9, 8, 5, 2, 2, 2, 4,
+  6, 1, 8, 18, 5, 4, 4, 5, 5, 4, 9, 6, 2, 5, 5, 4,
+  3, 2, 2, 4, 5, 9, 1, 6, 19, 11, 5, 4, 5, 4, 4, 2,
+  4, 9, 9, 4, 5, 2, 3, 2, 4, 4, 4, 9, 1, 5, 19, 6,
+  6, 9, 4, 2, 4, 5, 2, 5, 9, 6, 4, 4, 5, 4, 4, 4,
+  6, 9, 1, 2, 22, 6, 5, 9, 7, 5, 5, 8, 5, 5, 5, 5,
+  4, 6, 4, 2, 4, 9, 5, 6, 8, 9, 11, 1, 1, 23, 10, 5,
+  6, 10, 9, 5, 5, 6, 5, 4, 4, 5, 4, 4, 2, 3, 2, 5,
+  11, 9, 6, 5, 8, 1, 1, 23, 9, 7, 11, 10, 9, 6, 5, 6,
+  5, 4, 5, 5, 5, 9, 5, 2, 4, 6, 11, 6, 8, 5, 5, 1,
+  0, 25, 6, 6, 5, 7, 9, 9, 7, 5, 5, 5, 5, 5, 4, 4,
+  6, 9, 4, 4, 10, 11, 9, 9, 9, 9, 11, 5, 0, 28, 5, 6,
+  6, 7, 11, 9, 7, 6, 5, 8, 5, 4, 4, 2, 4, 9, 5, 4,
+  5, 5, 5, 5, 6, 9, 9, 9, 10, 11, 1, 1, 9, 1, 1, 11,
+  6, 1, 10, 2, 1, 10, 1, 1, 42, 9, 9, 5, 7, 9, 5, 6,
+  6, 9, 4, 4, 2, 5, 4, 5, 5, 2, 2, 2, 2, 2, 2, 4,
+  4, 4, 5, 5, 5, 4, 4, 6, 6, 9, 6, 9, 9, 8, 9, 9,
+  9, 10, 10, 1, 2, 37, 10, 9, 9, 6, 6, 9, 11, 9, 4, 2,
+  4, 5, 5, 5, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 4, 5,
+  5, 4, 4, 8, 4, 6, 6, 8, 8, 9, 9, 2, 12, 20, 9, 9,
+  5, 5, 8, 8, 5, 5, 5, 5, 5, 5, 6, 9, 9, 9, 10, 8,
+  9, 11, 1, 1, 9, 2, 15, 1, 11, 4, 5, 11, 11, 9, 6, 8,
+  1, 35, 5, 10, 9, 9, 11, 10, 1, 30, 9, 6, 6, 8, 6, 9,
+  9, 9, 9, 11, 1, 25, 10, 5, 9, 5, 4, 5, 5, 6, 9, 9,
+  9, 2, 13, 1, 6, 8, 10, 9, 6, 5, 2, 4, 5, 4, 5, 6,
+  9, 3, 11, 4, 9, 5, 2, 9, 1, 2, 11, 10, 1, 11, 9, 8,
+  5, 4, 2, 4, 4, 4, 5, 6, 9, 2, 4, 1, 9, 3, 19, 6,
+  9, 6, 2, 2, 6, 10, 5, 6, 6, 4, 4, 2, 2, 2, 4, 4,
+  5, 9, 1, 2, 23, 10, 6, 9, 6, 5, 6, 4, 4, 4, 4, 6,
+  10, 5, 4, 5, 2, 3, 2, 4, 4, 4, 6, 11, 1, 1, 22, 9,
+  6, 5, 10, 6, 5, 5, 8, 4, 4, 4, 5, 4, 4, 3, 2, 4,
+  2, 4, 5, 6, 10, 1, 0, 21, 5, 6, 5, 7, 10, 9, 5, 4,
+  6, 5, 2, 4, 4, 4, 4, 2, 2, 6, 6, 9, 11, 1, 0, 21,
+  5, 6, 5, 7, 10, 9, 5, 4, 5, 5, 4, 4, 5, 9, 8, 4,
+  4, 10, 9, 8, 10, 1, 1, 20, 9, 6, 5, 9, 9, 5, 5, 6,
+  4, 2, 4, 2, 2, 6, 5, 2, 9, 9, 9, 10, 2, 2, 23, 9,
+  5, 6, 10, 5, 5, 6, 4, 5, 4, 6, 4, 4, 5, 2, 5, 9,
+  8, 8, 8, 9, 10, 11, 8, 5, 10, 9, 10, 10, 10, 1, 3, 33,
+  9, 9, 6, 8, 9, 8, 5, 9, 5, 4, 5, 6, 5, 2, 4, 5,
+  4, 4, 4, 4, 6, 5, 5, 4, 6, 6, 6, 9, 6, 9, 9, 9,
+  10, 2, 5, 1, 9, 1, 25, 11, 5, 6, 4, 4, 4, 4, 5, 4,
+  2, 4, 4, 4, 2, 2, 4, 4, 4, 6, 4, 5, 10, 6, 9, 11,
+  1, 8, 19, 6, 8, 5, 4, 4, 4, 4, 4, 4, 6, 6, 6, 5,
+  5, 8, 9, 10, 11, 9, 1, 12, 10, 9, 6, 6, 5, 4, 9, 9,
+  9, 11, 11, 1, 15, 6, 6, 5, 4, 5, 6, 10, 1, 16, 5, 9,
+  5, 4, 8, 11, 1, 17, 3, 5, 2, 6, 1, 17, 3, 9, 2, 5,
+  2, 8, 1, 9, 1, 3, 9, 6, 8, 1, 1, 19, 9, 6, 6, 9,
+  4, 5, 5, 5, 2, 2, 2, 4, 5, 5, 5, 6, 6, 9, 9, 3,
+  0, 14, 6, 6, 9, 6, 5, 4, 4, 6, 5, 5, 5, 6, 6, 6,
+  1, 1, 6, 3, 1, 9, 1, 0, 12, 6, 6, 10, 5, 5, 5, 5,
+  5, 2, 9, 9, 6, 1, 1, 11, 6, 6, 5, 5, 4, 5, 5, 4,
+  5, 6, 9, 1, 3, 10, 6, 4, 4, 4, 6, 4, 2, 2, 4, 9,
+  1, 5, 9, 6, 5, 6, 5, 6, 5, 2, 4, 6, 1, 12, 3, 4,
+  4, 6, 1, 14, 3, 6, 6, 6, 1, 16, 2, 9, 9, 1, 10, 2,
+  6, 4, 1, 6, 9, 6, 4, 5, 6, 6, 6, 6, 5, 5, 1, 4,
+  16, 5, 4, 4, 4, 4, 4, 4, 2, 2, 4, 5, 5, 6, 8, 9,
+  9, 1, 1, 12, 6, 6, 8, 4, 4, 4, 6, 5, 4, 4, 5, 6,
+  1, 0, 11, 6, 6, 6, 5, 5, 5, 4, 4, 5, 9, 9, 1, 0,
+  11, 6, 9, 9, 5, 5, 5, 5, 4, 4, 9, 9, 1, 0, 18, 9,
+  9, 6, 5, 5, 4, 4, 6, 4, 4, 4, 4, 4, 4, 5, 6, 6,
+  9, 1, 18, 1, 9, 1, 17, 1, 9, 1, 15, 2, 6, 6, 1, 12,
+  4, 4, 5, 6, 8, 2, 6, 1, 5, 3, 4, 5, 4, 4, 5, 1,
+  3, 10, 9, 4, 4, 4, 6, 4, 4, 2, 4, 6, 1, 2, 10, 6,
+  6, 5, 4, 4, 5, 4, 5, 5, 9, 1, 1, 11, 6, 9, 5, 5,
+  4, 5, 4, 2, 9, 9, 6, 1, 0, 13, 6, 6, 9, 5, 5, 5,
+  4, 6, 5, 6, 6, 6, 9, 1, 1, 19, 9, 6, 6, 9, 4, 4,
+  5, 4, 2, 2, 2, 4, 5, 5, 5, 6, 6, 9, 9, 0, 1, 13,
+  5, 5, 5, 6, 9, 9, 2, 6, 1, 5, 3, 5, 5, 4, 4, 5,
+  6, 1, 1, 11, 9, 6, 6, 5, 4, 6, 5, 4, 2, 4, 5, 1,
+  0, 10, 6, 9, 6, 5, 4, 4, 4, 2, 4, 5, 1, 0, 10, 6,
+  9, 6, 5, 4, 4, 5, 4, 9, 10, 1, 1, 17, 6, 6, 6, 5,
+  4, 5, 4, 5, 5, 5, 6, 5, 6, 9, 9, 9, 9, 1, 3, 12,
+  9, 5, 4, 4, 4, 5, 4, 4, 6, 5, 6, 9, 1, 6, 4, 6,
+  5, 6, 9, 1, 8, 2, 4, 6,
 };
 
 #endif
@@ -8,1134 +8,464 @@
 #define GUN_IDLE_HEIGHT 84
 #define GUN_IDLE_TRANSPARENT_IDX 255
 
-typedef struct { int x, y, w, h; int offset; } gun_idle_frame_t;
+// spans: offset of the frame in gun_idle_spans, lines: index of its first row in gun_idle_lines
+typedef struct { int x, y, w, h; int spans, lines; } gun_idle_frame_t;
 
 static const gun_idle_frame_t gun_idle_frame_info[2] = {
-  { 0, 0, 108, 83, 0 },
-  { 1, 0, 107, 83, 8964 },
+  { 0, 0, 108, 83, 0, 0 },
+  { 1, 0, 107, 83, 3438, 83 },
 };
 
 static const uint16_t gun_idle_palette[256] = {
 61210, 54807, 52692, 46484, 52496, 44303, 44238, 42189, 36243, 38095, 42125, 38031, 42125, 42125, 42125, 40076, 33936, 60366, 44109, 40012, 37963, 37965, 37900, 35786, 35722, 31760, 31630, 33739, 31627, 27728, 27598, 25550, 21390, 54029, 45835, 33609, 37578, 31561, 31561, 31560, 31497, 29518, 29516, 31561, 31496, 29513, 31496, 31496, 29448, 29448, 29448, 27469, 27404, 27402, 25356, 27336, 27335, 25292, 25289, 21325, 19213, 19212, 17164, 23243, 21195, 17099, 17099, 41547, 37450, 33354, 33224, 29258, 29193, 29128, 27015, 25224, 21131, 23112, 21064, 23048, 22984, 24967, 22918, 19082, 19018, 19082, 19018, 16970, 19018, 16970, 19017, 18953, 18950, 18888, 18885, 18889, 16838, 16776, 18822, 14986, 14985, 16969, 14921, 16905, 14857, 14857, 14792, 12873, 12873, 12808, 12744, 10760, 8712, 10695, 14728, 12679, 16775, 12679, 16773, 14725, 12677, 8647, 8583, 8582, 8582, 6534, 6470, 20805, 16644, 14662, 14597, 12614, 12612, 12549, 12484, 10565, 10500, 10501, 8451, 10501, 8387, 8387, 10370, 6469, 4421, 6404, 4356, 8388, 6340, 6339, 6340, 6275, 6276, 6338, 4226, 6274, 4226, 6210, 4356, 4356, 4356, 4291, 2243, 2243, 2242, 2243, 2242, 4228, 4228, 2180, 2178, 4226, 4226, 2179, 2179, 4162, 4161, 2114, 4162, 2113, 2114, 2114, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2242, 130, 2178, 130, 129, 130, 129, 2113, 65, 2113, 2113, 2113, 65, 2113, 2113, 2113, 2113, 2113, 2113, 65, 65, 2049, 1, 1, 1, 2049, 1, 0, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 0, 63519
 };
 
-static const uint8_t gun_idle_pixels[17845] = {
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218,
-  192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 195, 90, 161, 101, 16, 103,
-  145, 164, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 96, 1, 3, 16, 3, 16, 29, 61, 195, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 218, 16, 31, 59, 3, 51, 29, 32, 61, 61, 146, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 3, 113,
-  125, 61, 9, 64, 8, 29, 61, 31, 125, 218, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 218, 26, 25, 123, 61, 125, 121, 65,
-  102, 59, 16, 32, 29, 107, 164, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 199, 16, 109, 102, 99, 65, 111, 121, 29, 146, 143, 61,
-  65, 61, 145, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 104, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  123, 29, 162, 65, 107, 59, 99, 107, 125, 146, 199, 123, 109, 113, 113, 170,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  170, 143, 143, 146, 30, 64, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 102, 107, 109, 61,
-  65, 61, 107, 29, 162, 195, 143, 113, 109, 111, 146, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 195, 170, 195,
-  192, 30, 145, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 195, 146, 31, 162, 102, 107, 61, 111, 31, 111,
-  192, 162, 143, 162, 164, 170, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 164, 164, 170, 192, 109, 161,
-  255, 255, 255, 83, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 199, 29, 59, 113, 65, 65, 107, 99, 32, 192, 170, 144, 143, 125,
-  143, 164, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 164, 170, 146, 145, 99, 143, 144, 65,
-  123, 255, 109, 100, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 100, 29,
-  143, 83, 65, 32, 111, 32, 121, 195, 162, 125, 125, 125, 164, 170, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 164, 164, 199, 29, 65, 111, 31, 99, 59, 65, 99,
-  111, 255, 255, 255, 255, 255, 255, 255, 255, 162, 8, 104, 123, 99, 65, 99,
-  107, 59, 192, 164, 144, 143, 126, 146, 170, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 170, 192, 107, 29, 123, 107, 3, 3, 8, 8, 32, 121, 110, 255,
-  110, 110, 110, 153, 199, 102, 60, 146, 65, 99, 87, 122, 61, 123, 192, 146,
-  143, 123, 121, 164, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 102, 59,
-  199, 122, 113, 107, 63, 3, 3, 32, 162, 32, 25, 16, 1, 1, 3, 29,
-  125, 146, 199, 143, 65, 62, 111, 99, 65, 195, 146, 122, 123, 126, 162, 170,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 143, 61, 111, 144, 146, 146,
-  99, 83, 25, 8, 143, 65, 29, 59, 60, 16, 8, 16, 8, 29, 111, 146,
-  107, 113, 123, 113, 162, 170, 125, 146, 144, 125, 170, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 146, 31, 121, 121, 146, 146, 112, 107, 113,
-  162, 146, 61, 32, 29, 59, 59, 29, 8, 16, 3, 102, 153, 29, 8, 53,
-  192, 146, 146, 123, 125, 162, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 195, 123, 143, 143, 146, 170, 121, 99, 109, 146, 107, 61,
-  99, 32, 31, 59, 60, 29, 65, 192, 100, 61, 123, 121, 162, 143, 143, 146,
-  162, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 111,
-  255, 125, 99, 126, 143, 125, 146, 146, 102, 65, 65, 59, 65, 107, 99, 29,
-  121, 62, 111, 146, 143, 162, 164, 146, 143, 170, 146, 146, 195, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 61, 59, 195, 29, 54,
-  121, 143, 143, 125, 170, 143, 107, 65, 59, 61, 65, 110, 99, 29, 111, 121,
-  99, 61, 65, 61, 109, 146, 162, 164, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 161, 83, 125, 109, 16, 30, 107, 125, 144,
-  125, 146, 170, 146, 112, 59, 64, 99, 61, 122, 123, 143, 111, 122, 111, 125,
-  162, 162, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 199, 125, 146, 195, 9, 8, 61, 110, 143, 144, 123, 146,
-  162, 126, 107, 61, 112, 121, 162, 112, 126, 125, 143, 162, 162, 179, 175, 176,
-  218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 143, 164, 63, 8, 83, 104, 121, 143, 123, 143, 170, 162, 146,
-  125, 164, 164, 164, 164, 164, 170, 170, 161, 93, 80, 72, 69, 56, 173, 218,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 83,
-  109, 218, 102, 3, 25, 111, 109, 143, 144, 123, 161, 109, 123, 146, 113, 111,
-  111, 111, 111, 146, 161, 147, 179, 179, 74, 4, 5, 127, 218, 218, 218, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 161, 113, 146, 192, 192,
-  29, 30, 107, 99, 123, 143, 125, 9, 100, 162, 111, 107, 144, 125, 111, 146,
-  170, 218, 218, 213, 218, 218, 142, 142, 94, 40, 76, 218, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 195, 161, 161, 128, 69, 132, 153, 83,
-  65, 110, 100, 16, 162, 123, 144, 125, 107, 146, 146, 162, 170, 151, 179, 154,
-  116, 218, 81, 34, 17, 1, 1, 173, 218, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 218, 146, 4, 36, 73, 70, 199, 30, 99, 29, 32,
-  162, 121, 111, 125, 121, 111, 146, 162, 179, 151, 137, 218, 98, 134, 155, 36,
-  71, 33, 17, 56, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 132, 4, 10, 36, 34, 33, 68, 134, 104, 3, 143, 146, 111, 107, 126,
-  122, 111, 146, 164, 179, 173, 137, 218, 98, 134, 157, 36, 104, 84, 34, 17,
-  128, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 10, 18, 127,
-  73, 118, 67, 17, 33, 157, 132, 162, 146, 144, 146, 144, 144, 144, 162, 170,
-  199, 177, 81, 218, 129, 152, 142, 69, 87, 57, 71, 33, 127, 218, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 155, 33, 134, 127, 74, 80, 113, 127,
-  33, 36, 147, 218, 199, 162, 162, 162, 162, 162, 162, 218, 177, 80, 72, 218,
-  131, 177, 81, 84, 51, 84, 67, 17, 128, 218, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 218, 74, 128, 130, 175, 98, 116, 131, 137, 176, 73, 71, 129,
+// start of each row in gun_idle_spans, relative to its frame
+static const uint16_t gun_idle_lines[166] = {
+  0, 5, 16, 28, 42, 58, 76, 95, 117, 144, 172, 203, 238, 271, 310, 347,
+  383, 418, 451, 485, 517, 548, 580, 612, 647, 683, 719, 754, 790, 827, 864, 902,
+  939, 976, 1013, 1051, 1088, 1123, 1157, 1191, 1226, 1263, 1302, 1342, 1383, 1425, 1466, 1509,
+  1554, 1599, 1645, 1690, 1737, 1785, 1830, 1869, 1911, 1968, 2026, 2087, 2150, 2214, 2278, 2341,
+  2403, 2464, 2524, 2584, 2643, 2701, 2758, 2814, 2869, 2924, 2978, 3031, 3084, 3136, 3187, 3238,
+  3288, 3338, 3388, 0, 11, 24, 38, 54, 72, 91, 111, 130, 156, 183, 213, 248,
+  282, 319, 355, 389, 423, 455, 485, 515, 544, 575, 610, 645, 680, 715, 750, 785,
+  821, 857, 893, 929, 965, 1001, 1037, 1071, 1105, 1140, 1174, 1209, 1246, 1284, 1324, 1364,
+  1405, 1447, 1491, 1535, 1580, 1624, 1669, 1716, 1764, 1812, 1849, 1893, 1947, 2004, 2063, 2126,
+  2191, 2256, 2319, 2382, 2444, 2505, 2565, 2624, 2682, 2739, 2795, 2851, 2906, 2960, 3013, 3066,
+  3118, 3169, 3219, 3269, 3320, 3371,
+};
+
+// per row: span count, then { skip, run, run indices } for each span
+static const uint8_t gun_idle_spans[6859] = {
+  1, 31, 2, 218, 192, 1, 30, 8, 195, 90, 161, 101, 16, 103, 145, 164,
+  1, 30, 9, 96, 1, 3, 16, 3, 16, 29, 61, 195, 1, 29, 11, 218,
+  16, 31, 59, 3, 51, 29, 32, 61, 61, 146, 1, 29, 13, 153, 3, 113,
+  125, 61, 9, 64, 8, 29, 61, 31, 125, 218, 1, 28, 15, 218, 26, 25,
+  123, 61, 125, 121, 65, 102, 59, 16, 32, 29, 107, 164, 1, 28, 16, 199,
+  16, 109, 102, 99, 65, 111, 121, 29, 146, 143, 61, 65, 61, 145, 195, 2,
+  1, 1, 104, 26, 16, 123, 29, 162, 65, 107, 59, 99, 107, 125, 146, 199,
+  123, 109, 113, 113, 170, 2, 0, 6, 170, 143, 143, 146, 30, 64, 21, 16,
+  199, 102, 107, 109, 61, 65, 61, 107, 29, 162, 195, 143, 113, 109, 111, 146,
+  2, 1, 6, 195, 170, 195, 192, 30, 145, 19, 17, 195, 146, 31, 162, 102,
+  107, 61, 111, 31, 111, 192, 162, 143, 162, 164, 170, 195, 3, 2, 6, 164,
+  164, 170, 192, 109, 161, 3, 2, 83, 143, 13, 16, 199, 29, 59, 113, 65,
+  65, 107, 99, 32, 192, 170, 144, 143, 125, 143, 164, 3, 4, 9, 164, 170,
+  146, 145, 99, 143, 144, 65, 123, 1, 2, 109, 100, 9, 17, 199, 100, 29,
+  143, 83, 65, 32, 111, 32, 121, 195, 162, 125, 125, 125, 164, 170, 2, 5,
+  12, 164, 164, 199, 29, 65, 111, 31, 99, 59, 65, 99, 111, 8, 16, 162,
+  8, 104, 123, 99, 65, 99, 107, 59, 192, 164, 144, 143, 126, 146, 170, 2,
+  6, 13, 170, 192, 107, 29, 123, 107, 3, 3, 8, 8, 32, 121, 110, 1,
+  21, 110, 110, 110, 153, 199, 102, 60, 146, 65, 99, 87, 122, 61, 123, 192,
+  146, 143, 123, 121, 164, 170, 1, 6, 34, 102, 59, 199, 122, 113, 107, 63,
+  3, 3, 32, 162, 32, 25, 16, 1, 1, 3, 29, 125, 146, 199, 143, 65,
+  62, 111, 99, 65, 195, 146, 122, 123, 126, 162, 170, 1, 6, 33, 143, 61,
+  111, 144, 146, 146, 99, 83, 25, 8, 143, 65, 29, 59, 60, 16, 8, 16,
+  8, 29, 111, 146, 107, 113, 123, 113, 162, 170, 125, 146, 144, 125, 170, 1,
+  7, 32, 146, 31, 121, 121, 146, 146, 112, 107, 113, 162, 146, 61, 32, 29,
+  59, 59, 29, 8, 16, 3, 102, 153, 29, 8, 53, 192, 146, 146, 123, 125,
+  162, 170, 1, 8, 30, 195, 123, 143, 143, 146, 170, 121, 99, 109, 146, 107,
+  61, 99, 32, 31, 59, 60, 29, 65, 192, 100, 61, 123, 121, 162, 143, 143,
+  146, 162, 170, 2, 7, 1, 111, 1, 28, 125, 99, 126, 143, 125, 146, 146,
+  102, 65, 65, 59, 65, 107, 99, 29, 121, 62, 111, 146, 143, 162, 164, 146,
+  143, 170, 146, 146, 195, 1, 7, 29, 61, 59, 195, 29, 54, 121, 143, 143,
+  125, 170, 143, 107, 65, 59, 61, 65, 110, 99, 29, 111, 121, 99, 61, 65,
+  61, 109, 146, 162, 164, 1, 7, 28, 161, 83, 125, 109, 16, 30, 107, 125,
+  144, 125, 146, 170, 146, 112, 59, 64, 99, 61, 122, 123, 143, 111, 122, 111,
+  125, 162, 162, 195, 1, 8, 29, 199, 125, 146, 195, 9, 8, 61, 110, 143,
+  144, 123, 146, 162, 126, 107, 61, 112, 121, 162, 112, 126, 125, 143, 162, 162,
+  179, 175, 176, 218, 1, 11, 29, 143, 164, 63, 8, 83, 104, 121, 143, 123,
+  143, 170, 162, 146, 125, 164, 164, 164, 164, 164, 170, 170, 161, 93, 80, 72,
+  69, 56, 173, 218, 1, 11, 32, 83, 109, 218, 102, 3, 25, 111, 109, 143,
+  144, 123, 161, 109, 123, 146, 113, 111, 111, 111, 111, 146, 161, 147, 179, 179,
+  74, 4, 5, 127, 218, 218, 218, 1, 11, 33, 161, 113, 146, 192, 192, 29,
+  30, 107, 99, 123, 143, 125, 9, 100, 162, 111, 107, 144, 125, 111, 146, 170,
+  218, 218, 213, 218, 218, 142, 142, 94, 40, 76, 218, 1, 12, 33, 195, 161,
+  161, 128, 69, 132, 153, 83, 65, 110, 100, 16, 162, 123, 144, 125, 107, 146,
+  146, 162, 170, 151, 179, 154, 116, 218, 81, 34, 17, 1, 1, 173, 218, 1,
+  13, 32, 218, 146, 4, 36, 73, 70, 199, 30, 99, 29, 32, 162, 121, 111,
+  125, 121, 111, 146, 162, 179, 151, 137, 218, 98, 134, 155, 36, 71, 33, 17,
+  56, 213, 1, 13, 33, 132, 4, 10, 36, 34, 33, 68, 134, 104, 3, 143,
+  146, 111, 107, 126, 122, 111, 146, 164, 179, 173, 137, 218, 98, 134, 157, 36,
+  104, 84, 34, 17, 128, 218, 1, 12, 34, 218, 10, 18, 127, 73, 118, 67,
+  17, 33, 157, 132, 162, 146, 144, 146, 144, 144, 144, 162, 170, 199, 177, 81,
+  218, 129, 152, 142, 69, 87, 57, 71, 33, 127, 218, 1, 12, 34, 155, 33,
+  134, 127, 74, 80, 113, 127, 33, 36, 147, 218, 199, 162, 162, 162, 162, 162,
+  162, 218, 177, 80, 72, 218, 131, 177, 81, 84, 51, 84, 67, 17, 128, 218,
+  1, 11, 35, 218, 74, 128, 130, 175, 98, 116, 131, 137, 176, 73, 71, 129,
   147, 179, 218, 179, 199, 179, 155, 137, 137, 130, 218, 98, 93, 155, 69, 83,
-  103, 218, 175, 127, 212, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218,
-  74, 80, 218, 179, 142, 81, 137, 63, 104, 173, 134, 133, 147, 133, 177, 213,
-  175, 218, 146, 151, 179, 175, 81, 68, 177, 81, 57, 137, 218, 218, 213, 218,
-  213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 142, 71, 95, 151, 213,
-  179, 213, 137, 26, 26, 57, 115, 123, 143, 95, 72, 36, 26, 70, 74, 218,
-  218, 130, 42, 135, 175, 84, 57, 63, 151, 154, 218, 179, 179, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 218, 149, 97, 95, 147, 218, 213, 175, 70,
-  72, 81, 69, 84, 71, 67, 33, 4, 17, 17, 33, 68, 127, 218, 170, 218,
-  110, 57, 41, 110, 151, 175, 218, 218, 218, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 213, 213, 179, 179, 179, 179, 212, 218, 128, 70, 81, 71, 69,
-  67, 33, 17, 33, 34, 68, 73, 127, 128, 177, 137, 213, 114, 51, 84, 115,
-  97, 179, 175, 56, 140, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 218, 255, 213, 218, 176, 74, 176, 213, 213, 128, 70, 142, 157, 127, 127,
-  70, 134, 161, 146, 145, 76, 41, 51, 51, 51, 103, 147, 147, 199, 78, 33,
-  176, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218,
-  179, 3, 2, 82, 218, 179, 218, 218, 218, 218, 140, 128, 73, 68, 71, 51,
-  26, 26, 26, 25, 103, 179, 151, 151, 137, 51, 103, 134, 142, 218, 212, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 149, 0, 17, 127,
-  218, 179, 179, 179, 179, 179, 213, 218, 134, 81, 127, 93, 106, 93, 103, 63,
-  115, 115, 95, 63, 41, 57, 146, 218, 218, 179, 213, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 218, 63, 26, 69, 72, 213, 218, 218,
+  103, 218, 175, 127, 212, 213, 1, 11, 34, 218, 74, 80, 218, 179, 142, 81,
+  137, 63, 104, 173, 134, 133, 147, 133, 177, 213, 175, 218, 146, 151, 179, 175,
+  81, 68, 177, 81, 57, 137, 218, 218, 213, 218, 213, 1, 11, 34, 142, 71,
+  95, 151, 213, 179, 213, 137, 26, 26, 57, 115, 123, 143, 95, 72, 36, 26,
+  70, 74, 218, 218, 130, 42, 135, 175, 84, 57, 63, 151, 154, 218, 179, 179,
+  1, 11, 34, 218, 149, 97, 95, 147, 218, 213, 175, 70, 72, 81, 69, 84,
+  71, 67, 33, 4, 17, 17, 33, 68, 127, 218, 170, 218, 110, 57, 41, 110,
+  151, 175, 218, 218, 218, 1, 11, 35, 213, 213, 179, 179, 179, 179, 212, 218,
+  128, 70, 81, 71, 69, 67, 33, 17, 33, 34, 68, 73, 127, 128, 177, 137,
+  213, 114, 51, 84, 115, 97, 179, 175, 56, 140, 218, 2, 13, 1, 218, 1,
+  31, 213, 218, 176, 74, 176, 213, 213, 128, 70, 142, 157, 127, 127, 70, 134,
+  161, 146, 145, 76, 41, 51, 51, 51, 103, 147, 147, 199, 78, 33, 176, 213,
+  1, 15, 32, 218, 179, 3, 2, 82, 218, 179, 218, 218, 218, 218, 140, 128,
+  73, 68, 71, 51, 26, 26, 26, 25, 103, 179, 151, 151, 137, 51, 103, 134,
+  142, 218, 212, 1, 16, 31, 149, 0, 17, 127, 218, 179, 179, 179, 179, 179,
+  213, 218, 134, 81, 127, 93, 106, 93, 103, 63, 115, 115, 95, 63, 41, 57,
+  146, 218, 218, 179, 213, 1, 16, 31, 218, 63, 26, 69, 72, 213, 218, 218,
   218, 213, 179, 179, 218, 218, 218, 218, 161, 115, 106, 77, 57, 52, 41, 26,
-  90, 151, 179, 179, 179, 218, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 213, 218, 148, 80, 69, 118, 127, 115, 153, 179, 213, 213,
-  177, 151, 146, 104, 87, 63, 84, 52, 26, 57, 63, 96, 218, 218, 218, 218,
-  173, 177, 179, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  179, 218, 179, 95, 114, 128, 44, 5, 33, 80, 218, 218, 179, 177, 177, 173,
-  148, 87, 83, 84, 57, 63, 63, 103, 98, 70, 74, 134, 173, 173, 213, 179,
-  199, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 179, 179, 218, 147,
-  115, 127, 74, 34, 69, 97, 129, 175, 157, 68, 81, 133, 143, 179, 154, 106,
-  57, 26, 26, 41, 51, 34, 36, 137, 213, 170, 179, 218, 179, 212, 213, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 179, 218, 26, 69, 155, 218, 128, 155, 98,
-  80, 97, 115, 129, 134, 134, 73, 42, 69, 77, 76, 104, 104, 64, 83, 103,
-  79, 42, 140, 218, 142, 4, 4, 142, 218, 213, 179, 213, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 218, 79, 17, 68, 140, 218, 218, 218, 199, 151, 173, 129,
-  151, 218, 98, 72, 127, 71, 87, 77, 34, 71, 104, 52, 26, 42, 115, 72,
-  17, 33, 19, 10, 127, 218, 218, 179, 213, 213, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  179, 218, 127, 69, 129, 134, 70, 74, 140, 213, 179, 218, 218, 213, 176, 151,
-  144, 137, 36, 17, 17, 33, 69, 76, 51, 54, 25, 41, 116, 212, 218, 155,
-  68, 68, 155, 218, 179, 179, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 115,
-  129, 140, 70, 33, 95, 97, 97, 151, 134, 177, 218, 155, 74, 67, 74, 48,
-  17, 17, 34, 83, 51, 3, 25, 104, 123, 170, 179, 218, 176, 72, 36, 127,
-  218, 218, 179, 179, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 175, 131, 134, 81, 71,
-  97, 95, 93, 148, 80, 175, 218, 175, 98, 129, 137, 34, 67, 17, 71, 51,
-  54, 26, 25, 51, 54, 104, 104, 137, 218, 177, 95, 80, 98, 128, 218, 218,
-  179, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 213, 213, 151, 179, 140, 137, 129, 129, 146, 148,
-  115, 177, 218, 179, 137, 137, 133, 140, 129, 34, 129, 173, 104, 87, 51, 25,
-  41, 76, 84, 103, 135, 154, 147, 97, 71, 67, 81, 155, 218, 218, 179, 213,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 213, 218, 213, 218, 218, 213, 213, 213, 179, 213, 213, 213, 218,
-  175, 131, 129, 93, 80, 133, 134, 72, 80, 110, 76, 63, 51, 26, 51, 84,
-  101, 101, 123, 136, 151, 129, 69, 67, 81, 175, 218, 213, 179, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  213, 255, 255, 170, 154, 142, 140, 179, 213, 155, 142, 142, 218, 213, 179, 179,
-  218, 175, 134, 129, 129, 148, 110, 102, 87, 57, 41, 41, 54, 76, 83, 84,
-  110, 135, 151, 80, 69, 72, 128, 179, 218, 179, 212, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 192,
-  136, 82, 127, 127, 81, 74, 72, 127, 128, 155, 212, 213, 218, 149, 97, 131,
-  147, 179, 132, 69, 78, 104, 87, 57, 41, 41, 41, 51, 63, 83, 103, 104,
-  97, 95, 80, 80, 128, 218, 218, 179, 213, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 170, 164, 132, 128, 36,
-  36, 36, 36, 36, 81, 140, 153, 179, 213, 179, 179, 218, 218, 218, 137, 72,
-  68, 69, 71, 102, 101, 76, 51, 26, 26, 51, 83, 101, 101, 103, 103, 95,
-  80, 129, 155, 218, 213, 179, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 192, 164, 140, 127, 81, 127, 140,
-  153, 192, 164, 255, 213, 213, 213, 212, 179, 212, 179, 177, 147, 81, 69, 69,
-  63, 87, 101, 76, 57, 41, 41, 57, 84, 84, 84, 103, 95, 95, 80, 130,
-  218, 218, 213, 179, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 170, 192, 192, 192, 192, 192, 255, 255, 255, 255,
-  255, 213, 213, 213, 213, 213, 218, 179, 218, 218, 213, 142, 129, 93, 84, 87,
-  101, 84, 51, 26, 26, 83, 83, 87, 83, 84, 104, 91, 93, 151, 213, 218,
-  213, 212, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  213, 213, 213, 179, 129, 147, 212, 218, 218, 179, 148, 123, 103, 104, 84, 63,
-  57, 51, 76, 54, 76, 54, 63, 101, 103, 91, 129, 151, 179, 218, 218, 179,
-  213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 179, 218,
-  151, 76, 95, 151, 218, 218, 218, 213, 132, 63, 87, 104, 103, 76, 84, 84,
-  41, 57, 57, 51, 76, 101, 84, 91, 97, 137, 177, 218, 213, 213, 212, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 179,
-  179, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 179, 218, 148, 104, 84,
+  90, 151, 179, 179, 179, 218, 213, 1, 16, 32, 213, 218, 148, 80, 69, 118,
+  127, 115, 153, 179, 213, 213, 177, 151, 146, 104, 87, 63, 84, 52, 26, 57,
+  63, 96, 218, 218, 218, 218, 173, 177, 179, 213, 1, 16, 34, 179, 218, 179,
+  95, 114, 128, 44, 5, 33, 80, 218, 218, 179, 177, 177, 173, 148, 87, 83,
+  84, 57, 63, 63, 103, 98, 70, 74, 134, 173, 173, 213, 179, 199, 213, 1,
+  15, 36, 213, 179, 179, 218, 147, 115, 127, 74, 34, 69, 97, 129, 175, 157,
+  68, 81, 133, 143, 179, 154, 106, 57, 26, 26, 41, 51, 34, 36, 137, 213,
+  170, 179, 218, 179, 212, 213, 1, 15, 37, 179, 218, 26, 69, 155, 218, 128,
+  155, 98, 80, 97, 115, 129, 134, 134, 73, 42, 69, 77, 76, 104, 104, 64,
+  83, 103, 79, 42, 140, 218, 142, 4, 4, 142, 218, 213, 179, 213, 1, 16,
+  38, 218, 79, 17, 68, 140, 218, 218, 218, 199, 151, 173, 129, 151, 218, 98,
+  72, 127, 71, 87, 77, 34, 71, 104, 52, 26, 42, 115, 72, 17, 33, 19,
+  10, 127, 218, 218, 179, 213, 213, 1, 16, 39, 179, 218, 127, 69, 129, 134,
+  70, 74, 140, 213, 179, 218, 218, 213, 176, 151, 144, 137, 36, 17, 17, 33,
+  69, 76, 51, 54, 25, 41, 116, 212, 218, 155, 68, 68, 155, 218, 179, 179,
+  213, 1, 18, 38, 218, 115, 129, 140, 70, 33, 95, 97, 97, 151, 134, 177,
+  218, 155, 74, 67, 74, 48, 17, 17, 34, 83, 51, 3, 25, 104, 123, 170,
+  179, 218, 176, 72, 36, 127, 218, 218, 179, 179, 1, 18, 40, 218, 175, 131,
+  134, 81, 71, 97, 95, 93, 148, 80, 175, 218, 175, 98, 129, 137, 34, 67,
+  17, 71, 51, 54, 26, 25, 51, 54, 104, 104, 137, 218, 177, 95, 80, 98,
+  128, 218, 218, 179, 212, 1, 18, 42, 213, 213, 151, 179, 140, 137, 129, 129,
+  146, 148, 115, 177, 218, 179, 137, 137, 133, 140, 129, 34, 129, 173, 104, 87,
+  51, 25, 41, 76, 84, 103, 135, 154, 147, 97, 71, 67, 81, 155, 218, 218,
+  179, 213, 1, 19, 42, 213, 218, 213, 218, 218, 213, 213, 213, 179, 213, 213,
+  213, 218, 175, 131, 129, 93, 80, 133, 134, 72, 80, 110, 76, 63, 51, 26,
+  51, 84, 101, 101, 123, 136, 151, 129, 69, 67, 81, 175, 218, 213, 179, 2,
+  20, 1, 213, 2, 40, 170, 154, 142, 140, 179, 213, 155, 142, 142, 218, 213,
+  179, 179, 218, 175, 134, 129, 129, 148, 110, 102, 87, 57, 41, 41, 54, 76,
+  83, 84, 110, 135, 151, 80, 69, 72, 128, 179, 218, 179, 212, 1, 23, 42,
+  192, 136, 82, 127, 127, 81, 74, 72, 127, 128, 155, 212, 213, 218, 149, 97,
+  131, 147, 179, 132, 69, 78, 104, 87, 57, 41, 41, 41, 51, 63, 83, 103,
+  104, 97, 95, 80, 80, 128, 218, 218, 179, 213, 1, 23, 44, 170, 164, 132,
+  128, 36, 36, 36, 36, 36, 81, 140, 153, 179, 213, 179, 179, 218, 218, 218,
+  137, 72, 68, 69, 71, 102, 101, 76, 51, 26, 26, 51, 83, 101, 101, 103,
+  103, 95, 80, 129, 155, 218, 213, 179, 213, 2, 25, 10, 192, 164, 140, 127,
+  81, 127, 140, 153, 192, 164, 1, 33, 213, 213, 213, 212, 179, 212, 179, 177,
+  147, 81, 69, 69, 63, 87, 101, 76, 57, 41, 41, 57, 84, 84, 84, 103,
+  95, 95, 80, 130, 218, 218, 213, 179, 213, 2, 26, 6, 170, 192, 192, 192,
+  192, 192, 5, 34, 213, 213, 213, 213, 213, 218, 179, 218, 218, 213, 142, 129,
+  93, 84, 87, 101, 84, 51, 26, 26, 83, 83, 87, 83, 84, 104, 91, 93,
+  151, 213, 218, 213, 212, 213, 2, 40, 33, 213, 213, 213, 179, 129, 147, 212,
+  218, 218, 179, 148, 123, 103, 104, 84, 63, 57, 51, 76, 54, 76, 54, 63,
+  101, 103, 91, 129, 151, 179, 218, 218, 179, 213, 19, 1, 213, 2, 41, 34,
+  213, 179, 218, 151, 76, 95, 151, 218, 218, 218, 213, 132, 63, 87, 104, 103,
+  76, 84, 84, 41, 57, 57, 51, 76, 101, 84, 91, 97, 137, 177, 218, 213,
+  213, 212, 16, 3, 179, 179, 213, 3, 42, 36, 213, 179, 218, 148, 104, 84,
   131, 175, 218, 151, 98, 68, 71, 84, 83, 101, 101, 103, 57, 41, 63, 76,
-  41, 51, 84, 87, 87, 84, 93, 137, 175, 213, 218, 212, 213, 213, 255, 255,
-  255, 177, 255, 218, 218, 218, 218, 213, 179, 179, 179, 179, 179, 179, 179, 213,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 213, 179, 218, 179, 123, 84, 84, 131, 151,
-  213, 176, 212, 134, 123, 84, 87, 87, 103, 87, 83, 83, 83, 41, 54, 76,
-  84, 101, 87, 84, 95, 129, 151, 218, 199, 179, 179, 212, 218, 218, 52, 78,
-  154, 149, 154, 213, 218, 218, 218, 218, 218, 218, 218, 179, 179, 213, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 213, 179, 218, 218, 154, 137, 131, 91, 95, 97, 137, 179,
-  218, 72, 36, 52, 83, 87, 103, 87, 76, 84, 83, 84, 76, 84, 101, 87,
-  87, 91, 84, 175, 218, 212, 213, 218, 136, 26, 2, 0, 3, 5, 5, 37,
-  78, 41, 26, 41, 26, 26, 132, 218, 218, 179, 179, 255, 255, 255, 255, 255,
-  255, 255, 255, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 213, 179, 179, 213, 177, 179, 170, 137, 137, 97, 95, 97, 80, 68, 67,
-  36, 51, 57, 84, 101, 87, 103, 87, 87, 76, 87, 101, 101, 87, 104, 179,
-  213, 218, 119, 27, 11, 0, 15, 20, 6, 5, 15, 7, 4, 1, 2, 2,
-  3, 5, 39, 92, 136, 218, 213, 179, 213, 255, 255, 255, 255, 255, 213, 179,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213,
-  213, 173, 173, 151, 140, 218, 218, 148, 103, 87, 91, 71, 68, 67, 26, 41,
-  41, 51, 76, 101, 101, 84, 84, 84, 87, 84, 123, 218, 213, 153, 24, 1,
-  0, 2, 2, 1, 2, 6, 10, 15, 15, 19, 19, 20, 56, 120, 140, 35,
-  48, 92, 154, 218, 213, 213, 255, 255, 255, 179, 179, 179, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 218, 213, 177,
-  131, 131, 154, 218, 199, 123, 101, 104, 84, 71, 63, 57, 51, 26, 26, 63,
-  87, 101, 101, 76, 84, 84, 123, 218, 218, 132, 5, 2, 55, 154, 115, 26,
-  11, 0, 1, 10, 15, 19, 10, 10, 6, 10, 213, 218, 179, 94, 48, 132,
-  218, 179, 213, 179, 213, 218, 218, 218, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 213, 218, 179, 148, 137, 129,
-  137, 179, 179, 179, 135, 83, 104, 87, 95, 77, 51, 41, 41, 57, 84, 103,
-  101, 87, 106, 179, 218, 136, 24, 58, 218, 213, 218, 218, 218, 119, 1, 0,
-  3, 2, 5, 7, 5, 10, 75, 92, 179, 218, 213, 119, 179, 213, 179, 218,
-  213, 149, 54, 37, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 213, 179, 218, 137, 129, 170, 167, 129, 129, 213, 218,
-  218, 131, 106, 149, 135, 97, 97, 91, 63, 76, 87, 87, 87, 101, 83, 154,
-  218, 218, 55, 56, 176, 213, 179, 154, 179, 218, 213, 26, 4, 21, 149, 92,
-  75, 20, 5, 2, 5, 55, 94, 153, 218, 179, 218, 96, 26, 1, 2, 7,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 179, 213, 199, 167, 131, 137, 199, 137, 95, 137, 218, 218, 135, 131,
-  135, 151, 179, 175, 151, 131, 97, 95, 84, 87, 103, 154, 218, 155, 44, 55,
-  179, 213, 213, 48, 153, 199, 179, 136, 39, 56, 44, 48, 53, 3, 0, 0,
-  0, 11, 94, 154, 213, 218, 119, 1, 10, 5, 19, 10, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199,
-  218, 177, 169, 115, 137, 177, 146, 129, 129, 154, 218, 151, 84, 87, 101, 123,
-  179, 213, 177, 218, 147, 137, 147, 218, 218, 132, 24, 92, 218, 218, 132, 48,
-  212, 218, 132, 55, 40, 37, 94, 94, 26, 26, 41, 26, 103, 151, 213, 218,
-  179, 218, 179, 48, 44, 19, 10, 10, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 179, 213, 173, 169,
-  148, 131, 147, 177, 148, 115, 131, 179, 179, 103, 110, 104, 87, 87, 103, 131,
-  199, 218, 177, 179, 218, 132, 35, 48, 154, 218, 56, 44, 55, 119, 218, 179,
-  179, 179, 218, 218, 218, 213, 218, 218, 218, 218, 179, 179, 218, 132, 92, 77,
-  35, 20, 7, 10, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 199, 213, 179, 167, 169, 167, 115, 134,
-  177, 169, 148, 95, 137, 175, 129, 114, 106, 113, 101, 76, 106, 218, 149, 151,
-  218, 155, 37, 92, 218, 179, 75, 37, 35, 10, 153, 218, 213, 179, 154, 176,
-  55, 3, 41, 94, 179, 213, 179, 179, 218, 120, 23, 44, 94, 94, 19, 10,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 199, 213, 177, 167, 169, 173, 97, 151, 173, 173, 146,
-  84, 95, 129, 131, 129, 113, 146, 123, 113, 143, 151, 213, 179, 218, 55, 77,
-  218, 218, 119, 24, 48, 19, 140, 218, 179, 75, 48, 55, 94, 179, 132, 94,
-  218, 212, 213, 218, 218, 218, 153, 92, 218, 213, 19, 10, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 199, 213, 177, 167, 173, 148, 137, 213, 167, 173, 146, 113, 103, 115,
-  131, 131, 147, 167, 173, 169, 151, 218, 179, 218, 153, 48, 119, 218, 154, 77,
-  37, 20, 55, 218, 179, 179, 179, 179, 218, 218, 218, 213, 213, 179, 213, 177,
-  149, 218, 213, 179, 179, 53, 6, 10, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213,
-  218, 177, 167, 169, 151, 213, 179, 167, 173, 173, 167, 151, 151, 213, 218, 177,
-  167, 167, 173, 213, 218, 155, 213, 213, 119, 75, 136, 218, 92, 35, 37, 154,
-  218, 213, 213, 179, 179, 179, 213, 213, 213, 179, 218, 58, 10, 94, 179, 213,
-  218, 153, 28, 6, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 218, 177, 167,
-  167, 177, 218, 177, 167, 151, 199, 218, 218, 218, 213, 218, 177, 146, 173, 212,
-  218, 94, 75, 179, 218, 78, 24, 94, 92, 37, 37, 155, 218, 179, 218, 218,
-  218, 218, 179, 213, 179, 218, 138, 44, 35, 92, 218, 179, 118, 55, 19, 10,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 213, 199, 218, 177, 167, 167, 179, 218,
+  41, 51, 84, 87, 87, 84, 93, 137, 175, 213, 218, 212, 213, 213, 3, 1,
+  177, 1, 13, 218, 218, 218, 218, 213, 179, 179, 179, 179, 179, 179, 179, 213,
+  1, 43, 55, 213, 179, 218, 179, 123, 84, 84, 131, 151, 213, 176, 212, 134,
+  123, 84, 87, 87, 103, 87, 83, 83, 83, 41, 54, 76, 84, 101, 87, 84,
+  95, 129, 151, 218, 199, 179, 179, 212, 218, 218, 52, 78, 154, 149, 154, 213,
+  218, 218, 218, 218, 218, 218, 218, 179, 179, 213, 2, 44, 55, 213, 179, 218,
+  218, 154, 137, 131, 91, 95, 97, 137, 179, 218, 72, 36, 52, 83, 87, 103,
+  87, 76, 84, 83, 84, 76, 84, 101, 87, 87, 91, 84, 175, 218, 212, 213,
+  218, 136, 26, 2, 0, 3, 5, 5, 37, 78, 41, 26, 41, 26, 26, 132,
+  218, 218, 179, 179, 8, 1, 213, 2, 45, 56, 213, 179, 179, 213, 177, 179,
+  170, 137, 137, 97, 95, 97, 80, 68, 67, 36, 51, 57, 84, 101, 87, 103,
+  87, 87, 76, 87, 101, 101, 87, 104, 179, 213, 218, 119, 27, 11, 0, 15,
+  20, 6, 5, 15, 7, 4, 1, 2, 2, 3, 5, 39, 92, 136, 218, 213,
+  179, 213, 5, 2, 213, 179, 2, 46, 56, 213, 213, 213, 173, 173, 151, 140,
+  218, 218, 148, 103, 87, 91, 71, 68, 67, 26, 41, 41, 51, 76, 101, 101,
+  84, 84, 84, 87, 84, 123, 218, 213, 153, 24, 1, 0, 2, 2, 1, 2,
+  6, 10, 15, 15, 19, 19, 20, 56, 120, 140, 35, 48, 92, 154, 218, 213,
+  213, 3, 3, 179, 179, 179, 1, 47, 61, 213, 213, 218, 213, 177, 131, 131,
+  154, 218, 199, 123, 101, 104, 84, 71, 63, 57, 51, 26, 26, 63, 87, 101,
+  101, 76, 84, 84, 123, 218, 218, 132, 5, 2, 55, 154, 115, 26, 11, 0,
+  1, 10, 15, 19, 10, 10, 6, 10, 213, 218, 179, 94, 48, 132, 218, 179,
+  213, 179, 213, 218, 218, 218, 1, 48, 60, 213, 213, 213, 218, 179, 148, 137,
+  129, 137, 179, 179, 179, 135, 83, 104, 87, 95, 77, 51, 41, 41, 57, 84,
+  103, 101, 87, 106, 179, 218, 136, 24, 58, 218, 213, 218, 218, 218, 119, 1,
+  0, 3, 2, 5, 7, 5, 10, 75, 92, 179, 218, 213, 119, 179, 213, 179,
+  218, 213, 149, 54, 37, 1, 49, 59, 213, 179, 218, 137, 129, 170, 167, 129,
+  129, 213, 218, 218, 131, 106, 149, 135, 97, 97, 91, 63, 76, 87, 87, 87,
+  101, 83, 154, 218, 218, 55, 56, 176, 213, 179, 154, 179, 218, 213, 26, 4,
+  21, 149, 92, 75, 20, 5, 2, 5, 55, 94, 153, 218, 179, 218, 96, 26,
+  1, 2, 7, 1, 50, 58, 179, 213, 199, 167, 131, 137, 199, 137, 95, 137,
+  218, 218, 135, 131, 135, 151, 179, 175, 151, 131, 97, 95, 84, 87, 103, 154,
+  218, 155, 44, 55, 179, 213, 213, 48, 153, 199, 179, 136, 39, 56, 44, 48,
+  53, 3, 0, 0, 0, 11, 94, 154, 213, 218, 119, 1, 10, 5, 19, 10,
+  1, 51, 57, 199, 218, 177, 169, 115, 137, 177, 146, 129, 129, 154, 218, 151,
+  84, 87, 101, 123, 179, 213, 177, 218, 147, 137, 147, 218, 218, 132, 24, 92,
+  218, 218, 132, 48, 212, 218, 132, 55, 40, 37, 94, 94, 26, 26, 41, 26,
+  103, 151, 213, 218, 179, 218, 179, 48, 44, 19, 10, 10, 1, 51, 57, 213,
+  179, 213, 173, 169, 148, 131, 147, 177, 148, 115, 131, 179, 179, 103, 110, 104,
+  87, 87, 103, 131, 199, 218, 177, 179, 218, 132, 35, 48, 154, 218, 56, 44,
+  55, 119, 218, 179, 179, 179, 218, 218, 218, 213, 218, 218, 218, 218, 179, 179,
+  218, 132, 92, 77, 35, 20, 7, 10, 1, 52, 56, 199, 213, 179, 167, 169,
+  167, 115, 134, 177, 169, 148, 95, 137, 175, 129, 114, 106, 113, 101, 76, 106,
+  218, 149, 151, 218, 155, 37, 92, 218, 179, 75, 37, 35, 10, 153, 218, 213,
+  179, 154, 176, 55, 3, 41, 94, 179, 213, 179, 179, 218, 120, 23, 44, 94,
+  94, 19, 10, 1, 53, 55, 199, 213, 177, 167, 169, 173, 97, 151, 173, 173,
+  146, 84, 95, 129, 131, 129, 113, 146, 123, 113, 143, 151, 213, 179, 218, 55,
+  77, 218, 218, 119, 24, 48, 19, 140, 218, 179, 75, 48, 55, 94, 179, 132,
+  94, 218, 212, 213, 218, 218, 218, 153, 92, 218, 213, 19, 10, 1, 54, 54,
+  199, 213, 177, 167, 173, 148, 137, 213, 167, 173, 146, 113, 103, 115, 131, 131,
+  147, 167, 173, 169, 151, 218, 179, 218, 153, 48, 119, 218, 154, 77, 37, 20,
+  55, 218, 179, 179, 179, 179, 218, 218, 218, 213, 213, 179, 213, 177, 149, 218,
+  213, 179, 179, 53, 6, 10, 1, 55, 53, 213, 218, 177, 167, 169, 151, 213,
+  179, 167, 173, 173, 167, 151, 151, 213, 218, 177, 167, 167, 173, 213, 218, 155,
+  213, 213, 119, 75, 136, 218, 92, 35, 37, 154, 218, 213, 213, 179, 179, 179,
+  213, 213, 213, 179, 218, 58, 10, 94, 179, 213, 218, 153, 28, 6, 1, 56,
+  52, 199, 218, 177, 167, 167, 177, 218, 177, 167, 151, 199, 218, 218, 218, 213,
+  218, 177, 146, 173, 212, 218, 94, 75, 179, 218, 78, 24, 94, 92, 37, 37,
+  155, 218, 179, 218, 218, 218, 218, 179, 213, 179, 218, 138, 44, 35, 92, 218,
+  179, 118, 55, 19, 10, 1, 56, 52, 213, 199, 218, 177, 167, 167, 179, 218,
   177, 167, 177, 177, 177, 177, 213, 179, 213, 177, 177, 213, 213, 119, 75, 154,
   94, 37, 48, 35, 35, 37, 48, 179, 179, 218, 115, 26, 26, 103, 218, 179,
-  218, 132, 24, 37, 75, 179, 218, 119, 24, 37, 10, 10, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 213, 213, 218, 177, 167, 173, 218, 213, 179, 177, 167,
-  167, 167, 167, 173, 173, 151, 177, 218, 179, 218, 218, 212, 155, 75, 20, 44,
-  48, 37, 155, 218, 218, 138, 1, 0, 1, 0, 154, 218, 213, 136, 138, 119,
-  132, 218, 176, 48, 44, 20, 10, 10, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 213, 213, 213, 177, 167, 177, 213, 218, 218, 179, 177, 170, 177, 179,
-  213, 213, 213, 179, 218, 218, 218, 218, 218, 218, 92, 48, 35, 56, 179, 218,
-  155, 5, 2, 5, 19, 2, 3, 179, 218, 213, 218, 179, 218, 140, 48, 48,
-  23, 7, 15, 10, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 199,
-  213, 199, 167, 177, 218, 179, 179, 218, 218, 218, 218, 218, 212, 153, 77, 48,
-  94, 119, 118, 119, 119, 94, 140, 218, 118, 136, 218, 212, 179, 37, 37, 35,
-  7, 19, 1, 3, 120, 218, 179, 179, 218, 94, 35, 20, 10, 10, 5, 6,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 179, 218, 173, 173, 218,
-  213, 56, 44, 94, 92, 75, 140, 155, 56, 44, 37, 35, 24, 24, 35, 24,
-  24, 55, 132, 218, 218, 213, 179, 213, 218, 155, 75, 35, 19, 10, 19, 1,
-  0, 90, 218, 213, 119, 37, 35, 10, 6, 10, 75, 120, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 213, 179, 179, 179, 218, 75, 35, 37,
-  10, 6, 45, 19, 19, 23, 20, 6, 1, 2, 24, 94, 136, 218, 218, 218,
-  218, 218, 218, 75, 119, 218, 153, 48, 23, 10, 10, 15, 3, 1, 63, 218,
-  55, 44, 20, 5, 23, 132, 218, 218, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 213, 213, 213, 179, 213, 75, 37, 48, 24, 75, 218, 138,
-  55, 10, 7, 10, 7, 3, 78, 218, 218, 218, 179, 140, 94, 119, 78, 35,
-  56, 213, 213, 56, 35, 15, 10, 10, 20, 11, 26, 92, 37, 20, 19, 75,
-  149, 218, 136, 94, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 213, 179, 218, 132, 24, 48, 44, 44, 39, 119, 218, 119, 15, 22, 23,
-  20, 10, 154, 218, 179, 119, 56, 44, 35, 35, 37, 48, 35, 132, 218, 48,
-  44, 20, 10, 15, 6, 27, 92, 94, 132, 94, 153, 218, 132, 77, 37, 35,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 213,
-  154, 77, 35, 48, 44, 35, 132, 153, 15, 20, 155, 94, 35, 20, 140, 218,
-  155, 37, 23, 20, 19, 23, 23, 37, 44, 48, 78, 44, 44, 35, 10, 10,
-  10, 7, 6, 119, 132, 132, 56, 44, 35, 35, 44, 44, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 179, 218, 179, 77, 35,
-  44, 35, 154, 132, 24, 75, 179, 154, 48, 35, 132, 218, 213, 154, 55, 5,
-  7, 7, 7, 10, 20, 23, 20, 24, 48, 35, 10, 10, 10, 10, 10, 23,
-  35, 35, 37, 37, 44, 44, 44, 44, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 213, 213, 213, 179, 218, 179, 92, 48, 48, 48, 48,
-  48, 155, 218, 218, 154, 48, 48, 138, 218, 218, 218, 92, 20, 19, 19, 19,
-  19, 10, 7, 7, 24, 44, 24, 15, 10, 10, 10, 19, 48, 44, 44, 44,
-  44, 44, 44, 44, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 192, 199, 145, 145, 135, 135, 146, 199, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 54, 25, 78, 1,
-  30, 25, 31, 123, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 161, 3, 8, 26, 83, 31, 32, 61, 32, 113,
-  195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  199, 101, 3, 146, 31, 42, 64, 8, 16, 64, 32, 61, 199, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 25, 64, 109, 121,
-  65, 83, 99, 16, 16, 32, 59, 32, 146, 192, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 145, 25, 125, 64, 99, 121, 122, 31, 113, 102,
-  29, 16, 32, 83, 164, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  199, 113, 59, 143, 65, 65, 31, 126, 111, 65, 199, 164, 113, 109, 83, 143,
-  199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 195, 59, 122, 102, 99,
-  31, 99, 60, 65, 199, 164, 143, 99, 99, 123, 195, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 146, 100, 162, 64,
-  102, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 199, 123, 60, 146, 61, 99, 31, 112, 29, 121, 170,
-  164, 121, 122, 144, 164, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 192, 164, 164, 135, 25, 113, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  164, 29, 111, 123, 65, 99, 110, 59, 65, 199, 164, 126, 143, 143, 162, 170,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 170, 164, 199, 161, 102, 162, 255, 255, 255, 255, 107, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 64, 29, 125, 59, 61,
-  59, 112, 31, 146, 170, 146, 143, 123, 146, 170, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 170,
-  164, 195, 162, 109, 146, 125, 199, 143, 102, 121, 255, 99, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 123, 8, 125, 109, 99, 32, 107, 59, 99, 195, 162,
-  144, 123, 143, 162, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 164, 170, 195, 113,
-  31, 162, 32, 65, 29, 32, 112, 111, 125, 255, 255, 255, 255, 255, 255, 195,
-  31, 61, 143, 65, 107, 99, 121, 59, 123, 199, 144, 125, 123, 144, 195, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 164, 199, 144, 8, 111, 121, 29, 31,
-  32, 8, 8, 29, 146, 255, 255, 104, 255, 195, 162, 111, 162, 109, 99, 99,
-  111, 107, 60, 195, 144, 125, 123, 146, 170, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 195, 143, 111, 121, 59, 123, 51, 1, 8, 29, 64, 110, 30,
-  26, 3, 3, 3, 16, 111, 146, 195, 121, 65, 99, 112, 59, 143, 170, 125,
-  123, 126, 146, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 102,
-  32, 192, 146, 146, 87, 102, 9, 3, 123, 107, 29, 32, 8, 8, 29, 29,
-  16, 16, 62, 125, 111, 125, 113, 123, 195, 144, 143, 122, 144, 170, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 113, 107, 110, 146, 143,
-  107, 64, 51, 146, 162, 59, 31, 61, 62, 29, 8, 29, 31, 8, 59, 161,
-  29, 3, 53, 162, 143, 123, 143, 162, 170, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 146, 107, 144, 144, 143, 192, 122, 99, 109, 162,
-  125, 59, 32, 32, 32, 59, 29, 8, 16, 199, 59, 16, 113, 121, 143, 125,
-  144, 144, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 195, 107, 123, 146, 143, 146, 143, 61, 83, 121, 61, 65, 99, 60,
-  31, 32, 112, 143, 162, 122, 146, 170, 143, 162, 146, 146, 170, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 61, 109, 111, 65,
-  113, 143, 143, 143, 162, 123, 62, 61, 59, 61, 107, 61, 99, 65, 107, 146,
-  109, 102, 61, 64, 143, 162, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 109, 32, 153, 29, 59, 110, 123, 144, 143,
-  162, 162, 125, 107, 61, 59, 104, 107, 59, 123, 125, 99, 107, 111, 143, 162,
-  164, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 143, 113, 143, 16, 16, 104, 111, 143, 143, 143, 162, 162, 121,
-  65, 64, 64, 112, 125, 111, 111, 144, 123, 146, 162, 179, 179, 175, 218, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  218, 132, 24, 37, 75, 179, 218, 119, 24, 37, 10, 10, 1, 57, 51, 213,
+  213, 218, 177, 167, 173, 218, 213, 179, 177, 167, 167, 167, 167, 173, 173, 151,
+  177, 218, 179, 218, 218, 212, 155, 75, 20, 44, 48, 37, 155, 218, 218, 138,
+  1, 0, 1, 0, 154, 218, 213, 136, 138, 119, 132, 218, 176, 48, 44, 20,
+  10, 10, 1, 58, 50, 213, 213, 213, 177, 167, 177, 213, 218, 218, 179, 177,
+  170, 177, 179, 213, 213, 213, 179, 218, 218, 218, 218, 218, 218, 92, 48, 35,
+  56, 179, 218, 155, 5, 2, 5, 19, 2, 3, 179, 218, 213, 218, 179, 218,
+  140, 48, 48, 23, 7, 15, 10, 1, 58, 50, 213, 199, 213, 199, 167, 177,
+  218, 179, 179, 218, 218, 218, 218, 218, 212, 153, 77, 48, 94, 119, 118, 119,
+  119, 94, 140, 218, 118, 136, 218, 212, 179, 37, 37, 35, 7, 19, 1, 3,
+  120, 218, 179, 179, 218, 94, 35, 20, 10, 10, 5, 6, 1, 59, 49, 179,
+  218, 173, 173, 218, 213, 56, 44, 94, 92, 75, 140, 155, 56, 44, 37, 35,
+  24, 24, 35, 24, 24, 55, 132, 218, 218, 213, 179, 213, 218, 155, 75, 35,
+  19, 10, 19, 1, 0, 90, 218, 213, 119, 37, 35, 10, 6, 10, 75, 120,
+  1, 60, 48, 213, 179, 179, 179, 218, 75, 35, 37, 10, 6, 45, 19, 19,
+  23, 20, 6, 1, 2, 24, 94, 136, 218, 218, 218, 218, 218, 218, 75, 119,
+  218, 153, 48, 23, 10, 10, 15, 3, 1, 63, 218, 55, 44, 20, 5, 23,
+  132, 218, 218, 1, 60, 48, 213, 213, 213, 179, 213, 75, 37, 48, 24, 75,
+  218, 138, 55, 10, 7, 10, 7, 3, 78, 218, 218, 218, 179, 140, 94, 119,
+  78, 35, 56, 213, 213, 56, 35, 15, 10, 10, 20, 11, 26, 92, 37, 20,
+  19, 75, 149, 218, 136, 94, 1, 61, 47, 213, 179, 218, 132, 24, 48, 44,
+  44, 39, 119, 218, 119, 15, 22, 23, 20, 10, 154, 218, 179, 119, 56, 44,
+  35, 35, 37, 48, 35, 132, 218, 48, 44, 20, 10, 15, 6, 27, 92, 94,
+  132, 94, 153, 218, 132, 77, 37, 35, 1, 61, 47, 213, 213, 213, 154, 77,
+  35, 48, 44, 35, 132, 153, 15, 20, 155, 94, 35, 20, 140, 218, 155, 37,
+  23, 20, 19, 23, 23, 37, 44, 48, 78, 44, 44, 35, 10, 10, 10, 7,
+  6, 119, 132, 132, 56, 44, 35, 35, 44, 44, 1, 61, 47, 213, 213, 179,
+  218, 179, 77, 35, 44, 35, 154, 132, 24, 75, 179, 154, 48, 35, 132, 218,
+  213, 154, 55, 5, 7, 7, 7, 10, 20, 23, 20, 24, 48, 35, 10, 10,
+  10, 10, 10, 23, 35, 35, 37, 37, 44, 44, 44, 44, 1, 61, 47, 213,
+  213, 213, 179, 218, 179, 92, 48, 48, 48, 48, 48, 155, 218, 218, 154, 48,
+  48, 138, 218, 218, 218, 92, 20, 19, 19, 19, 19, 10, 7, 7, 24, 44,
+  24, 15, 10, 10, 10, 19, 48, 44, 44, 44, 44, 44, 44, 44, 1, 29,
+  8, 192, 199, 145, 145, 135, 135, 146, 199, 1, 28, 10, 218, 54, 25, 78,
+  1, 30, 25, 31, 123, 218, 1, 28, 11, 161, 3, 8, 26, 83, 31, 32,
+  61, 32, 113, 195, 1, 27, 13, 199, 101, 3, 146, 31, 42, 64, 8, 16,
+  64, 32, 61, 199, 1, 27, 15, 218, 25, 64, 109, 121, 65, 83, 99, 16,
+  16, 32, 59, 32, 146, 192, 1, 27, 16, 145, 25, 125, 64, 99, 121, 122,
+  31, 113, 102, 29, 16, 32, 83, 164, 170, 1, 26, 17, 199, 113, 59, 143,
+  65, 65, 31, 126, 111, 65, 199, 164, 113, 109, 83, 143, 199, 1, 26, 16,
+  195, 59, 122, 102, 99, 31, 99, 60, 65, 199, 164, 143, 99, 99, 123, 195,
+  2, 0, 5, 146, 100, 162, 64, 102, 20, 16, 199, 123, 60, 146, 61, 99,
+  31, 112, 29, 121, 170, 164, 121, 122, 144, 164, 2, 0, 6, 192, 164, 164,
+  135, 25, 113, 19, 16, 164, 29, 111, 123, 65, 99, 110, 59, 65, 199, 164,
+  126, 143, 143, 162, 170, 3, 1, 6, 170, 164, 199, 161, 102, 162, 4, 1,
+  107, 12, 16, 199, 64, 29, 125, 59, 61, 59, 112, 31, 146, 170, 146, 143,
+  123, 146, 170, 3, 2, 11, 170, 164, 195, 162, 109, 146, 125, 199, 143, 102,
+  121, 1, 1, 99, 9, 16, 123, 8, 125, 109, 99, 32, 107, 59, 99, 195,
+  162, 144, 123, 143, 162, 170, 2, 4, 13, 164, 170, 195, 113, 31, 162, 32,
+  65, 29, 32, 112, 111, 125, 6, 16, 195, 31, 61, 143, 65, 107, 99, 121,
+  59, 123, 199, 144, 125, 123, 144, 195, 3, 5, 13, 164, 199, 144, 8, 111,
+  121, 29, 31, 32, 8, 8, 29, 146, 2, 1, 104, 1, 16, 195, 162, 111,
+  162, 109, 99, 99, 111, 107, 60, 195, 144, 125, 123, 146, 170, 1, 5, 33,
+  195, 143, 111, 121, 59, 123, 51, 1, 8, 29, 64, 110, 30, 26, 3, 3,
+  3, 16, 111, 146, 195, 121, 65, 99, 112, 59, 143, 170, 125, 123, 126, 146,
+  170, 1, 6, 31, 102, 32, 192, 146, 146, 87, 102, 9, 3, 123, 107, 29,
+  32, 8, 8, 29, 29, 16, 16, 62, 125, 111, 125, 113, 123, 195, 144, 143,
+  122, 144, 170, 1, 6, 31, 199, 113, 107, 110, 146, 143, 107, 64, 51, 146,
+  162, 59, 31, 61, 62, 29, 8, 29, 31, 8, 59, 161, 29, 3, 53, 162,
+  143, 123, 143, 162, 170, 1, 7, 29, 146, 107, 144, 144, 143, 192, 122, 99,
+  109, 162, 125, 59, 32, 32, 32, 59, 29, 8, 16, 199, 59, 16, 113, 121,
+  143, 125, 144, 144, 170, 1, 8, 27, 195, 107, 123, 146, 143, 146, 143, 61,
+  83, 121, 61, 65, 99, 60, 31, 32, 112, 143, 162, 122, 146, 170, 143, 162,
+  146, 146, 170, 1, 7, 27, 61, 109, 111, 65, 113, 143, 143, 143, 162, 123,
+  62, 61, 59, 61, 107, 61, 99, 65, 107, 146, 109, 102, 61, 64, 143, 162,
+  170, 1, 7, 26, 109, 32, 153, 29, 59, 110, 123, 144, 143, 162, 162, 125,
+  107, 61, 59, 104, 107, 59, 123, 125, 99, 107, 111, 143, 162, 164, 1, 8,
+  28, 143, 113, 143, 16, 16, 104, 111, 143, 143, 143, 162, 162, 121, 65, 64,
+  64, 112, 125, 111, 111, 144, 123, 146, 162, 179, 179, 175, 218, 2, 10, 29,
   146, 164, 25, 3, 65, 121, 123, 146, 121, 143, 192, 146, 111, 112, 121, 170,
-  146, 146, 146, 164, 164, 161, 129, 129, 72, 70, 70, 132, 179, 255, 218, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 102, 162, 102, 3,
-  31, 111, 109, 144, 143, 125, 161, 192, 143, 162, 146, 143, 125, 111, 111, 143,
-  146, 131, 175, 213, 128, 67, 17, 119, 199, 176, 218, 179, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 113, 99, 192, 113, 9, 16, 107, 104, 123,
-  146, 125, 102, 29, 162, 123, 107, 121, 146, 121, 125, 162, 179, 177, 179, 218,
-  218, 179, 140, 18, 2, 135, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 195, 146, 162, 199, 149, 100, 83, 31, 107, 109, 146, 30, 31, 162,
-  110, 144, 121, 122, 144, 146, 170, 218, 199, 173, 177, 218, 137, 80, 33, 17,
-  2, 135, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 249,
-  19, 69, 127, 218, 101, 16, 65, 121, 9, 111, 162, 121, 122, 111, 111, 121,
-  162, 179, 213, 177, 213, 149, 213, 137, 71, 17, 33, 17, 27, 218, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 176, 18, 4, 127, 33, 67, 134,
-  138, 30, 25, 9, 162, 143, 104, 112, 146, 111, 125, 162, 179, 212, 151, 218,
-  131, 151, 137, 71, 17, 36, 34, 34, 218, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 218, 27, 4, 36, 140, 81, 33, 33, 67, 142, 83, 100, 192,
-  125, 121, 125, 125, 144, 146, 164, 199, 179, 173, 179, 129, 218, 81, 71, 34,
-  68, 33, 33, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 134, 17,
-  79, 173, 137, 130, 72, 127, 72, 68, 137, 199, 170, 162, 146, 146, 146, 162,
-  162, 179, 213, 151, 218, 128, 69, 218, 81, 95, 57, 42, 33, 70, 218, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 68, 70, 170, 97, 137, 129, 131,
-  110, 140, 127, 71, 97, 175, 199, 195, 192, 177, 179, 212, 179, 167, 177, 176,
-  68, 80, 218, 81, 79, 57, 135, 176, 213, 213, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 218, 81, 68, 218, 151, 179, 147, 151, 57, 63, 131, 134, 142,
-  176, 155, 134, 134, 218, 148, 154, 179, 213, 127, 67, 69, 154, 157, 69, 64,
-  123, 199, 177, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 137,
-  71, 134, 213, 218, 179, 173, 36, 26, 57, 87, 115, 98, 67, 33, 4, 36,
-  127, 218, 218, 140, 72, 72, 177, 176, 71, 51, 104, 123, 137, 177, 218, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 151, 97, 95, 147, 218, 179,
-  177, 81, 33, 57, 106, 87, 71, 33, 17, 4, 17, 17, 36, 151, 179, 177,
-  213, 148, 63, 26, 54, 113, 93, 133, 218, 212, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 218, 179, 179, 179, 213, 179, 179, 177, 128, 81, 67,
-  71, 80, 95, 36, 34, 68, 68, 70, 129, 135, 218, 212, 135, 76, 101, 113,
-  115, 116, 218, 218, 82, 179, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 213, 213, 218, 218, 218, 218, 212, 74, 33, 70, 137, 133, 137,
-  199, 146, 143, 145, 90, 76, 52, 51, 26, 95, 129, 129, 179, 175, 129, 34,
-  218, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 154,
-  44, 34, 128, 218, 213, 218, 157, 74, 142, 170, 135, 84, 54, 54, 41, 26,
-  25, 26, 41, 63, 131, 154, 179, 175, 131, 57, 74, 218, 179, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 176, 4, 4, 68, 147, 199,
-  212, 218, 218, 213, 179, 218, 151, 137, 123, 131, 135, 106, 103, 84, 147, 179,
-  131, 84, 52, 57, 137, 175, 177, 177, 218, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 218, 26, 33, 69, 93, 173, 179, 199, 213, 218, 213,
+  146, 146, 146, 164, 164, 161, 129, 129, 72, 70, 70, 132, 179, 1, 1, 218,
+  1, 11, 32, 102, 162, 102, 3, 31, 111, 109, 144, 143, 125, 161, 192, 143,
+  162, 146, 143, 125, 111, 111, 143, 146, 131, 175, 213, 128, 67, 17, 119, 199,
+  176, 218, 179, 1, 11, 32, 113, 99, 192, 113, 9, 16, 107, 104, 123, 146,
+  125, 102, 29, 162, 123, 107, 121, 146, 121, 125, 162, 179, 177, 179, 218, 218,
+  179, 140, 18, 2, 135, 218, 1, 11, 32, 195, 146, 162, 199, 149, 100, 83,
+  31, 107, 109, 146, 30, 31, 162, 110, 144, 121, 122, 144, 146, 170, 218, 199,
+  173, 177, 218, 137, 80, 33, 17, 2, 135, 1, 12, 32, 218, 249, 19, 69,
+  127, 218, 101, 16, 65, 121, 9, 111, 162, 121, 122, 111, 111, 121, 162, 179,
+  213, 177, 213, 149, 213, 137, 71, 17, 33, 17, 27, 218, 1, 12, 32, 176,
+  18, 4, 127, 33, 67, 134, 138, 30, 25, 9, 162, 143, 104, 112, 146, 111,
+  125, 162, 179, 212, 151, 218, 131, 151, 137, 71, 17, 36, 34, 34, 218, 1,
+  11, 33, 218, 27, 4, 36, 140, 81, 33, 33, 67, 142, 83, 100, 192, 125,
+  121, 125, 125, 144, 146, 164, 199, 179, 173, 179, 129, 218, 81, 71, 34, 68,
+  33, 33, 218, 1, 11, 33, 134, 17, 79, 173, 137, 130, 72, 127, 72, 68,
+  137, 199, 170, 162, 146, 146, 146, 162, 162, 179, 213, 151, 218, 128, 69, 218,
+  81, 95, 57, 42, 33, 70, 218, 1, 11, 33, 68, 70, 170, 97, 137, 129,
+  131, 110, 140, 127, 71, 97, 175, 199, 195, 192, 177, 179, 212, 179, 167, 177,
+  176, 68, 80, 218, 81, 79, 57, 135, 176, 213, 213, 1, 10, 33, 218, 81,
+  68, 218, 151, 179, 147, 151, 57, 63, 131, 134, 142, 176, 155, 134, 134, 218,
+  148, 154, 179, 213, 127, 67, 69, 154, 157, 69, 64, 123, 199, 177, 212, 1,
+  10, 33, 218, 137, 71, 134, 213, 218, 179, 173, 36, 26, 57, 87, 115, 98,
+  67, 33, 4, 36, 127, 218, 218, 140, 72, 72, 177, 176, 71, 51, 104, 123,
+  137, 177, 218, 1, 10, 33, 218, 151, 97, 95, 147, 218, 179, 177, 81, 33,
+  57, 106, 87, 71, 33, 17, 4, 17, 17, 36, 151, 179, 177, 213, 148, 63,
+  26, 54, 113, 93, 133, 218, 212, 1, 11, 33, 218, 179, 179, 179, 213, 179,
+  179, 177, 128, 81, 67, 71, 80, 95, 36, 34, 68, 68, 70, 129, 135, 218,
+  212, 135, 76, 101, 113, 115, 116, 218, 218, 82, 179, 1, 14, 31, 213, 213,
+  218, 218, 218, 218, 212, 74, 33, 70, 137, 133, 137, 199, 146, 143, 145, 90,
+  76, 52, 51, 26, 95, 129, 129, 179, 175, 129, 34, 218, 213, 1, 14, 31,
+  218, 154, 44, 34, 128, 218, 213, 218, 157, 74, 142, 170, 135, 84, 54, 54,
+  41, 26, 25, 26, 41, 63, 131, 154, 179, 175, 131, 57, 74, 218, 179, 1,
+  14, 32, 213, 176, 4, 4, 68, 147, 199, 212, 218, 218, 213, 179, 218, 151,
+  137, 123, 131, 135, 106, 103, 84, 147, 179, 131, 84, 52, 57, 137, 175, 177,
+  177, 218, 1, 15, 31, 218, 26, 33, 69, 93, 173, 179, 199, 213, 218, 213,
   179, 218, 218, 213, 218, 218, 115, 114, 95, 63, 54, 41, 57, 54, 104, 213,
-  218, 151, 177, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  218, 140, 34, 95, 95, 151, 74, 130, 134, 154, 213, 218, 177, 173, 173, 137,
-  93, 84, 84, 57, 54, 57, 83, 87, 123, 155, 157, 154, 137, 177, 212, 213,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 218, 134, 95, 97,
-  136, 34, 81, 34, 69, 81, 218, 179, 179, 218, 148, 71, 77, 87, 83, 84,
-  76, 79, 128, 142, 36, 19, 103, 173, 213, 218, 179, 212, 213, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 170, 18, 134, 151, 115, 81, 33, 70, 36, 97,
-  80, 137, 218, 142, 73, 140, 154, 106, 84, 76, 51, 18, 33, 34, 52, 26,
-  93, 218, 218, 142, 134, 218, 218, 179, 179, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  218, 149, 17, 34, 151, 218, 68, 68, 81, 71, 114, 137, 98, 177, 179, 81,
-  82, 91, 101, 54, 83, 106, 84, 84, 77, 71, 82, 142, 90, 41, 33, 17,
-  69, 212, 218, 213, 179, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 127, 33, 36,
-  129, 218, 218, 177, 147, 167, 173, 151, 179, 218, 218, 98, 120, 82, 71, 57,
-  25, 87, 57, 36, 36, 93, 119, 4, 17, 33, 70, 33, 17, 74, 218, 218,
-  179, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 218, 134, 80, 97, 134, 134, 127, 142,
-  213, 218, 218, 218, 179, 213, 128, 74, 74, 34, 18, 4, 18, 26, 57, 63,
-  25, 26, 63, 33, 134, 218, 129, 69, 67, 69, 155, 218, 213, 179, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 218, 152, 131, 74, 67, 67, 95, 114, 137, 151, 170, 179,
-  218, 154, 98, 127, 127, 67, 33, 17, 33, 84, 11, 1, 57, 110, 128, 199,
-  179, 213, 177, 116, 71, 68, 127, 218, 218, 213, 179, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212,
-  177, 130, 69, 134, 71, 97, 95, 137, 167, 98, 154, 218, 147, 137, 129, 81,
-  82, 73, 67, 33, 95, 76, 16, 25, 76, 146, 104, 148, 218, 218, 179, 137,
-  93, 69, 72, 128, 212, 218, 179, 179, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 140, 127, 128, 69,
-  97, 97, 129, 148, 146, 151, 179, 218, 154, 137, 137, 80, 68, 67, 33, 71,
-  80, 71, 76, 51, 51, 87, 103, 104, 136, 179, 218, 218, 147, 95, 69, 72,
-  128, 218, 218, 179, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 179, 218, 130, 134, 213, 179, 213, 177, 177,
-  199, 218, 213, 218, 151, 146, 146, 98, 128, 70, 70, 68, 73, 71, 102, 63,
-  41, 63, 87, 87, 103, 115, 154, 218, 147, 97, 95, 68, 81, 155, 218, 218,
-  179, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 218, 199, 154, 142, 179, 212, 155, 140, 176, 213, 218,
-  213, 176, 127, 213, 173, 115, 116, 155, 128, 69, 91, 76, 41, 51, 76, 87,
-  87, 87, 135, 213, 179, 151, 129, 71, 69, 81, 134, 218, 179, 213, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 192, 136, 82, 128, 127, 74, 72, 72, 128, 142, 179, 179, 175, 212, 148,
-  144, 148, 81, 218, 73, 67, 91, 76, 51, 41, 41, 54, 76, 87, 103, 104,
-  148, 213, 147, 95, 80, 80, 134, 218, 213, 179, 213, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 170, 164, 132, 128,
-  36, 36, 36, 36, 36, 74, 155, 199, 218, 213, 199, 177, 173, 98, 134, 179,
-  72, 67, 71, 104, 84, 57, 54, 26, 51, 76, 87, 87, 103, 110, 103, 97,
-  97, 95, 137, 179, 218, 179, 213, 213, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 192, 164, 140, 127, 81, 127, 140,
-  153, 164, 179, 213, 179, 212, 218, 213, 213, 179, 218, 213, 134, 68, 69, 102,
-  87, 101, 76, 51, 26, 51, 76, 87, 64, 63, 101, 103, 97, 95, 116, 151,
-  213, 218, 179, 179, 213, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 170, 192, 192, 192, 192, 192, 255, 255, 255, 255, 218,
-  255, 213, 213, 213, 213, 218, 218, 218, 175, 81, 71, 115, 110, 101, 87, 76,
-  41, 26, 41, 84, 76, 101, 87, 84, 103, 95, 95, 129, 177, 218, 213, 179,
-  199, 213, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 212, 218,
-  151, 137, 154, 218, 218, 179, 157, 151, 173, 104, 101, 84, 57, 41, 57, 57,
-  54, 84, 57, 57, 104, 103, 95, 93, 133, 179, 218, 212, 179, 179, 213, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 179, 149, 97, 137, 137,
-  175, 218, 179, 81, 80, 122, 87, 103, 83, 57, 87, 57, 41, 101, 63, 54,
-  76, 101, 103, 95, 116, 151, 213, 218, 213, 179, 179, 213, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 179, 179, 213, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 213, 213, 218, 175, 103, 84, 95, 133, 175, 142, 81,
-  72, 84, 87, 101, 103, 101, 103, 57, 41, 76, 57, 26, 63, 101, 83, 95,
-  95, 129, 151, 179, 218, 218, 213, 179, 213, 213, 255, 255, 255, 255, 218, 218,
-  218, 218, 218, 218, 213, 179, 179, 213, 179, 213, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 213, 213, 218, 218, 151, 106, 84, 91, 137, 151, 176, 81, 71, 84, 87,
-  84, 101, 104, 63, 57, 104, 57, 26, 63, 54, 84, 103, 95, 95, 97, 137,
-  177, 213, 213, 179, 179, 218, 218, 218, 154, 54, 26, 41, 26, 103, 179, 179,
-  218, 218, 179, 218, 213, 179, 179, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 179, 218,
-  147, 137, 161, 104, 76, 95, 97, 147, 134, 68, 69, 41, 54, 76, 103, 83,
-  76, 84, 63, 76, 83, 51, 87, 101, 103, 95, 95, 93, 129, 179, 213, 179,
-  154, 179, 25, 0, 1, 2, 1, 2, 6, 19, 27, 41, 42, 37, 94, 218,
-  218, 213, 213, 179, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 212, 218, 137, 137, 137, 131,
-  106, 131, 114, 95, 80, 72, 84, 51, 26, 51, 76, 101, 101, 103, 101, 103,
-  76, 57, 101, 101, 101, 103, 95, 95, 175, 213, 218, 5, 1, 0, 1, 6,
-  20, 20, 19, 10, 10, 6, 3, 1, 11, 75, 94, 136, 179, 218, 218, 179,
-  255, 255, 255, 255, 255, 255, 213, 179, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 213, 212, 199, 218, 151, 137, 137, 131, 140, 213, 148, 106,
-  103, 95, 97, 76, 51, 41, 54, 57, 84, 103, 101, 87, 63, 84, 76, 87,
-  101, 84, 115, 218, 218, 136, 3, 0, 1, 1, 1, 3, 7, 15, 10, 10,
-  15, 20, 10, 96, 179, 153, 78, 35, 56, 136, 218, 213, 179, 255, 255, 255,
-  213, 179, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  218, 151, 177, 218, 1, 15, 32, 218, 140, 34, 95, 95, 151, 74, 130, 134,
+  154, 213, 218, 177, 173, 173, 137, 93, 84, 84, 57, 54, 57, 83, 87, 123,
+  155, 157, 154, 137, 177, 212, 213, 1, 15, 34, 218, 218, 134, 95, 97, 136,
+  34, 81, 34, 69, 81, 218, 179, 179, 218, 148, 71, 77, 87, 83, 84, 76,
+  79, 128, 142, 36, 19, 103, 173, 213, 218, 179, 212, 213, 1, 15, 35, 170,
+  18, 134, 151, 115, 81, 33, 70, 36, 97, 80, 137, 218, 142, 73, 140, 154,
+  106, 84, 76, 51, 18, 33, 34, 52, 26, 93, 218, 218, 142, 134, 218, 218,
+  179, 179, 1, 14, 37, 218, 149, 17, 34, 151, 218, 68, 68, 81, 71, 114,
+  137, 98, 177, 179, 81, 82, 91, 101, 54, 83, 106, 84, 84, 77, 71, 82,
+  142, 90, 41, 33, 17, 69, 212, 218, 213, 179, 1, 15, 37, 218, 127, 33,
+  36, 129, 218, 218, 177, 147, 167, 173, 151, 179, 218, 218, 98, 120, 82, 71,
+  57, 25, 87, 57, 36, 36, 93, 119, 4, 17, 33, 70, 33, 17, 74, 218,
+  218, 179, 1, 16, 38, 218, 134, 80, 97, 134, 134, 127, 142, 213, 218, 218,
+  218, 179, 213, 128, 74, 74, 34, 18, 4, 18, 26, 57, 63, 25, 26, 63,
+  33, 134, 218, 129, 69, 67, 69, 155, 218, 213, 179, 1, 17, 39, 218, 152,
+  131, 74, 67, 67, 95, 114, 137, 151, 170, 179, 218, 154, 98, 127, 127, 67,
+  33, 17, 33, 84, 11, 1, 57, 110, 128, 199, 179, 213, 177, 116, 71, 68,
+  127, 218, 218, 213, 179, 1, 17, 41, 212, 177, 130, 69, 134, 71, 97, 95,
+  137, 167, 98, 154, 218, 147, 137, 129, 81, 82, 73, 67, 33, 95, 76, 16,
+  25, 76, 146, 104, 148, 218, 218, 179, 137, 93, 69, 72, 128, 212, 218, 179,
+  179, 1, 18, 41, 213, 140, 127, 128, 69, 97, 97, 129, 148, 146, 151, 179,
+  218, 154, 137, 137, 80, 68, 67, 33, 71, 80, 71, 76, 51, 51, 87, 103,
+  104, 136, 179, 218, 218, 147, 95, 69, 72, 128, 218, 218, 179, 1, 19, 42,
+  179, 218, 130, 134, 213, 179, 213, 177, 177, 199, 218, 213, 218, 151, 146, 146,
+  98, 128, 70, 70, 68, 73, 71, 102, 63, 41, 63, 87, 87, 103, 115, 154,
+  218, 147, 97, 95, 68, 81, 155, 218, 218, 179, 1, 22, 41, 218, 199, 154,
+  142, 179, 212, 155, 140, 176, 213, 218, 213, 176, 127, 213, 173, 115, 116, 155,
+  128, 69, 91, 76, 41, 51, 76, 87, 87, 87, 135, 213, 179, 151, 129, 71,
+  69, 81, 134, 218, 179, 213, 1, 23, 42, 192, 136, 82, 128, 127, 74, 72,
+  72, 128, 142, 179, 179, 175, 212, 148, 144, 148, 81, 218, 73, 67, 91, 76,
+  51, 41, 41, 54, 76, 87, 103, 104, 148, 213, 147, 95, 80, 80, 134, 218,
+  213, 179, 213, 1, 23, 44, 170, 164, 132, 128, 36, 36, 36, 36, 36, 74,
+  155, 199, 218, 213, 199, 177, 173, 98, 134, 179, 72, 67, 71, 104, 84, 57,
+  54, 26, 51, 76, 87, 87, 103, 110, 103, 97, 97, 95, 137, 179, 218, 179,
+  213, 213, 1, 25, 45, 192, 164, 140, 127, 81, 127, 140, 153, 164, 179, 213,
+  179, 212, 218, 213, 213, 179, 218, 213, 134, 68, 69, 102, 87, 101, 76, 51,
+  26, 51, 76, 87, 64, 63, 101, 103, 97, 95, 116, 151, 213, 218, 179, 179,
+  213, 213, 3, 26, 6, 170, 192, 192, 192, 192, 192, 4, 1, 218, 1, 34,
+  213, 213, 213, 213, 218, 218, 218, 175, 81, 71, 115, 110, 101, 87, 76, 41,
+  26, 41, 84, 76, 101, 87, 84, 103, 95, 95, 129, 177, 218, 213, 179, 199,
+  213, 213, 1, 39, 34, 213, 212, 218, 151, 137, 154, 218, 218, 179, 157, 151,
+  173, 104, 101, 84, 57, 41, 57, 57, 54, 84, 57, 57, 104, 103, 95, 93,
+  133, 179, 218, 212, 179, 179, 213, 2, 40, 35, 213, 213, 179, 149, 97, 137,
+  137, 175, 218, 179, 81, 80, 122, 87, 103, 83, 57, 87, 57, 41, 101, 63,
+  54, 76, 101, 103, 95, 116, 151, 213, 218, 213, 179, 179, 213, 14, 4, 213,
+  179, 179, 213, 2, 41, 37, 213, 213, 218, 175, 103, 84, 95, 133, 175, 142,
+  81, 72, 84, 87, 101, 103, 101, 103, 57, 41, 76, 57, 26, 63, 101, 83,
+  95, 95, 129, 151, 179, 218, 218, 213, 179, 213, 213, 4, 12, 218, 218, 218,
+  218, 218, 218, 213, 179, 179, 213, 179, 213, 1, 42, 54, 213, 213, 218, 218,
+  151, 106, 84, 91, 137, 151, 176, 81, 71, 84, 87, 84, 101, 104, 63, 57,
+  104, 57, 26, 63, 54, 84, 103, 95, 95, 97, 137, 177, 213, 213, 179, 179,
+  218, 218, 218, 154, 54, 26, 41, 26, 103, 179, 179, 218, 218, 179, 218, 213,
+  179, 179, 1, 42, 56, 213, 213, 179, 218, 147, 137, 161, 104, 76, 95, 97,
+  147, 134, 68, 69, 41, 54, 76, 103, 83, 76, 84, 63, 76, 83, 51, 87,
+  101, 103, 95, 95, 93, 129, 179, 213, 179, 154, 179, 25, 0, 1, 2, 1,
+  2, 6, 19, 27, 41, 42, 37, 94, 218, 218, 213, 213, 179, 2, 43, 56,
+  213, 213, 212, 218, 137, 137, 137, 131, 106, 131, 114, 95, 80, 72, 84, 51,
+  26, 51, 76, 101, 101, 103, 101, 103, 76, 57, 101, 101, 101, 103, 95, 95,
+  175, 213, 218, 5, 1, 0, 1, 6, 20, 20, 19, 10, 10, 6, 3, 1,
+  11, 75, 94, 136, 179, 218, 218, 179, 6, 2, 213, 179, 2, 44, 57, 213,
+  212, 199, 218, 151, 137, 137, 131, 140, 213, 148, 106, 103, 95, 97, 76, 51,
+  41, 54, 57, 84, 103, 101, 87, 63, 84, 76, 87, 101, 84, 115, 218, 218,
+  136, 3, 0, 1, 1, 1, 3, 7, 15, 10, 10, 15, 20, 10, 96, 179,
+  153, 78, 35, 56, 136, 218, 213, 179, 3, 3, 213, 179, 218, 1, 45, 62,
   213, 213, 212, 218, 213, 173, 148, 114, 97, 151, 199, 136, 106, 84, 95, 103,
   83, 54, 41, 41, 54, 84, 87, 103, 101, 63, 84, 101, 84, 123, 218, 218,
   136, 48, 106, 149, 115, 136, 115, 3, 5, 10, 15, 10, 5, 5, 6, 10,
-  92, 218, 118, 92, 48, 94, 179, 213, 212, 213, 179, 179, 218, 132, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 212,
-  218, 218, 177, 137, 95, 151, 218, 199, 145, 103, 84, 104, 106, 103, 57, 51,
-  41, 41, 63, 101, 101, 87, 87, 87, 154, 218, 218, 132, 155, 218, 218, 218,
-  218, 218, 179, 106, 2, 5, 19, 78, 92, 45, 7, 75, 154, 218, 218, 179,
-  94, 179, 213, 213, 179, 218, 213, 41, 2, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 213, 179, 213, 179, 137, 147, 218, 167,
-  129, 147, 179, 218, 177, 103, 101, 145, 179, 149, 131, 84, 51, 51, 101, 87,
-  101, 87, 87, 154, 218, 218, 92, 119, 213, 213, 153, 155, 199, 212, 218, 91,
-  5, 56, 132, 140, 218, 94, 5, 22, 77, 119, 155, 218, 213, 212, 179, 218,
-  179, 11, 0, 2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 213, 179, 213, 137, 95, 131, 175, 177, 137, 131, 137, 179,
-  199, 115, 76, 101, 131, 154, 213, 149, 104, 101, 84, 84, 87, 84, 154, 218,
-  213, 48, 119, 218, 218, 119, 37, 176, 213, 179, 92, 48, 37, 23, 23, 21,
-  3, 0, 0, 1, 37, 119, 179, 213, 213, 213, 136, 37, 1, 1, 1, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  213, 213, 218, 177, 137, 97, 134, 213, 167, 113, 129, 147, 218, 149, 93, 106,
-  110, 104, 149, 179, 213, 148, 115, 101, 101, 154, 218, 218, 56, 154, 218, 218,
-  92, 35, 136, 199, 40, 35, 24, 75, 119, 132, 78, 26, 52, 41, 41, 154,
-  218, 213, 179, 218, 154, 11, 48, 23, 5, 1, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 218, 177,
-  146, 95, 137, 218, 199, 148, 129, 97, 151, 218, 147, 148, 123, 110, 103, 123,
-  213, 218, 179, 115, 179, 218, 92, 37, 153, 213, 218, 154, 37, 132, 218, 213,
-  140, 94, 179, 218, 179, 177, 218, 218, 218, 218, 218, 179, 213, 179, 132, 75,
-  35, 48, 37, 19, 10, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 212, 177, 167, 95, 97, 179,
-  213, 173, 137, 114, 106, 147, 131, 129, 147, 148, 104, 104, 149, 213, 173, 179,
-  213, 179, 56, 39, 154, 213, 218, 56, 56, 78, 132, 218, 218, 179, 119, 2,
-  3, 3, 1, 103, 218, 179, 213, 179, 213, 179, 77, 37, 44, 48, 10, 10,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 213, 213, 218, 213, 167, 129, 97, 177, 213, 199, 173, 143,
-  87, 84, 95, 97, 212, 177, 148, 146, 169, 179, 213, 218, 154, 55, 37, 155,
-  213, 218, 119, 35, 6, 138, 218, 179, 94, 24, 20, 23, 37, 27, 92, 218,
-  179, 213, 213, 179, 213, 179, 44, 140, 92, 6, 10, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  213, 213, 213, 199, 173, 148, 131, 218, 179, 151, 173, 146, 101, 104, 137, 177,
-  199, 177, 173, 167, 179, 213, 213, 179, 218, 153, 154, 218, 218, 153, 48, 20,
-  28, 179, 213, 218, 92, 75, 140, 218, 218, 179, 213, 213, 179, 179, 218, 218,
-  179, 136, 218, 94, 10, 10, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 213, 177,
-  173, 114, 151, 218, 179, 167, 173, 148, 154, 199, 177, 213, 218, 179, 167, 179,
-  212, 218, 153, 132, 218, 218, 153, 136, 218, 56, 39, 6, 149, 218, 213, 213,
-  179, 213, 179, 213, 213, 213, 213, 213, 56, 94, 94, 78, 179, 218, 92, 35,
-  15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 213, 213, 213, 213, 173, 148, 129, 175, 218,
-  177, 146, 173, 199, 218, 218, 218, 213, 218, 179, 173, 212, 218, 45, 19, 94,
-  218, 77, 55, 92, 37, 37, 40, 179, 213, 179, 213, 218, 218, 218, 179, 213,
-  179, 218, 153, 37, 35, 24, 120, 218, 136, 37, 23, 10, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 213, 213, 213, 179, 173, 148, 137, 218, 179, 173, 167, 173, 177,
-  177, 177, 177, 177, 177, 167, 213, 119, 53, 40, 154, 132, 35, 44, 35, 44,
-  44, 176, 218, 179, 218, 179, 114, 26, 92, 218, 179, 199, 218, 78, 37, 37,
-  94, 218, 136, 44, 37, 15, 10, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213,
-  199, 218, 177, 169, 146, 175, 218, 179, 151, 173, 173, 146, 146, 167, 173, 173,
-  179, 179, 179, 218, 179, 218, 153, 37, 35, 48, 35, 92, 218, 179, 218, 106,
-  1, 1, 0, 0, 96, 218, 179, 218, 94, 35, 48, 179, 153, 37, 44, 20,
-  10, 10, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 179, 213, 179, 169, 146,
-  151, 179, 179, 179, 218, 218, 177, 177, 177, 218, 218, 179, 218, 218, 179, 218,
-  213, 218, 132, 118, 48, 24, 92, 218, 179, 179, 11, 5, 10, 6, 1, 3,
-  179, 218, 213, 153, 37, 94, 218, 77, 35, 20, 7, 15, 10, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 213, 179, 218, 177, 167, 179, 213, 218, 213, 176,
+  92, 218, 118, 92, 48, 94, 179, 213, 212, 213, 179, 179, 218, 132, 1, 47,
+  60, 213, 213, 212, 218, 218, 177, 137, 95, 151, 218, 199, 145, 103, 84, 104,
+  106, 103, 57, 51, 41, 41, 63, 101, 101, 87, 87, 87, 154, 218, 218, 132,
+  155, 218, 218, 218, 218, 218, 179, 106, 2, 5, 19, 78, 92, 45, 7, 75,
+  154, 218, 218, 179, 94, 179, 213, 213, 179, 218, 213, 41, 2, 1, 47, 60,
+  213, 179, 213, 179, 137, 147, 218, 167, 129, 147, 179, 218, 177, 103, 101, 145,
+  179, 149, 131, 84, 51, 51, 101, 87, 101, 87, 87, 154, 218, 218, 92, 119,
+  213, 213, 153, 155, 199, 212, 218, 91, 5, 56, 132, 140, 218, 94, 5, 22,
+  77, 119, 155, 218, 213, 212, 179, 218, 179, 11, 0, 2, 1, 48, 59, 213,
+  179, 213, 137, 95, 131, 175, 177, 137, 131, 137, 179, 199, 115, 76, 101, 131,
+  154, 213, 149, 104, 101, 84, 84, 87, 84, 154, 218, 213, 48, 119, 218, 218,
+  119, 37, 176, 213, 179, 92, 48, 37, 23, 23, 21, 3, 0, 0, 1, 37,
+  119, 179, 213, 213, 213, 136, 37, 1, 1, 1, 1, 49, 58, 213, 213, 218,
+  177, 137, 97, 134, 213, 167, 113, 129, 147, 218, 149, 93, 106, 110, 104, 149,
+  179, 213, 148, 115, 101, 101, 154, 218, 218, 56, 154, 218, 218, 92, 35, 136,
+  199, 40, 35, 24, 75, 119, 132, 78, 26, 52, 41, 41, 154, 218, 213, 179,
+  218, 154, 11, 48, 23, 5, 1, 1, 50, 57, 213, 213, 218, 177, 146, 95,
+  137, 218, 199, 148, 129, 97, 151, 218, 147, 148, 123, 110, 103, 123, 213, 218,
+  179, 115, 179, 218, 92, 37, 153, 213, 218, 154, 37, 132, 218, 213, 140, 94,
+  179, 218, 179, 177, 218, 218, 218, 218, 218, 179, 213, 179, 132, 75, 35, 48,
+  37, 19, 10, 1, 51, 56, 213, 213, 212, 177, 167, 95, 97, 179, 213, 173,
+  137, 114, 106, 147, 131, 129, 147, 148, 104, 104, 149, 213, 173, 179, 213, 179,
+  56, 39, 154, 213, 218, 56, 56, 78, 132, 218, 218, 179, 119, 2, 3, 3,
+  1, 103, 218, 179, 213, 179, 213, 179, 77, 37, 44, 48, 10, 10, 1, 52,
+  55, 213, 213, 218, 213, 167, 129, 97, 177, 213, 199, 173, 143, 87, 84, 95,
+  97, 212, 177, 148, 146, 169, 179, 213, 218, 154, 55, 37, 155, 213, 218, 119,
+  35, 6, 138, 218, 179, 94, 24, 20, 23, 37, 27, 92, 218, 179, 213, 213,
+  179, 213, 179, 44, 140, 92, 6, 10, 1, 53, 54, 213, 213, 213, 199, 173,
+  148, 131, 218, 179, 151, 173, 146, 101, 104, 137, 177, 199, 177, 173, 167, 179,
+  213, 213, 179, 218, 153, 154, 218, 218, 153, 48, 20, 28, 179, 213, 218, 92,
+  75, 140, 218, 218, 179, 213, 213, 179, 179, 218, 218, 179, 136, 218, 94, 10,
+  10, 1, 54, 53, 213, 213, 213, 177, 173, 114, 151, 218, 179, 167, 173, 148,
+  154, 199, 177, 213, 218, 179, 167, 179, 212, 218, 153, 132, 218, 218, 153, 136,
+  218, 56, 39, 6, 149, 218, 213, 213, 179, 213, 179, 213, 213, 213, 213, 213,
+  56, 94, 94, 78, 179, 218, 92, 35, 15, 1, 54, 53, 213, 213, 213, 213,
+  173, 148, 129, 175, 218, 177, 146, 173, 199, 218, 218, 218, 213, 218, 179, 173,
+  212, 218, 45, 19, 94, 218, 77, 55, 92, 37, 37, 40, 179, 213, 179, 213,
+  218, 218, 218, 179, 213, 179, 218, 153, 37, 35, 24, 120, 218, 136, 37, 23,
+  10, 1, 55, 52, 213, 213, 213, 179, 173, 148, 137, 218, 179, 173, 167, 173,
+  177, 177, 177, 177, 177, 177, 167, 213, 119, 53, 40, 154, 132, 35, 44, 35,
+  44, 44, 176, 218, 179, 218, 179, 114, 26, 92, 218, 179, 199, 218, 78, 37,
+  37, 94, 218, 136, 44, 37, 15, 10, 1, 56, 51, 213, 199, 218, 177, 169,
+  146, 175, 218, 179, 151, 173, 173, 146, 146, 167, 173, 173, 179, 179, 179, 218,
+  179, 218, 153, 37, 35, 48, 35, 92, 218, 179, 218, 106, 1, 1, 0, 0,
+  96, 218, 179, 218, 94, 35, 48, 179, 153, 37, 44, 20, 10, 10, 1, 57,
+  50, 179, 213, 179, 169, 146, 151, 179, 179, 179, 218, 218, 177, 177, 177, 218,
+  218, 179, 218, 218, 179, 218, 213, 218, 132, 118, 48, 24, 92, 218, 179, 179,
+  11, 5, 10, 6, 1, 3, 179, 218, 213, 153, 37, 94, 218, 77, 35, 20,
+  7, 15, 10, 1, 57, 50, 213, 179, 218, 177, 167, 179, 213, 218, 213, 176,
   154, 179, 218, 179, 140, 94, 55, 92, 132, 179, 176, 179, 179, 179, 218, 92,
   56, 179, 179, 218, 119, 39, 56, 20, 10, 19, 1, 3, 96, 218, 213, 179,
-  213, 179, 48, 20, 10, 10, 5, 6, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 213, 213, 177, 173, 218, 155, 118, 78, 37, 24, 19, 37, 19, 24,
-  37, 44, 35, 48, 56, 56, 44, 44, 44, 119, 218, 179, 218, 213, 218, 218,
-  119, 35, 24, 7, 10, 19, 4, 1, 151, 218, 199, 213, 92, 24, 10, 6,
-  10, 78, 45, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 173,
-  177, 218, 136, 24, 37, 44, 20, 7, 10, 6, 20, 23, 23, 23, 5, 3,
-  10, 77, 77, 154, 218, 213, 218, 213, 179, 119, 176, 218, 77, 35, 19, 10,
-  10, 19, 6, 21, 120, 218, 119, 35, 19, 6, 28, 136, 218, 154, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 179, 179, 218, 140, 35, 48,
-  48, 20, 48, 218, 92, 10, 6, 5, 7, 3, 1, 11, 136, 179, 218, 179,
-  176, 179, 92, 44, 24, 92, 218, 155, 48, 24, 10, 10, 10, 15, 6, 19,
-  153, 118, 20, 15, 120, 218, 140, 94, 48, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 213, 179, 218, 94, 35, 44, 44, 44, 56, 154, 218,
-  55, 22, 78, 19, 15, 19, 153, 218, 179, 94, 56, 48, 48, 35, 44, 48,
-  37, 132, 155, 44, 44, 20, 10, 10, 10, 10, 45, 120, 138, 77, 154, 138,
-  55, 35, 35, 37, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213,
-  213, 179, 218, 55, 35, 44, 44, 48, 35, 75, 218, 119, 48, 218, 94, 23,
-  28, 154, 218, 155, 77, 23, 20, 19, 15, 20, 24, 44, 44, 37, 37, 48,
-  24, 7, 10, 10, 10, 75, 92, 55, 48, 56, 35, 35, 44, 44, 44, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 213, 213, 213, 213, 132, 48,
-  35, 44, 37, 35, 140, 218, 75, 48, 154, 218, 92, 35, 40, 154, 218, 218,
-  55, 6, 10, 10, 10, 10, 20, 23, 15, 19, 37, 44, 24, 10, 10, 10,
-  5, 19, 37, 37, 37, 44, 44, 44, 44, 44, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 213, 213, 179, 218, 154, 55, 37, 48, 48, 44,
-  44, 35, 56, 176, 218, 154, 48, 35, 154, 218, 179, 218, 94, 10, 19, 6,
-  19, 19, 10, 10, 7, 20, 48, 44, 15, 10, 10, 10, 20, 44, 44, 44,
-  44, 44, 44, 44, 44,
+  213, 179, 48, 20, 10, 10, 5, 6, 1, 58, 49, 213, 213, 177, 173, 218,
+  155, 118, 78, 37, 24, 19, 37, 19, 24, 37, 44, 35, 48, 56, 56, 44,
+  44, 44, 119, 218, 179, 218, 213, 218, 218, 119, 35, 24, 7, 10, 19, 4,
+  1, 151, 218, 199, 213, 92, 24, 10, 6, 10, 78, 45, 1, 59, 48, 218,
+  173, 177, 218, 136, 24, 37, 44, 20, 7, 10, 6, 20, 23, 23, 23, 5,
+  3, 10, 77, 77, 154, 218, 213, 218, 213, 179, 119, 176, 218, 77, 35, 19,
+  10, 10, 19, 6, 21, 120, 218, 119, 35, 19, 6, 28, 136, 218, 154, 1,
+  60, 47, 179, 179, 218, 140, 35, 48, 48, 20, 48, 218, 92, 10, 6, 5,
+  7, 3, 1, 11, 136, 179, 218, 179, 176, 179, 92, 44, 24, 92, 218, 155,
+  48, 24, 10, 10, 10, 15, 6, 19, 153, 118, 20, 15, 120, 218, 140, 94,
+  48, 1, 60, 47, 213, 179, 218, 94, 35, 44, 44, 44, 56, 154, 218, 55,
+  22, 78, 19, 15, 19, 153, 218, 179, 94, 56, 48, 48, 35, 44, 48, 37,
+  132, 155, 44, 44, 20, 10, 10, 10, 10, 45, 120, 138, 77, 154, 138, 55,
+  35, 35, 37, 1, 59, 48, 213, 213, 179, 218, 55, 35, 44, 44, 48, 35,
+  75, 218, 119, 48, 218, 94, 23, 28, 154, 218, 155, 77, 23, 20, 19, 15,
+  20, 24, 44, 44, 37, 37, 48, 24, 7, 10, 10, 10, 75, 92, 55, 48,
+  56, 35, 35, 44, 44, 44, 1, 59, 48, 213, 213, 213, 213, 132, 48, 35,
+  44, 37, 35, 140, 218, 75, 48, 154, 218, 92, 35, 40, 154, 218, 218, 55,
+  6, 10, 10, 10, 10, 20, 23, 15, 19, 37, 44, 24, 10, 10, 10, 5,
+  19, 37, 37, 37, 44, 44, 44, 44, 44, 1, 60, 47, 213, 213, 179, 218,
+  154, 55, 37, 48, 48, 44, 44, 35, 56, 176, 218, 154, 48, 35, 154, 218,
+  179, 218, 94, 10, 19, 6, 19, 19, 10, 10, 7, 20, 48, 44, 15, 10,
+  10, 10, 20, 44, 44, 44, 44, 44, 44, 44, 44,
 };
 
 #endif
@@ -8,1004 +8,429 @@
 #define GUN_SHOOT_HEIGHT 116
 #define GUN_SHOOT_TRANSPARENT_IDX 255
 
-typedef struct { int x, y, w, h; int offset; } gun_shoot_frame_t;
+// spans: offset of the frame in gun_shoot_spans, lines: index of its first row in gun_shoot_lines
+typedef struct { int x, y, w, h; int spans, lines; } gun_shoot_frame_t;
 
 static const gun_shoot_frame_t gun_shoot_frame_info[2] = {
-  { 42, 0, 66, 115, 0 },
-  { 33, 6, 75, 109, 7590 },
+  { 42, 0, 66, 115, 0, 0 },
+  { 33, 6, 75, 109, 3085, 115 },
 };
 
 static const uint16_t gun_shoot_palette[256] = {
 61208, 52757, 46549, 38293, 52497, 44239, 40144, 31954, 50254, 40013, 33871, 33741, 29776, 27664, 27663, 21455, 43915, 33674, 31562, 31561, 29582, 29517, 29517, 29517, 31496, 25486, 23438, 23437, 27469, 21325, 21325, 21325, 21260, 45707, 39562, 31497, 33353, 27404, 29448, 25356, 27337, 27210, 23244, 19212, 23243, 21131, 21130, 19083, 23112, 21065, 19212, 19147, 17099, 17099, 19082, 19018, 16970, 16969, 14986, 14986, 14986, 14921, 14922, 12873, 12873, 10825, 33289, 29193, 29127, 25033, 24966, 20999, 18952, 20937, 20936, 20806, 16905, 16905, 16840, 16839, 16776, 16776, 16710, 16645, 12808, 12808, 10760, 14856, 10759, 14792, 12743, 14726, 12679, 14663, 12678, 12614, 10564, 12550, 10501, 12548, 10501, 10760, 10760, 10760, 10695, 10694, 8647, 8582, 8582, 6535, 10566, 8581, 6469, 10566, 6469, 6470, 6469, 4421, 2373, 10500, 10500, 8453, 8452, 8389, 8387, 6340, 4356, 4356, 4356, 4291, 2308, 2243, 10435, 8387, 6340, 6338, 6275, 6340, 6276, 6339, 6275, 6210, 4292, 4228, 4227, 4227, 4226, 4226, 4162, 4162, 4161, 2243, 2242, 2178, 2242, 2178, 2179, 2179, 2179, 2179, 2178, 2114, 2114, 2114, 2114, 2113, 2113, 2113, 2113, 2113, 2113, 2242, 2242, 2178, 2178, 2178, 2178, 2178, 2177, 2114, 2114, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2113, 2049, 2049, 2049, 2049, 2048, 130, 130, 129, 130, 65, 66, 65, 65, 65, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20481, 0, 0, 0, 0, 0, 63519
 };
 
-static const uint8_t gun_shoot_pixels[15765] = {
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 96, 152, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 203, 57, 2, 87, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 152, 112, 87, 87,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 152, 203,
-  14, 12, 203, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 152, 153, 107, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 152, 153, 112, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 152, 153, 153, 153, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 152, 153, 152, 153, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 153, 152, 153, 152, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 152, 153, 152, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 152, 153, 152,
-  153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 152,
-  153, 152, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 152, 153, 153, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 153, 153, 153, 152, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 153, 152, 153, 63, 152, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 152, 203, 57, 57, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 129, 57, 20, 153, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 152, 129, 10,
-  84, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 153,
-  111, 112, 126, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 152, 199, 201, 153, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 201, 201, 153, 152, 153, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 107, 112, 152, 153, 153, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 12, 3, 58, 153, 153, 126, 255, 255, 255, 14,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 3, 29, 201, 153, 126, 13, 126, 255,
-  26, 14, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 32, 63, 117, 107, 117, 107,
-  131, 131, 112, 126, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 54, 255, 52, 63, 131, 51,
-  11, 39, 20, 28, 105, 201, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11, 152, 107, 112,
-  201, 29, 2, 2, 2, 2, 63, 131, 58, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 27, 27,
-  212, 131, 107, 112, 14, 13, 7, 7, 86, 104, 29, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  112, 14, 29, 118, 13, 63, 43, 12, 13, 13, 58, 126, 131, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 153, 15, 32, 52, 86, 43, 29, 32, 14, 63, 131, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 212, 111, 107, 54, 112, 58, 29, 43, 26, 47, 117,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 107, 43, 153, 203, 84, 58, 104, 43, 43, 52,
-  43, 107, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 29, 84, 84, 107, 29, 107, 26,
-  26, 26, 43, 109, 131, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 126, 14, 43, 84,
-  112, 58, 63, 62, 62, 106, 131, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 14,
-  51, 86, 117, 86, 86, 86, 86, 86, 126, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 212, 152, 152, 112, 63, 126, 112, 152, 201, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  212, 58, 84, 58, 86, 107, 131, 131, 131, 131, 199, 212, 212, 255, 255, 255,
-  255, 255, 212, 201, 126, 104, 12, 29, 84, 3, 7, 12, 7, 7, 129, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208,
-  165, 146, 165, 86, 14, 52, 84, 131, 43, 25, 20, 14, 20, 26, 52, 255,
-  255, 212, 126, 126, 52, 14, 12, 7, 12, 54, 63, 63, 203, 131, 126, 3,
-  107, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  165, 212, 132, 8, 34, 88, 12, 61, 107, 152, 12, 7, 2, 2, 2, 3,
-  12, 199, 88, 26, 12, 12, 7, 61, 153, 131, 212, 126, 32, 107, 112, 86,
-  115, 7, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 165, 212, 66, 34, 130, 58, 106, 112, 112, 13, 65, 13, 14,
-  14, 26, 26, 107, 7, 7, 105, 153, 152, 131, 107, 107, 126, 105, 27, 112,
-  54, 26, 117, 7, 107, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 165, 212, 132, 69, 142, 29, 61, 104, 112, 15, 63,
-  13, 14, 14, 14, 13, 112, 126, 130, 117, 86, 106, 58, 43, 106, 130, 112,
-  27, 43, 51, 29, 115, 7, 112, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 165, 146, 156, 14, 32, 63, 112,
-  43, 65, 27, 14, 14, 25, 13, 63, 106, 62, 58, 25, 14, 26, 58, 106,
-  131, 111, 61, 26, 54, 29, 107, 13, 126, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 203, 58, 88,
-  107, 84, 12, 52, 43, 27, 27, 14, 29, 107, 117, 63, 58, 47, 58, 52,
-  52, 106, 126, 152, 61, 52, 63, 62, 117, 7, 112, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 212,
-  86, 43, 104, 43, 58, 126, 52, 25, 29, 26, 65, 130, 117, 86, 52, 29,
-  43, 43, 47, 106, 115, 131, 58, 43, 86, 65, 118, 12, 107, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 208,
-  146, 212, 63, 10, 106, 26, 52, 58, 86, 43, 12, 51, 63, 112, 130, 106,
-  43, 43, 29, 29, 52, 106, 115, 126, 61, 84, 63, 86, 115, 43, 129, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212,
+// start of each row in gun_shoot_spans, relative to its frame
+static const uint16_t gun_shoot_lines[224] = {
+  0, 6, 13, 20, 28, 35, 42, 49, 56, 63, 70, 78, 86, 93, 100, 108,
+  115, 123, 131, 139, 147, 155, 163, 175, 190, 203, 219, 235, 251, 267, 281, 295,
+  310, 325, 339, 364, 395, 433, 471, 508, 545, 580, 614, 648, 684, 721, 758, 796,
+  836, 873, 904, 935, 968, 1003, 1038, 1074, 1112, 1149, 1186, 1223, 1260, 1295, 1330, 1365,
+  1400, 1433, 1466, 1498, 1529, 1561, 1593, 1624, 1654, 1683, 1711, 1738, 1762, 1786, 1811, 1836,
+  1861, 1885, 1910, 1935, 1960, 1985, 2011, 2037, 2063, 2089, 2116, 2142, 2169, 2196, 2223, 2251,
+  2279, 2307, 2336, 2365, 2395, 2424, 2461, 2502, 2547, 2597, 2647, 2697, 2746, 2795, 2844, 2893,
+  2941, 2989, 3037, 0, 5, 12, 20, 28, 35, 43, 51, 59, 66, 74, 82, 91,
+  99, 108, 117, 127, 136, 144, 152, 165, 179, 192, 205, 220, 241, 266, 291, 317,
+  344, 373, 404, 438, 475, 513, 550, 585, 617, 647, 675, 704, 733, 762, 791, 820,
+  851, 883, 916, 950, 985, 1021, 1057, 1092, 1127, 1162, 1196, 1230, 1264, 1298, 1332, 1366,
+  1399, 1431, 1463, 1494, 1525, 1556, 1588, 1620, 1651, 1683, 1714, 1738, 1762, 1786, 1811, 1836,
+  1861, 1887, 1914, 1940, 1967, 1993, 2020, 2047, 2075, 2104, 2133, 2163, 2192, 2225, 2266, 2312,
+  2360, 2411, 2461, 2511, 2563, 2615, 2666, 2717, 2768, 2818, 2868, 2918, 2967, 3016, 3064, 3112,
+};
+
+// per row: span count, then { skip, run, run indices } for each span
+static const uint8_t gun_shoot_spans[6244] = {
+  1, 9, 3, 153, 96, 152, 1, 8, 4, 203, 57, 2, 87, 1, 8, 4,
+  152, 112, 87, 87, 1, 8, 5, 152, 203, 14, 12, 203, 1, 9, 4, 152,
+  153, 107, 153, 1, 9, 4, 152, 153, 112, 153, 1, 9, 4, 152, 153, 153,
+  153, 1, 9, 4, 152, 153, 152, 153, 1, 8, 4, 153, 152, 153, 152, 1,
+  8, 4, 153, 152, 153, 152, 1, 8, 5, 153, 152, 153, 152, 153, 1, 8,
+  5, 153, 152, 153, 152, 153, 1, 9, 4, 152, 153, 153, 153, 1, 9, 4,
+  153, 153, 153, 152, 1, 9, 5, 153, 152, 153, 63, 152, 1, 10, 4, 152,
+  203, 57, 57, 1, 10, 5, 153, 129, 57, 20, 153, 1, 10, 5, 153, 152,
+  129, 10, 84, 1, 10, 5, 153, 153, 111, 112, 126, 1, 11, 5, 152, 199,
+  201, 153, 153, 1, 11, 5, 201, 201, 153, 152, 153, 1, 11, 5, 107, 112,
+  152, 153, 153, 2, 10, 6, 12, 3, 58, 153, 153, 126, 3, 1, 14, 2,
+  10, 7, 3, 29, 201, 153, 126, 13, 126, 1, 3, 26, 14, 153, 1, 10,
+  10, 32, 63, 117, 107, 117, 107, 131, 131, 112, 126, 2, 8, 1, 54, 1,
+  10, 52, 63, 131, 51, 11, 39, 20, 28, 105, 201, 1, 8, 13, 11, 152,
+  107, 112, 201, 29, 2, 2, 2, 2, 63, 131, 58, 1, 8, 13, 27, 27,
+  212, 131, 107, 112, 14, 13, 7, 7, 86, 104, 29, 1, 8, 13, 112, 14,
+  29, 118, 13, 63, 43, 12, 13, 13, 58, 126, 131, 1, 9, 11, 153, 15,
+  32, 52, 86, 43, 29, 32, 14, 63, 131, 1, 9, 11, 212, 111, 107, 54,
+  112, 58, 29, 43, 26, 47, 117, 1, 8, 12, 107, 43, 153, 203, 84, 58,
+  104, 43, 43, 52, 43, 107, 1, 9, 12, 29, 84, 84, 107, 29, 107, 26,
+  26, 26, 43, 109, 131, 1, 10, 11, 126, 14, 43, 84, 112, 58, 63, 62,
+  62, 106, 131, 2, 10, 11, 212, 14, 51, 86, 117, 86, 86, 86, 86, 86,
+  126, 11, 9, 212, 152, 152, 112, 63, 126, 112, 152, 201, 2, 10, 13, 212,
+  58, 84, 58, 86, 107, 131, 131, 131, 131, 199, 212, 212, 5, 13, 212, 201,
+  126, 104, 12, 29, 84, 3, 7, 12, 7, 7, 129, 2, 6, 17, 208, 208,
+  165, 146, 165, 86, 14, 52, 84, 131, 43, 25, 20, 14, 20, 26, 52, 2,
+  16, 212, 126, 126, 52, 14, 12, 7, 12, 54, 63, 63, 203, 131, 126, 3,
+  107, 1, 6, 35, 165, 212, 132, 8, 34, 88, 12, 61, 107, 152, 12, 7,
+  2, 2, 2, 3, 12, 199, 88, 26, 12, 12, 7, 61, 153, 131, 212, 126,
+  32, 107, 112, 86, 115, 7, 111, 1, 7, 34, 165, 212, 66, 34, 130, 58,
+  106, 112, 112, 13, 65, 13, 14, 14, 26, 26, 107, 7, 7, 105, 153, 152,
+  131, 107, 107, 126, 105, 27, 112, 54, 26, 117, 7, 107, 1, 7, 34, 165,
+  212, 132, 69, 142, 29, 61, 104, 112, 15, 63, 13, 14, 14, 14, 13, 112,
+  126, 130, 117, 86, 106, 58, 43, 106, 130, 112, 27, 43, 51, 29, 115, 7,
+  112, 1, 9, 32, 165, 146, 156, 14, 32, 63, 112, 43, 65, 27, 14, 14,
+  25, 13, 63, 106, 62, 58, 25, 14, 26, 58, 106, 131, 111, 61, 26, 54,
+  29, 107, 13, 126, 1, 10, 31, 212, 203, 58, 88, 107, 84, 12, 52, 43,
+  27, 27, 14, 29, 107, 117, 63, 58, 47, 58, 52, 52, 106, 126, 152, 61,
+  52, 63, 62, 117, 7, 112, 1, 10, 31, 212, 212, 86, 43, 104, 43, 58,
+  126, 52, 25, 29, 26, 65, 130, 117, 86, 52, 29, 43, 43, 47, 106, 115,
+  131, 58, 43, 86, 65, 118, 12, 107, 1, 8, 33, 212, 208, 146, 212, 63,
+  10, 106, 26, 52, 58, 86, 43, 12, 51, 63, 112, 130, 106, 43, 43, 29,
+  29, 52, 106, 115, 126, 61, 84, 63, 86, 115, 43, 129, 1, 7, 34, 212,
   96, 1, 5, 212, 112, 43, 107, 29, 29, 13, 58, 29, 43, 29, 43, 109,
   126, 106, 106, 106, 51, 43, 58, 106, 130, 152, 61, 84, 106, 58, 115, 43,
-  129, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 212, 44, 6, 21, 212, 131, 63, 107, 29, 32, 112, 106, 43, 29, 26,
-  43, 86, 126, 107, 117, 106, 117, 117, 107, 131, 126, 112, 58, 104, 106, 43,
-  63, 52, 152, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 165, 124, 122, 212, 94, 212, 131, 29, 105, 52, 29, 104, 115, 58,
-  29, 29, 43, 63, 131, 152, 126, 117, 86, 29, 43, 26, 7, 7, 43, 29,
-  29, 29, 13, 29, 203, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 212, 212, 148, 66, 75, 35, 36, 75, 203, 58, 88, 62, 26, 58,
-  117, 62, 62, 62, 58, 65, 130, 32, 7, 7, 12, 26, 26, 43, 63, 106,
-  112, 52, 107, 88, 88, 107, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 150, 212, 68, 36, 40, 18, 40, 66, 212, 86, 104, 58,
-  29, 61, 126, 106, 86, 86, 86, 106, 126, 112, 107, 112, 118, 130, 203, 199,
-  152, 201, 201, 255, 203, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 208, 37, 212, 34, 66, 33, 70, 68, 75, 212, 63,
-  112, 106, 58, 52, 107, 106, 65, 86, 86, 86, 115, 201, 139, 97, 68, 135,
-  212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 79, 16, 212, 165, 124, 70, 66, 132, 212,
-  165, 126, 84, 107, 52, 58, 112, 106, 106, 106, 106, 106, 109, 153, 138, 41,
-  8, 83, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 96, 8, 34, 212, 75, 82, 83, 136,
-  153, 161, 203, 126, 43, 107, 43, 52, 112, 109, 86, 106, 106, 86, 107, 153,
-  148, 92, 37, 34, 212, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 83, 33, 136, 198, 99, 67,
-  41, 122, 146, 161, 208, 199, 27, 112, 65, 26, 63, 117, 86, 106, 106, 106,
-  109, 131, 204, 123, 45, 36, 194, 208, 208, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 198, 141, 75, 8, 132,
-  212, 97, 82, 136, 122, 143, 161, 212, 29, 25, 131, 61, 58, 117, 106, 106,
-  86, 86, 106, 117, 139, 156, 110, 21, 83, 212, 165, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 124, 16,
-  33, 136, 212, 73, 4, 41, 80, 143, 156, 212, 152, 7, 10, 112, 58, 117,
-  115, 109, 115, 107, 107, 117, 165, 156, 142, 95, 70, 212, 212, 165, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 71,
-  75, 34, 69, 98, 212, 83, 75, 212, 165, 161, 203, 161, 212, 153, 105, 63,
-  26, 126, 115, 126, 58, 61, 126, 118, 122, 125, 212, 98, 33, 9, 122, 212,
-  165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  82, 8, 132, 122, 73, 97, 212, 212, 124, 75, 66, 67, 146, 161, 156, 212,
-  212, 178, 61, 52, 130, 112, 6, 1, 28, 131, 131, 208, 125, 73, 68, 5,
-  39, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 132, 33, 148, 208, 93, 156, 165, 212, 74, 41, 41, 41, 80, 165,
-  204, 144, 165, 212, 203, 105, 152, 199, 105, 3, 3, 112, 203, 161, 144, 70,
-  34, 8, 99, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 208, 135, 82, 165, 144, 143, 165, 212, 122, 76, 57, 56,
-  80, 74, 124, 204, 161, 212, 194, 203, 153, 178, 115, 52, 52, 126, 153, 208,
-  82, 33, 8, 8, 150, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 212, 70, 41, 136, 212, 143, 161, 212, 148, 73,
-  56, 72, 37, 1, 75, 144, 121, 165, 212, 165, 165, 203, 58, 29, 43, 96,
-  203, 97, 34, 75, 132, 124, 212, 165, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 136, 73, 125, 212, 156, 161, 212,
-  136, 72, 61, 16, 4, 16, 146, 161, 94, 72, 98, 212, 165, 208, 152, 29,
-  25, 126, 98, 69, 122, 208, 142, 161, 212, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 165, 80, 123, 212, 165,
-  146, 208, 165, 80, 46, 8, 33, 212, 150, 212, 212, 139, 28, 98, 212, 165,
-  208, 212, 212, 122, 95, 125, 165, 156, 97, 194, 208, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 98, 123,
-  203, 122, 78, 212, 212, 97, 41, 75, 124, 97, 34, 79, 212, 208, 72, 20,
-  96, 212, 165, 165, 194, 144, 212, 57, 121, 82, 93, 208, 208, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212,
-  144, 76, 146, 208, 161, 208, 208, 148, 73, 92, 73, 44, 44, 42, 165, 212,
-  139, 49, 6, 136, 212, 212, 146, 208, 122, 28, 48, 69, 121, 203, 212, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 136, 122, 204, 165, 208, 208, 208, 208, 46, 72, 165, 212, 212, 91,
-  78, 208, 212, 132, 4, 39, 165, 153, 73, 165, 79, 45, 66, 73, 144, 212,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 212, 161, 146, 165, 156, 203, 208, 208, 165, 91, 49, 94,
-  84, 111, 21, 139, 212, 33, 41, 20, 94, 144, 92, 146, 28, 41, 69, 123,
-  165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 165, 178, 204, 161, 165, 208, 194, 212, 141,
-  83, 16, 41, 49, 39, 49, 165, 99, 41, 47, 28, 161, 212, 122, 79, 78,
-  92, 204, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 96, 70, 212, 208, 165, 212,
-  139, 125, 161, 99, 70, 66, 48, 47, 121, 124, 36, 61, 21, 39, 129, 122,
-  121, 80, 123, 156, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 122, 34, 75, 124,
-  208, 194, 161, 138, 97, 83, 75, 66, 69, 54, 90, 165, 69, 41, 54, 39,
-  39, 146, 91, 93, 143, 98, 212, 208, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 135, 34,
-  34, 36, 135, 208, 208, 161, 161, 136, 97, 74, 67, 69, 55, 107, 141, 34,
-  92, 111, 46, 56, 80, 125, 123, 95, 212, 194, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  199, 82, 36, 70, 75, 99, 146, 161, 156, 125, 83, 136, 125, 72, 55, 76,
-  121, 41, 96, 212, 165, 165, 142, 204, 82, 75, 212, 165, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 199, 96, 75, 70, 75, 152, 153, 212, 148, 122, 82, 75, 82,
-  80, 96, 76, 39, 45, 125, 212, 194, 203, 97, 66, 122, 203, 208, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 129, 129, 124, 129, 199, 165, 208, 212, 212, 212,
-  129, 123, 98, 110, 76, 42, 28, 44, 146, 212, 208, 141, 165, 36, 132, 212,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 203, 208, 203, 194, 208, 208, 165,
-  208, 194, 161, 136, 95, 72, 61, 56, 42, 28, 28, 94, 165, 212, 75, 33,
-  165, 194, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 194, 194, 208, 165,
-  208, 156, 165, 208, 208, 212, 212, 165, 148, 146, 89, 76, 56, 96, 212, 138,
-  41, 4, 96, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  208, 212, 208, 156, 161, 212, 208, 194, 208, 165, 91, 78, 78, 72, 45, 212,
-  212, 136, 78, 46, 194, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 208, 136, 165, 156, 161, 212, 161, 165, 212, 212, 110, 47, 44, 39,
-  79, 122, 122, 212, 212, 212, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 212, 93, 136, 203, 156, 212, 165, 156, 98, 148, 146, 61,
-  76, 139, 97, 66, 83, 212, 165, 165, 208, 208, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 212, 93, 91, 208, 144, 212, 208, 208, 122, 80,
-  148, 90, 92, 69, 4, 34, 141, 212, 156, 165, 208, 208, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 148, 93, 148, 161, 212, 161, 161,
-  212, 208, 148, 76, 45, 21, 6, 4, 99, 212, 144, 165, 208, 208, 208, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 146, 148, 203, 165,
-  208, 156, 97, 98, 212, 122, 45, 28, 21, 6, 36, 150, 156, 161, 212, 208,
-  208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 212,
-  165, 165, 208, 208, 161, 80, 82, 98, 55, 28, 20, 45, 44, 132, 204, 142,
-  161, 212, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  208, 208, 208, 208, 208, 208, 156, 143, 97, 80, 55, 28, 20, 28, 55, 146,
-  203, 142, 156, 208, 208, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 208, 208, 208, 165, 208, 161, 143, 156, 156, 92, 55, 28, 20,
-  45, 146, 208, 143, 143, 165, 208, 165, 208, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 208, 165, 212, 121, 142, 212, 125, 110, 156, 142, 61,
-  45, 20, 39, 94, 212, 161, 143, 123, 212, 194, 208, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 208, 165, 212, 136, 110, 203, 156, 92, 76,
-  142, 142, 61, 28, 20, 54, 165, 203, 142, 98, 212, 208, 208, 208, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 194, 97, 156, 165,
-  156, 146, 57, 110, 156, 89, 28, 28, 122, 212, 125, 80, 148, 212, 194, 208,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 165, 212, 98,
-  125, 212, 156, 144, 90, 47, 107, 112, 55, 45, 90, 212, 146, 73, 148, 212,
-  208, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 165,
-  212, 136, 92, 208, 125, 156, 139, 54, 57, 57, 57, 76, 56, 122, 208, 80,
-  79, 136, 212, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  208, 165, 212, 139, 80, 156, 144, 143, 208, 110, 47, 28, 39, 45, 39, 61,
-  143, 121, 73, 73, 148, 212, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 208, 194, 212, 93, 138, 165, 123, 121, 165, 57, 45, 28, 20,
-  20, 45, 107, 156, 80, 73, 97, 212, 165, 208, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 208, 165, 212, 139, 93, 165, 204, 123, 194, 165, 76,
-  56, 42, 20, 44, 61, 142, 80, 73, 80, 148, 212, 165, 208, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 208, 165, 212, 146, 80, 203, 161, 97, 92,
-  129, 144, 80, 76, 39, 28, 55, 142, 123, 73, 73, 97, 212, 165, 165, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 165, 212, 98, 136, 144,
-  73, 72, 76, 165, 121, 72, 92, 39, 28, 92, 121, 73, 76, 73, 148, 212,
-  194, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 212, 148,
-  98, 208, 80, 97, 76, 129, 143, 73, 122, 122, 89, 54, 76, 45, 45, 72,
-  98, 212, 165, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208,
+  129, 1, 7, 34, 212, 44, 6, 21, 212, 131, 63, 107, 29, 32, 112, 106,
+  43, 29, 26, 43, 86, 126, 107, 117, 106, 117, 117, 107, 131, 126, 112, 58,
+  104, 106, 43, 63, 52, 152, 1, 6, 35, 165, 124, 122, 212, 94, 212, 131,
+  29, 105, 52, 29, 104, 115, 58, 29, 29, 43, 63, 131, 152, 126, 117, 86,
+  29, 43, 26, 7, 7, 43, 29, 29, 29, 13, 29, 203, 1, 4, 37, 212,
+  212, 148, 66, 75, 35, 36, 75, 203, 58, 88, 62, 26, 58, 117, 62, 62,
+  62, 58, 65, 130, 32, 7, 7, 12, 26, 26, 43, 63, 106, 112, 52, 107,
+  88, 88, 107, 153, 2, 4, 31, 150, 212, 68, 36, 40, 18, 40, 66, 212,
+  86, 104, 58, 29, 61, 126, 106, 86, 86, 86, 106, 126, 112, 107, 112, 118,
+  130, 203, 199, 152, 201, 201, 1, 1, 203, 1, 3, 28, 208, 37, 212, 34,
+  66, 33, 70, 68, 75, 212, 63, 112, 106, 58, 52, 107, 106, 65, 86, 86,
+  86, 115, 201, 139, 97, 68, 135, 212, 1, 3, 28, 79, 16, 212, 165, 124,
+  70, 66, 132, 212, 165, 126, 84, 107, 52, 58, 112, 106, 106, 106, 106, 106,
+  109, 153, 138, 41, 8, 83, 212, 1, 2, 30, 96, 8, 34, 212, 75, 82,
+  83, 136, 153, 161, 203, 126, 43, 107, 43, 52, 112, 109, 86, 106, 106, 86,
+  107, 153, 148, 92, 37, 34, 212, 165, 1, 1, 32, 212, 83, 33, 136, 198,
+  99, 67, 41, 122, 146, 161, 208, 199, 27, 112, 65, 26, 63, 117, 86, 106,
+  106, 106, 109, 131, 204, 123, 45, 36, 194, 208, 208, 1, 1, 32, 198, 141,
+  75, 8, 132, 212, 97, 82, 136, 122, 143, 161, 212, 29, 25, 131, 61, 58,
+  117, 106, 106, 86, 86, 106, 117, 139, 156, 110, 21, 83, 212, 165, 1, 1,
+  33, 208, 124, 16, 33, 136, 212, 73, 4, 41, 80, 143, 156, 212, 152, 7,
+  10, 112, 58, 117, 115, 109, 115, 107, 107, 117, 165, 156, 142, 95, 70, 212,
+  212, 165, 1, 0, 35, 208, 71, 75, 34, 69, 98, 212, 83, 75, 212, 165,
+  161, 203, 161, 212, 153, 105, 63, 26, 126, 115, 126, 58, 61, 126, 118, 122,
+  125, 212, 98, 33, 9, 122, 212, 165, 1, 0, 34, 82, 8, 132, 122, 73,
+  97, 212, 212, 124, 75, 66, 67, 146, 161, 156, 212, 212, 178, 61, 52, 130,
+  112, 6, 1, 28, 131, 131, 208, 125, 73, 68, 5, 39, 212, 1, 0, 34,
+  132, 33, 148, 208, 93, 156, 165, 212, 74, 41, 41, 41, 80, 165, 204, 144,
+  165, 212, 203, 105, 152, 199, 105, 3, 3, 112, 203, 161, 144, 70, 34, 8,
+  99, 212, 1, 0, 34, 208, 135, 82, 165, 144, 143, 165, 212, 122, 76, 57,
+  56, 80, 74, 124, 204, 161, 212, 194, 203, 153, 178, 115, 52, 52, 126, 153,
+  208, 82, 33, 8, 8, 150, 208, 1, 0, 34, 212, 70, 41, 136, 212, 143,
+  161, 212, 148, 73, 56, 72, 37, 1, 75, 144, 121, 165, 212, 165, 165, 203,
+  58, 29, 43, 96, 203, 97, 34, 75, 132, 124, 212, 165, 1, 1, 32, 136,
+  73, 125, 212, 156, 161, 212, 136, 72, 61, 16, 4, 16, 146, 161, 94, 72,
+  98, 212, 165, 208, 152, 29, 25, 126, 98, 69, 122, 208, 142, 161, 212, 1,
+  1, 32, 165, 80, 123, 212, 165, 146, 208, 165, 80, 46, 8, 33, 212, 150,
+  212, 212, 139, 28, 98, 212, 165, 208, 212, 212, 122, 95, 125, 165, 156, 97,
+  194, 208, 1, 1, 32, 212, 98, 123, 203, 122, 78, 212, 212, 97, 41, 75,
+  124, 97, 34, 79, 212, 208, 72, 20, 96, 212, 165, 165, 194, 144, 212, 57,
+  121, 82, 93, 208, 208, 1, 1, 32, 212, 144, 76, 146, 208, 161, 208, 208,
+  148, 73, 92, 73, 44, 44, 42, 165, 212, 139, 49, 6, 136, 212, 212, 146,
+  208, 122, 28, 48, 69, 121, 203, 212, 1, 2, 30, 136, 122, 204, 165, 208,
+  208, 208, 208, 46, 72, 165, 212, 212, 91, 78, 208, 212, 132, 4, 39, 165,
+  153, 73, 165, 79, 45, 66, 73, 144, 212, 1, 2, 30, 212, 161, 146, 165,
+  156, 203, 208, 208, 165, 91, 49, 94, 84, 111, 21, 139, 212, 33, 41, 20,
+  94, 144, 92, 146, 28, 41, 69, 123, 165, 208, 1, 3, 29, 165, 178, 204,
+  161, 165, 208, 194, 212, 141, 83, 16, 41, 49, 39, 49, 165, 99, 41, 47,
+  28, 161, 212, 122, 79, 78, 92, 204, 165, 208, 1, 4, 28, 96, 70, 212,
+  208, 165, 212, 139, 125, 161, 99, 70, 66, 48, 47, 121, 124, 36, 61, 21,
+  39, 129, 122, 121, 80, 123, 156, 208, 208, 1, 3, 29, 199, 122, 34, 75,
+  124, 208, 194, 161, 138, 97, 83, 75, 66, 69, 54, 90, 165, 69, 41, 54,
+  39, 39, 146, 91, 93, 143, 98, 212, 208, 1, 3, 29, 199, 135, 34, 34,
+  36, 135, 208, 208, 161, 161, 136, 97, 74, 67, 69, 55, 107, 141, 34, 92,
+  111, 46, 56, 80, 125, 123, 95, 212, 194, 1, 4, 28, 199, 82, 36, 70,
+  75, 99, 146, 161, 156, 125, 83, 136, 125, 72, 55, 76, 121, 41, 96, 212,
+  165, 165, 142, 204, 82, 75, 212, 165, 1, 5, 27, 199, 96, 75, 70, 75,
+  152, 153, 212, 148, 122, 82, 75, 82, 80, 96, 76, 39, 45, 125, 212, 194,
+  203, 97, 66, 122, 203, 208, 1, 6, 26, 129, 129, 124, 129, 199, 165, 208,
+  212, 212, 212, 129, 123, 98, 110, 76, 42, 28, 44, 146, 212, 208, 141, 165,
+  36, 132, 212, 1, 7, 25, 203, 208, 203, 194, 208, 208, 165, 208, 194, 161,
+  136, 95, 72, 61, 56, 42, 28, 28, 94, 165, 212, 75, 33, 165, 194, 1,
+  8, 24, 194, 194, 208, 165, 208, 156, 165, 208, 208, 212, 212, 165, 148, 146,
+  89, 76, 56, 96, 212, 138, 41, 4, 96, 212, 1, 10, 21, 208, 212, 208,
+  156, 161, 212, 208, 194, 208, 165, 91, 78, 78, 72, 45, 212, 212, 136, 78,
+  46, 194, 1, 10, 21, 208, 136, 165, 156, 161, 212, 161, 165, 212, 212, 110,
+  47, 44, 39, 79, 122, 122, 212, 212, 212, 208, 1, 10, 22, 212, 93, 136,
+  203, 156, 212, 165, 156, 98, 148, 146, 61, 76, 139, 97, 66, 83, 212, 165,
+  165, 208, 208, 1, 10, 22, 212, 93, 91, 208, 144, 212, 208, 208, 122, 80,
+  148, 90, 92, 69, 4, 34, 141, 212, 156, 165, 208, 208, 1, 11, 22, 148,
+  93, 148, 161, 212, 161, 161, 212, 208, 148, 76, 45, 21, 6, 4, 99, 212,
+  144, 165, 208, 208, 208, 1, 12, 21, 146, 148, 203, 165, 208, 156, 97, 98,
+  212, 122, 45, 28, 21, 6, 36, 150, 156, 161, 212, 208, 208, 1, 12, 22,
+  212, 212, 165, 165, 208, 208, 161, 80, 82, 98, 55, 28, 20, 45, 44, 132,
+  204, 142, 161, 212, 208, 208, 1, 12, 22, 208, 208, 208, 208, 208, 208, 156,
+  143, 97, 80, 55, 28, 20, 28, 55, 146, 203, 142, 156, 208, 208, 165, 1,
+  13, 22, 208, 208, 208, 165, 208, 161, 143, 156, 156, 92, 55, 28, 20, 45,
+  146, 208, 143, 143, 165, 208, 165, 208, 1, 13, 22, 208, 165, 212, 121, 142,
+  212, 125, 110, 156, 142, 61, 45, 20, 39, 94, 212, 161, 143, 123, 212, 194,
+  208, 1, 13, 23, 208, 165, 212, 136, 110, 203, 156, 92, 76, 142, 142, 61,
+  28, 20, 54, 165, 203, 142, 98, 212, 208, 208, 208, 1, 13, 23, 208, 208,
+  208, 194, 97, 156, 165, 156, 146, 57, 110, 156, 89, 28, 28, 122, 212, 125,
+  80, 148, 212, 194, 208, 1, 14, 23, 208, 165, 212, 98, 125, 212, 156, 144,
+  90, 47, 107, 112, 55, 45, 90, 212, 146, 73, 148, 212, 208, 208, 208, 1,
+  14, 23, 208, 165, 212, 136, 92, 208, 125, 156, 139, 54, 57, 57, 57, 76,
+  56, 122, 208, 80, 79, 136, 212, 208, 208, 1, 14, 24, 208, 165, 212, 139,
+  80, 156, 144, 143, 208, 110, 47, 28, 39, 45, 39, 61, 143, 121, 73, 73,
+  148, 212, 165, 208, 1, 15, 23, 208, 194, 212, 93, 138, 165, 123, 121, 165,
+  57, 45, 28, 20, 20, 45, 107, 156, 80, 73, 97, 212, 165, 208, 1, 15,
+  24, 208, 165, 212, 139, 93, 165, 204, 123, 194, 165, 76, 56, 42, 20, 44,
+  61, 142, 80, 73, 80, 148, 212, 165, 208, 1, 15, 24, 208, 165, 212, 146,
+  80, 203, 161, 97, 92, 129, 144, 80, 76, 39, 28, 55, 142, 123, 73, 73,
+  97, 212, 165, 165, 1, 16, 24, 208, 165, 212, 98, 136, 144, 73, 72, 76,
+  165, 121, 72, 92, 39, 28, 92, 121, 73, 76, 73, 148, 212, 194, 165, 1,
+  16, 25, 208, 208, 212, 148, 98, 208, 80, 97, 76, 129, 143, 73, 122, 122,
+  89, 54, 76, 45, 45, 72, 98, 212, 165, 165, 208, 1, 16, 25, 208, 208,
   194, 212, 95, 165, 97, 73, 98, 89, 156, 144, 95, 121, 125, 56, 39, 20,
-  28, 55, 93, 208, 208, 208, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 208, 194, 212, 93, 98, 165, 73, 148, 122, 123, 161, 212, 110, 146, 84,
-  42, 28, 20, 44, 73, 122, 212, 165, 208, 165, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 208, 208, 208, 165, 98, 208, 80, 122, 208, 143, 143, 212, 136,
-  122, 139, 56, 55, 20, 21, 55, 73, 148, 212, 208, 165, 208, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 208, 208, 165, 212, 98, 136, 143, 98, 212, 156, 143,
-  161, 165, 97, 212, 94, 56, 28, 28, 56, 73, 93, 165, 208, 194, 208, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 208, 208, 165, 212, 148, 98, 161, 123, 212,
-  144, 142, 143, 208, 98, 161, 144, 56, 54, 39, 56, 76, 73, 95, 212, 165,
-  208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 203, 122, 161,
-  125, 212, 136, 97, 143, 208, 136, 98, 212, 76, 56, 44, 44, 61, 73, 98,
-  212, 165, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 208,
-  165, 165, 156, 208, 212, 80, 123, 204, 121, 93, 212, 122, 61, 45, 28, 56,
-  72, 93, 165, 208, 208, 165, 208, 255, 255, 255, 255, 255, 255, 255, 165, 165,
-  165, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208,
-  208, 208, 208, 212, 144, 146, 212, 97, 93, 204, 110, 55, 122, 212, 122, 61,
-  37, 45, 76, 73, 97, 212, 165, 208, 208, 255, 255, 255, 255, 255, 208, 165,
-  212, 212, 212, 212, 165, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  212, 208, 208, 208, 165, 212, 144, 121, 165, 165, 80, 165, 212, 61, 90, 212,
-  165, 107, 84, 54, 57, 76, 80, 148, 212, 208, 165, 208, 255, 255, 208, 165,
-  165, 212, 94, 11, 37, 139, 212, 212, 165, 208, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 208, 208, 208, 208, 208, 165, 194, 208, 212, 121, 146, 212, 125,
-  54, 161, 122, 84, 123, 55, 57, 57, 73, 97, 212, 165, 208, 165, 208, 208,
-  165, 212, 212, 28, 0, 0, 0, 0, 6, 146, 208, 165, 208, 255, 208, 208,
-  208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 208, 208, 208, 208, 208, 208, 165, 208, 165, 144, 203,
-  208, 212, 61, 110, 92, 47, 123, 61, 56, 56, 76, 89, 146, 212, 208, 208,
-  165, 208, 208, 44, 6, 1, 11, 71, 94, 9, 5, 9, 146, 208, 208, 208,
-  208, 165, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 208, 208, 208, 165, 136, 212,
-  136, 161, 212, 212, 161, 123, 61, 89, 92, 92, 54, 57, 57, 92, 110, 212,
-  165, 208, 165, 212, 10, 0, 1, 38, 212, 212, 212, 119, 19, 71, 212, 165,
-  208, 208, 208, 212, 194, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 208, 165, 212,
-  98, 165, 136, 98, 212, 165, 203, 143, 61, 144, 107, 143, 92, 56, 55, 92,
-  92, 129, 212, 165, 212, 94, 0, 1, 17, 165, 124, 71, 79, 212, 71, 79,
-  212, 165, 208, 165, 208, 124, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 208,
-  165, 212, 146, 144, 212, 98, 165, 208, 208, 203, 142, 142, 146, 142, 156, 61,
-  54, 110, 110, 92, 212, 165, 212, 46, 0, 5, 165, 96, 17, 19, 24, 146,
-  48, 71, 212, 165, 165, 212, 212, 38, 79, 165, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208,
+  28, 55, 93, 208, 208, 208, 165, 1, 17, 25, 208, 194, 212, 93, 98, 165,
+  73, 148, 122, 123, 161, 212, 110, 146, 84, 42, 28, 20, 44, 73, 122, 212,
+  165, 208, 165, 1, 17, 26, 208, 208, 208, 165, 98, 208, 80, 122, 208, 143,
+  143, 212, 136, 122, 139, 56, 55, 20, 21, 55, 73, 148, 212, 208, 165, 208,
+  1, 17, 26, 208, 208, 165, 212, 98, 136, 143, 98, 212, 156, 143, 161, 165,
+  97, 212, 94, 56, 28, 28, 56, 73, 93, 165, 208, 194, 208, 1, 17, 27,
+  208, 208, 165, 212, 148, 98, 161, 123, 212, 144, 142, 143, 208, 98, 161, 144,
+  56, 54, 39, 56, 76, 73, 95, 212, 165, 208, 208, 1, 18, 26, 208, 208,
+  208, 203, 122, 161, 125, 212, 136, 97, 143, 208, 136, 98, 212, 76, 56, 44,
+  44, 61, 73, 98, 212, 165, 208, 208, 2, 18, 27, 208, 208, 208, 208, 165,
+  165, 156, 208, 212, 80, 123, 204, 121, 93, 212, 122, 61, 45, 28, 56, 72,
+  93, 165, 208, 208, 165, 208, 7, 5, 165, 165, 165, 165, 208, 2, 18, 27,
+  208, 208, 208, 208, 208, 212, 144, 146, 212, 97, 93, 204, 110, 55, 122, 212,
+  122, 61, 37, 45, 76, 73, 97, 212, 165, 208, 208, 5, 9, 208, 165, 212,
+  212, 212, 212, 165, 165, 208, 2, 18, 28, 212, 208, 208, 208, 165, 212, 144,
+  121, 165, 165, 80, 165, 212, 61, 90, 212, 165, 107, 84, 54, 57, 76, 80,
+  148, 212, 208, 165, 208, 2, 12, 208, 165, 165, 212, 94, 11, 37, 139, 212,
+  212, 165, 208, 2, 19, 42, 208, 208, 208, 208, 208, 165, 194, 208, 212, 121,
+  146, 212, 125, 54, 161, 122, 84, 123, 55, 57, 57, 73, 97, 212, 165, 208,
+  165, 208, 208, 165, 212, 212, 28, 0, 0, 0, 0, 6, 146, 208, 165, 208,
+  1, 3, 208, 208, 208, 1, 19, 47, 208, 208, 208, 208, 208, 208, 165, 208,
+  165, 144, 203, 208, 212, 61, 110, 92, 47, 123, 61, 56, 56, 76, 89, 146,
+  212, 208, 208, 165, 208, 208, 44, 6, 1, 11, 71, 94, 9, 5, 9, 146,
+  208, 208, 208, 208, 165, 208, 208, 1, 19, 47, 208, 208, 208, 208, 208, 208,
+  165, 136, 212, 136, 161, 212, 212, 161, 123, 61, 89, 92, 92, 54, 57, 57,
+  92, 110, 212, 165, 208, 165, 212, 10, 0, 1, 38, 212, 212, 212, 119, 19,
+  71, 212, 165, 208, 208, 208, 212, 194, 208, 1, 20, 46, 208, 208, 208, 208,
+  165, 212, 98, 165, 136, 98, 212, 165, 203, 143, 61, 144, 107, 143, 92, 56,
+  55, 92, 92, 129, 212, 165, 212, 94, 0, 1, 17, 165, 124, 71, 79, 212,
+  71, 79, 212, 165, 208, 165, 208, 124, 208, 208, 1, 20, 46, 208, 208, 208,
+  208, 165, 212, 146, 144, 212, 98, 165, 208, 208, 203, 142, 142, 146, 142, 156,
+  61, 54, 110, 110, 92, 212, 165, 212, 46, 0, 5, 165, 96, 17, 19, 24,
+  146, 48, 71, 212, 165, 165, 212, 212, 38, 79, 165, 1, 20, 46, 208, 208,
   208, 208, 208, 194, 208, 161, 212, 144, 144, 212, 194, 212, 156, 143, 87, 142,
   156, 112, 56, 89, 90, 165, 208, 165, 212, 10, 0, 9, 17, 38, 19, 38,
-  19, 96, 96, 71, 212, 165, 203, 165, 11, 9, 48, 194, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  208, 208, 208, 208, 208, 208, 208, 161, 161, 208, 161, 208, 208, 208, 156, 143,
-  92, 92, 143, 143, 92, 144, 165, 212, 208, 212, 161, 1, 4, 9, 9, 24,
-  19, 24, 19, 122, 79, 71, 212, 165, 212, 146, 2, 17, 91, 212, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 208, 208, 208, 208, 208, 208, 203, 156, 161, 112, 165, 208, 208,
-  161, 156, 112, 44, 107, 203, 165, 212, 212, 165, 71, 165, 72, 4, 9, 9,
-  19, 24, 24, 24, 19, 19, 71, 165, 165, 165, 212, 6, 4, 24, 79, 212,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 208, 208, 208, 208, 208, 208, 208, 161, 208, 144, 153,
-  212, 208, 208, 156, 153, 121, 125, 212, 212, 165, 78, 6, 24, 208, 91, 5,
-  9, 19, 24, 24, 24, 38, 38, 96, 212, 165, 212, 212, 6, 1, 17, 38,
-  150, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 208, 208, 208, 208, 208, 208,
-  212, 208, 208, 208, 212, 161, 161, 212, 212, 212, 96, 1, 1, 9, 24, 96,
-  40, 9, 82, 71, 19, 38, 17, 71, 212, 208, 208, 212, 146, 37, 1, 9,
-  19, 119, 212, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 208, 208, 208, 208,
-  208, 208, 208, 208, 208, 208, 208, 165, 165, 165, 165, 212, 46, 4, 19, 38,
-  38, 17, 17, 146, 212, 212, 91, 19, 48, 124, 212, 208, 165, 37, 5, 4,
-  11, 79, 91, 208, 208, 165, 255, 112, 39, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 152, 153, 14, 112, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 152, 203, 61, 20,
-  212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 153, 152, 203, 25, 90, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 152, 203, 43, 84, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 152,
-  152, 152, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 152, 153, 153, 153, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 152, 153, 153, 152, 153, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 152,
-  153, 153, 152, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 152, 153, 153, 152, 153, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 152, 153, 153, 153, 152, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  153, 152, 153, 152, 153, 201, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 152, 201, 122,
-  112, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 153, 152, 153, 129, 12, 111, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 152, 152, 203, 44, 20, 203, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 152,
-  153, 152, 14, 94, 203, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 152, 152, 203, 111, 84, 203,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 152, 152, 153, 152, 153, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 152, 152, 153, 153, 152, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 201, 178, 153, 153,
-  152, 201, 255, 255, 20, 20, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 117, 112, 131, 153, 153, 126, 255, 65, 13,
-  61, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 6, 26, 199, 153, 131, 15, 86, 107, 63, 201, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 20, 12, 201,
-  126, 115, 107, 122, 111, 111, 112, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 107, 43, 117, 62, 20, 28, 2, 1,
-  7, 199, 65, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 84, 61, 122, 43, 112, 112, 3, 2, 7, 3, 7, 131, 26, 104, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 152, 212, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 46, 28, 255, 117,
-  112, 131, 43, 14, 12, 7, 26, 107, 126, 199, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 203, 10, 28, 153, 212, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 25, 52, 131, 109, 13, 106, 13, 13,
-  14, 29, 107, 201, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 20,
-  6, 6, 2, 44, 126, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 112, 54, 14, 62, 51, 58, 58, 43, 26, 27, 63, 117, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 178, 90, 1, 2, 54, 12, 10, 14,
-  129, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  126, 29, 84, 61, 130, 52, 43, 43, 43, 58, 199, 255, 255, 255, 255, 255,
-  255, 255, 212, 72, 0, 52, 86, 10, 58, 7, 43, 58, 201, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 153, 112, 126, 51, 104,
-  86, 43, 25, 27, 63, 117, 255, 255, 255, 255, 255, 255, 203, 44, 3, 15,
-  129, 86, 58, 54, 27, 13, 43, 52, 201, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 14, 29, 111, 105, 52, 63, 63, 43, 86, 63, 86,
-  115, 255, 255, 255, 255, 255, 212, 27, 2, 26, 126, 29, 13, 106, 26, 203,
-  13, 13, 15, 104, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  153, 84, 86, 12, 63, 105, 106, 86, 65, 86, 63, 106, 199, 255, 255, 255,
-  201, 26, 3, 105, 107, 29, 29, 32, 52, 62, 126, 131, 58, 15, 7, 126,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 165, 150, 146, 153, 27, 51,
-  130, 109, 65, 106, 86, 106, 131, 129, 111, 129, 52, 7, 12, 105, 112, 29,
-  13, 47, 63, 13, 112, 201, 201, 105, 94, 112, 153, 153, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 212, 119, 4, 8, 132, 88, 84, 63, 104, 117, 112, 107,
-  32, 10, 3, 1, 61, 7, 58, 126, 61, 52, 27, 58, 109, 43, 112, 201,
-  152, 117, 61, 43, 58, 107, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 165,
-  208, 10, 36, 82, 156, 44, 29, 58, 199, 107, 3, 2, 3, 7, 7, 104,
-  126, 104, 52, 43, 26, 29, 86, 43, 106, 203, 152, 107, 117, 152, 130, 126,
-  126, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 212, 203, 73, 125,
-  14, 32, 61, 131, 43, 43, 29, 25, 25, 13, 32, 152, 52, 58, 29, 43,
-  63, 52, 58, 201, 152, 117, 112, 111, 107, 131, 153, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 165, 148, 156, 65, 88, 86, 199, 29,
-  58, 32, 13, 14, 14, 26, 126, 58, 29, 29, 86, 52, 52, 212, 126, 117,
-  112, 107, 115, 152, 152, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 208, 212, 104, 52, 61, 84, 84, 52, 62, 14, 29, 29,
-  26, 117, 88, 47, 63, 29, 112, 201, 131, 126, 104, 106, 126, 152, 153, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  212, 153, 27, 57, 63, 61, 12, 58, 26, 29, 14, 29, 86, 126, 52, 52,
-  112, 201, 131, 107, 106, 112, 107, 126, 153, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 208, 146, 203, 58, 61, 86,
-  26, 58, 112, 62, 29, 26, 58, 58, 117, 51, 112, 201, 131, 107, 126, 117,
-  106, 126, 178, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 165, 119, 1, 5, 212, 126, 14, 105, 52, 32, 52, 58, 43,
-  25, 27, 29, 58, 152, 153, 126, 112, 126, 107, 117, 131, 153, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 139, 2,
+  19, 96, 96, 71, 212, 165, 203, 165, 11, 9, 48, 194, 1, 20, 46, 208,
+  208, 208, 208, 208, 208, 208, 161, 161, 208, 161, 208, 208, 208, 156, 143, 92,
+  92, 143, 143, 92, 144, 165, 212, 208, 212, 161, 1, 4, 9, 9, 24, 19,
+  24, 19, 122, 79, 71, 212, 165, 212, 146, 2, 17, 91, 212, 1, 21, 45,
+  208, 208, 208, 208, 208, 208, 203, 156, 161, 112, 165, 208, 208, 161, 156, 112,
+  44, 107, 203, 165, 212, 212, 165, 71, 165, 72, 4, 9, 9, 19, 24, 24,
+  24, 19, 19, 71, 165, 165, 165, 212, 6, 4, 24, 79, 212, 1, 21, 45,
+  208, 208, 208, 208, 208, 208, 208, 161, 208, 144, 153, 212, 208, 208, 156, 153,
+  121, 125, 212, 212, 165, 78, 6, 24, 208, 91, 5, 9, 19, 24, 24, 24,
+  38, 38, 96, 212, 165, 212, 212, 6, 1, 17, 38, 150, 208, 1, 21, 45,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 212, 208, 208, 208, 212, 161, 161,
+  212, 212, 212, 96, 1, 1, 9, 24, 96, 40, 9, 82, 71, 19, 38, 17,
+  71, 212, 208, 208, 212, 146, 37, 1, 9, 19, 119, 212, 165, 1, 21, 45,
+  208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 208, 165, 165,
+  165, 165, 212, 46, 4, 19, 38, 38, 17, 17, 146, 212, 212, 91, 19, 48,
+  124, 212, 208, 165, 37, 5, 4, 11, 79, 91, 208, 208, 165, 1, 1, 2,
+  112, 39, 1, 0, 4, 152, 153, 14, 112, 1, 0, 5, 152, 203, 61, 20,
+  212, 1, 0, 5, 153, 152, 203, 25, 90, 1, 1, 4, 152, 203, 43, 84,
+  1, 1, 5, 153, 152, 152, 152, 153, 1, 1, 5, 153, 152, 153, 153, 153,
+  1, 1, 5, 152, 153, 153, 152, 153, 1, 1, 4, 152, 153, 153, 152, 1,
+  1, 5, 152, 153, 153, 152, 153, 1, 1, 5, 152, 153, 153, 153, 152, 1,
+  1, 6, 153, 152, 153, 152, 153, 201, 1, 2, 5, 153, 152, 201, 122, 112,
+  1, 2, 6, 153, 152, 153, 129, 12, 111, 1, 3, 6, 152, 152, 203, 44,
+  20, 203, 1, 3, 7, 153, 152, 153, 152, 14, 94, 203, 1, 4, 6, 152,
+  152, 203, 111, 84, 203, 1, 5, 5, 152, 152, 153, 152, 153, 1, 5, 5,
+  152, 152, 153, 153, 152, 2, 5, 6, 201, 178, 153, 153, 152, 201, 2, 2,
+  20, 20, 2, 5, 6, 117, 112, 131, 153, 153, 126, 1, 3, 65, 13, 61,
+  1, 5, 10, 6, 26, 199, 153, 131, 15, 86, 107, 63, 201, 1, 5, 10,
+  20, 12, 201, 126, 115, 107, 122, 111, 111, 112, 1, 5, 12, 107, 43, 117,
+  62, 20, 28, 2, 1, 7, 199, 65, 63, 2, 3, 14, 84, 61, 122, 43,
+  112, 112, 3, 2, 7, 3, 7, 131, 26, 104, 11, 2, 152, 212, 3, 3,
+  2, 46, 28, 1, 11, 117, 112, 131, 43, 14, 12, 7, 26, 107, 126, 199,
+  10, 5, 203, 10, 28, 153, 212, 2, 4, 12, 25, 52, 131, 109, 13, 106,
+  13, 13, 14, 29, 107, 201, 10, 8, 212, 20, 6, 6, 2, 44, 126, 153,
+  2, 4, 12, 112, 54, 14, 62, 51, 58, 58, 43, 26, 27, 63, 117, 9,
+  9, 178, 90, 1, 2, 54, 12, 10, 14, 129, 2, 6, 11, 126, 29, 84,
+  61, 130, 52, 43, 43, 43, 58, 199, 7, 11, 212, 72, 0, 52, 86, 10,
+  58, 7, 43, 58, 201, 2, 6, 11, 153, 112, 126, 51, 104, 86, 43, 25,
+  27, 63, 117, 6, 13, 203, 44, 3, 15, 129, 86, 58, 54, 27, 13, 43,
+  52, 201, 2, 5, 12, 14, 29, 111, 105, 52, 63, 63, 43, 86, 63, 86,
+  115, 5, 14, 212, 27, 2, 26, 126, 29, 13, 106, 26, 203, 13, 13, 15,
+  104, 2, 5, 13, 153, 84, 86, 12, 63, 105, 106, 86, 65, 86, 63, 106,
+  199, 3, 16, 201, 26, 3, 105, 107, 29, 29, 32, 52, 62, 126, 131, 58,
+  15, 7, 126, 1, 4, 34, 165, 150, 146, 153, 27, 51, 130, 109, 65, 106,
+  86, 106, 131, 129, 111, 129, 52, 7, 12, 105, 112, 29, 13, 47, 63, 13,
+  112, 201, 201, 105, 94, 112, 153, 153, 1, 3, 35, 212, 119, 4, 8, 132,
+  88, 84, 63, 104, 117, 112, 107, 32, 10, 3, 1, 61, 7, 58, 126, 61,
+  52, 27, 58, 109, 43, 112, 201, 152, 117, 61, 43, 58, 107, 153, 1, 3,
+  34, 165, 208, 10, 36, 82, 156, 44, 29, 58, 199, 107, 3, 2, 3, 7,
+  7, 104, 126, 104, 52, 43, 26, 29, 86, 43, 106, 203, 152, 107, 117, 152,
+  130, 126, 126, 1, 4, 32, 208, 212, 203, 73, 125, 14, 32, 61, 131, 43,
+  43, 29, 25, 25, 13, 32, 152, 52, 58, 29, 43, 63, 52, 58, 201, 152,
+  117, 112, 111, 107, 131, 153, 1, 6, 29, 165, 148, 156, 65, 88, 86, 199,
+  29, 58, 32, 13, 14, 14, 26, 126, 58, 29, 29, 86, 52, 52, 212, 126,
+  117, 112, 107, 115, 152, 152, 1, 7, 27, 208, 212, 104, 52, 61, 84, 84,
+  52, 62, 14, 29, 29, 26, 117, 88, 47, 63, 29, 112, 201, 131, 126, 104,
+  106, 126, 152, 153, 1, 8, 25, 212, 153, 27, 57, 63, 61, 12, 58, 26,
+  29, 14, 29, 86, 126, 52, 52, 112, 201, 131, 107, 106, 112, 107, 126, 153,
+  1, 6, 26, 212, 208, 146, 203, 58, 61, 86, 26, 58, 112, 62, 29, 26,
+  58, 58, 117, 51, 112, 201, 131, 107, 126, 117, 106, 126, 178, 1, 5, 26,
+  165, 119, 1, 5, 212, 126, 14, 105, 52, 32, 52, 58, 43, 25, 27, 29,
+  58, 152, 153, 126, 112, 126, 107, 117, 131, 153, 1, 4, 26, 212, 139, 2,
   6, 91, 212, 203, 14, 61, 62, 43, 13, 52, 52, 29, 29, 26, 43, 126,
-  126, 107, 107, 112, 131, 152, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 212, 146, 121, 79, 153, 212, 212, 63,
-  32, 84, 26, 58, 130, 63, 58, 58, 62, 63, 86, 201, 126, 115, 199, 153,
-  203, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 212, 203, 48, 37, 34, 66, 148, 126, 12, 105, 52, 52, 107,
-  86, 62, 62, 62, 58, 58, 126, 131, 153, 94, 34, 124, 208, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 139, 5,
-  11, 36, 36, 8, 119, 208, 52, 61, 63, 29, 54, 130, 65, 63, 86, 106,
-  86, 112, 153, 82, 33, 6, 33, 212, 165, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 165, 212, 96, 16, 68, 98, 143, 93, 161,
-  203, 86, 43, 58, 29, 54, 112, 106, 86, 63, 63, 62, 63, 95, 73, 34,
-  5, 1, 70, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 208, 203, 212, 212, 144, 98, 97, 203, 165, 165, 126, 43, 111, 52,
-  58, 104, 106, 62, 63, 86, 86, 86, 111, 80, 69, 33, 4, 1, 135, 212,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 212,
-  70, 24, 24, 132, 83, 146, 212, 203, 58, 84, 63, 52, 63, 117, 106, 86,
-  63, 86, 63, 117, 95, 69, 68, 75, 8, 8, 129, 212, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 208, 165, 146, 212, 68, 4, 9, 75, 34,
-  68, 161, 212, 105, 52, 112, 51, 43, 126, 106, 86, 86, 86, 86, 106, 199,
-  80, 148, 71, 8, 4, 94, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 212, 124, 33, 132, 212, 124, 69, 69, 73, 34, 69, 165, 203, 27,
-  57, 131, 29, 104, 117, 109, 106, 65, 63, 106, 130, 139, 97, 33, 33, 16,
-  83, 212, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 79, 4,
+  126, 107, 107, 112, 131, 152, 153, 1, 4, 26, 212, 146, 121, 79, 153, 212,
+  212, 63, 32, 84, 26, 58, 130, 63, 58, 58, 62, 63, 86, 201, 126, 115,
+  199, 153, 203, 165, 1, 4, 26, 212, 203, 48, 37, 34, 66, 148, 126, 12,
+  105, 52, 52, 107, 86, 62, 62, 62, 58, 58, 126, 131, 153, 94, 34, 124,
+  208, 1, 3, 28, 212, 139, 5, 11, 36, 36, 8, 119, 208, 52, 61, 63,
+  29, 54, 130, 65, 63, 86, 106, 86, 112, 153, 82, 33, 6, 33, 212, 165,
+  1, 2, 29, 165, 212, 96, 16, 68, 98, 143, 93, 161, 203, 86, 43, 58,
+  29, 54, 112, 106, 86, 63, 63, 62, 63, 95, 73, 34, 5, 1, 70, 212,
+  1, 2, 30, 208, 203, 212, 212, 144, 98, 97, 203, 165, 165, 126, 43, 111,
+  52, 58, 104, 106, 62, 63, 86, 86, 86, 111, 80, 69, 33, 4, 1, 135,
+  212, 1, 2, 31, 208, 208, 212, 70, 24, 24, 132, 83, 146, 212, 203, 58,
+  84, 63, 52, 63, 117, 106, 86, 63, 86, 63, 117, 95, 69, 68, 75, 8,
+  8, 129, 212, 1, 1, 32, 208, 165, 146, 212, 68, 4, 9, 75, 34, 68,
+  161, 212, 105, 52, 112, 51, 43, 126, 106, 86, 86, 86, 86, 106, 199, 80,
+  148, 71, 8, 4, 94, 212, 1, 1, 33, 212, 124, 33, 132, 212, 124, 69,
+  69, 73, 34, 69, 165, 203, 27, 57, 131, 29, 104, 117, 109, 106, 65, 63,
+  106, 130, 139, 97, 33, 33, 16, 83, 212, 165, 1, 1, 33, 212, 79, 4,
   83, 212, 144, 44, 44, 42, 125, 97, 125, 212, 61, 2, 12, 104, 43, 117,
-  115, 126, 117, 107, 117, 117, 203, 99, 144, 204, 75, 33, 212, 165, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 212, 92, 80, 75, 212, 161, 125, 165,
-  121, 95, 121, 148, 98, 212, 88, 12, 112, 104, 112, 115, 112, 6, 6, 84,
-  153, 131, 144, 143, 156, 97, 66, 212, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 208, 212, 156, 142, 165, 165, 122, 203, 208, 121, 61, 165, 97,
-  98, 203, 212, 126, 112, 126, 117, 130, 51, 2, 2, 58, 201, 142, 123, 208,
-  124, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 161,
-  161, 208, 208, 146, 76, 92, 92, 84, 42, 94, 148, 69, 82, 208, 212, 165,
-  122, 112, 86, 204, 58, 3, 105, 203, 125, 148, 92, 80, 150, 212, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 178, 36, 132, 212, 144,
-  55, 45, 21, 20, 55, 71, 16, 33, 143, 144, 165, 212, 165, 153, 126, 58,
-  43, 57, 156, 156, 212, 76, 110, 212, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 212, 70, 4, 41, 212, 212, 92, 45, 21, 21, 5,
-  4, 41, 132, 208, 204, 156, 165, 208, 212, 208, 105, 14, 104, 153, 144, 144,
-  76, 44, 148, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  212, 34, 11, 129, 165, 212, 144, 44, 32, 28, 5, 94, 212, 212, 68, 99,
-  156, 204, 208, 208, 208, 212, 153, 208, 156, 112, 46, 44, 89, 161, 212, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 97, 144, 212, 161,
-  212, 132, 8, 34, 84, 129, 203, 204, 124, 68, 8, 16, 34, 82, 212, 165,
-  165, 208, 144, 142, 55, 21, 55, 69, 132, 212, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 208, 212, 212, 156, 156, 194, 212, 69, 8, 33,
-  75, 80, 80, 143, 212, 82, 4, 36, 67, 156, 212, 212, 156, 156, 112, 28,
-  39, 80, 16, 124, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 208, 165, 165, 161, 161, 208, 212, 125, 92, 69, 75, 83, 97, 125, 161,
-  144, 130, 115, 41, 80, 97, 165, 153, 93, 156, 92, 46, 73, 24, 212, 165,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 194, 212,
-  212, 194, 208, 135, 34, 71, 144, 156, 212, 111, 112, 156, 208, 144, 42, 72,
-  72, 80, 165, 75, 69, 212, 92, 36, 34, 212, 165, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 165, 208, 208, 208, 68,
-  68, 69, 41, 41, 41, 39, 84, 123, 208, 55, 20, 44, 56, 61, 144, 66,
-  74, 121, 33, 68, 212, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 135, 135, 208, 212, 148, 136, 212, 135, 124, 144, 98, 91,
-  46, 57, 84, 156, 122, 42, 21, 42, 55, 61, 95, 69, 80, 33, 132, 212,
-  165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 129,
-  99, 165, 212, 141, 34, 82, 67, 68, 68, 75, 83, 74, 39, 45, 92, 212,
-  121, 47, 28, 20, 44, 56, 80, 73, 8, 82, 212, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 124, 75, 212, 194, 203, 136,
-  150, 208, 143, 98, 98, 70, 68, 71, 41, 44, 107, 165, 57, 28, 20, 42,
-  76, 73, 66, 68, 135, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 152, 132, 82, 208, 165, 156, 156, 161, 143, 204, 144,
+  115, 126, 117, 107, 117, 117, 203, 99, 144, 204, 75, 33, 212, 165, 1, 1,
+  32, 212, 92, 80, 75, 212, 161, 125, 165, 121, 95, 121, 148, 98, 212, 88,
+  12, 112, 104, 112, 115, 112, 6, 6, 84, 153, 131, 144, 143, 156, 97, 66,
+  212, 1, 1, 32, 208, 212, 156, 142, 165, 165, 122, 203, 208, 121, 61, 165,
+  97, 98, 203, 212, 126, 112, 126, 117, 130, 51, 2, 2, 58, 201, 142, 123,
+  208, 124, 165, 208, 1, 1, 32, 208, 161, 161, 208, 208, 146, 76, 92, 92,
+  84, 42, 94, 148, 69, 82, 208, 212, 165, 122, 112, 86, 204, 58, 3, 105,
+  203, 125, 148, 92, 80, 150, 212, 1, 1, 31, 208, 208, 178, 36, 132, 212,
+  144, 55, 45, 21, 20, 55, 71, 16, 33, 143, 144, 165, 212, 165, 153, 126,
+  58, 43, 57, 156, 156, 212, 76, 110, 212, 1, 2, 31, 212, 70, 4, 41,
+  212, 212, 92, 45, 21, 21, 5, 4, 41, 132, 208, 204, 156, 165, 208, 212,
+  208, 105, 14, 104, 153, 144, 144, 76, 44, 148, 212, 1, 2, 31, 212, 34,
+  11, 129, 165, 212, 144, 44, 32, 28, 5, 94, 212, 212, 68, 99, 156, 204,
+  208, 208, 208, 212, 153, 208, 156, 112, 46, 44, 89, 161, 212, 1, 2, 31,
+  212, 97, 144, 212, 161, 212, 132, 8, 34, 84, 129, 203, 204, 124, 68, 8,
+  16, 34, 82, 212, 165, 165, 208, 144, 142, 55, 21, 55, 69, 132, 212, 1,
+  2, 31, 208, 212, 212, 156, 156, 194, 212, 69, 8, 33, 75, 80, 80, 143,
+  212, 82, 4, 36, 67, 156, 212, 212, 156, 156, 112, 28, 39, 80, 16, 124,
+  212, 1, 2, 31, 208, 165, 165, 161, 161, 208, 212, 125, 92, 69, 75, 83,
+  97, 125, 161, 144, 130, 115, 41, 80, 97, 165, 153, 93, 156, 92, 46, 73,
+  24, 212, 165, 1, 3, 30, 208, 194, 212, 212, 194, 208, 135, 34, 71, 144,
+  156, 212, 111, 112, 156, 208, 144, 42, 72, 72, 80, 165, 75, 69, 212, 92,
+  36, 34, 212, 165, 1, 4, 29, 208, 208, 165, 208, 208, 208, 68, 68, 69,
+  41, 41, 41, 39, 84, 123, 208, 55, 20, 44, 56, 61, 144, 66, 74, 121,
+  33, 68, 212, 165, 1, 4, 29, 135, 135, 208, 212, 148, 136, 212, 135, 124,
+  144, 98, 91, 46, 57, 84, 156, 122, 42, 21, 42, 55, 61, 95, 69, 80,
+  33, 132, 212, 165, 1, 4, 28, 129, 99, 165, 212, 141, 34, 82, 67, 68,
+  68, 75, 83, 74, 39, 45, 92, 212, 121, 47, 28, 20, 44, 56, 80, 73,
+  8, 82, 212, 1, 4, 28, 124, 75, 212, 194, 203, 136, 150, 208, 143, 98,
+  98, 70, 68, 71, 41, 44, 107, 165, 57, 28, 20, 42, 76, 73, 66, 68,
+  135, 212, 1, 4, 28, 152, 132, 82, 208, 165, 156, 156, 161, 143, 204, 144,
   125, 143, 92, 76, 55, 55, 84, 45, 20, 42, 72, 80, 69, 68, 212, 208,
-  165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  199, 124, 68, 132, 208, 198, 165, 156, 143, 144, 142, 144, 144, 146, 122, 98,
-  98, 111, 54, 21, 54, 76, 80, 41, 69, 212, 165, 208, 208, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 152, 132, 70, 132,
-  208, 194, 212, 165, 161, 161, 161, 161, 161, 156, 156, 97, 46, 56, 39, 39,
-  89, 6, 4, 99, 208, 194, 208, 194, 212, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 122, 99, 132, 150, 194, 208, 208, 165,
-  165, 165, 156, 156, 165, 208, 122, 98, 125, 94, 45, 73, 46, 165, 212, 194,
-  156, 165, 212, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 199, 199, 135, 132, 132, 165, 178, 165, 208, 208, 212, 212, 212,
+  165, 1, 4, 29, 199, 124, 68, 132, 208, 198, 165, 156, 143, 144, 142, 144,
+  144, 146, 122, 98, 98, 111, 54, 21, 54, 76, 80, 41, 69, 212, 165, 208,
+  208, 1, 5, 29, 152, 132, 70, 132, 208, 194, 212, 165, 161, 161, 161, 161,
+  161, 156, 156, 97, 46, 56, 39, 39, 89, 6, 4, 99, 208, 194, 208, 194,
+  212, 1, 6, 28, 122, 99, 132, 150, 194, 208, 208, 165, 165, 165, 156, 156,
+  165, 208, 122, 98, 125, 94, 45, 73, 46, 165, 212, 194, 156, 165, 212, 208,
+  1, 6, 29, 199, 199, 135, 132, 132, 165, 178, 165, 208, 208, 212, 212, 212,
   208, 212, 203, 125, 89, 39, 39, 208, 212, 203, 208, 156, 121, 165, 208, 208,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  153, 153, 152, 152, 152, 178, 165, 208, 208, 208, 165, 208, 194, 208, 92, 47,
-  28, 87, 99, 36, 135, 212, 156, 121, 136, 212, 165, 208, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 208, 208, 208, 161, 161, 165, 212, 135, 89, 56, 111, 48, 34, 75,
-  212, 161, 121, 70, 212, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208,
-  212, 165, 156, 144, 208, 139, 55, 42, 42, 42, 69, 212, 165, 123, 66, 124,
-  212, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 165, 208, 165, 161,
-  122, 46, 39, 37, 20, 37, 124, 208, 123, 41, 68, 212, 165, 208, 208, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 208, 208, 161, 161, 208, 212, 212, 98, 55, 61, 54,
-  20, 94, 212, 156, 80, 34, 124, 212, 165, 208, 208, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 208, 165, 161, 161, 165, 208, 165, 78, 41, 10, 44, 20, 94, 204, 112,
-  36, 68, 212, 165, 208, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 194, 212, 98,
+  1, 8, 28, 153, 153, 152, 152, 152, 178, 165, 208, 208, 208, 165, 208, 194,
+  208, 92, 47, 28, 87, 99, 36, 135, 212, 156, 121, 136, 212, 165, 208, 1,
+  15, 21, 208, 208, 208, 161, 161, 165, 212, 135, 89, 56, 111, 48, 34, 75,
+  212, 161, 121, 70, 212, 165, 208, 1, 16, 21, 208, 208, 212, 165, 156, 144,
+  208, 139, 55, 42, 42, 42, 69, 212, 165, 123, 66, 124, 212, 165, 208, 1,
+  17, 21, 208, 208, 165, 208, 165, 161, 122, 46, 39, 37, 20, 37, 124, 208,
+  123, 41, 68, 212, 165, 208, 208, 1, 17, 22, 208, 208, 161, 161, 208, 212,
+  212, 98, 55, 61, 54, 20, 94, 212, 156, 80, 34, 124, 212, 165, 208, 208,
+  1, 18, 22, 208, 165, 161, 161, 165, 208, 165, 78, 41, 10, 44, 20, 94,
+  204, 112, 36, 68, 212, 165, 208, 208, 208, 1, 18, 22, 208, 194, 212, 98,
   136, 212, 212, 148, 34, 4, 10, 45, 28, 144, 142, 80, 34, 124, 212, 165,
-  208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 208, 97, 146, 194, 212, 70,
-  33, 11, 74, 20, 46, 203, 80, 36, 68, 212, 165, 208, 208, 208, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 208, 208, 194, 212, 136, 122, 212, 212, 146, 75, 212, 75, 41, 20,
-  139, 121, 46, 36, 132, 212, 165, 208, 208, 208, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208,
-  156, 161, 208, 208, 165, 212, 92, 122, 150, 69, 44, 44, 146, 89, 73, 36,
-  124, 212, 165, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 161, 161, 165, 208, 165,
-  212, 96, 39, 208, 132, 69, 45, 79, 92, 76, 41, 68, 212, 208, 194, 208,
-  208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 208, 165, 156, 208, 208, 165, 212, 165, 28, 87, 212,
-  75, 73, 39, 44, 76, 80, 67, 66, 194, 208, 165, 208, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  208, 208, 156, 161, 165, 212, 165, 212, 96, 39, 153, 212, 98, 55, 39, 54,
-  76, 80, 36, 75, 212, 165, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 161, 143, 165,
-  146, 165, 212, 146, 28, 76, 161, 212, 122, 46, 44, 76, 80, 73, 34, 124,
-  212, 165, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 212, 165, 143, 203, 136, 136, 212, 212, 79,
-  39, 57, 84, 71, 73, 76, 45, 76, 80, 41, 70, 212, 165, 208, 208, 208,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 208, 212, 161, 156, 208, 83, 212, 165, 212, 89, 56, 61, 82, 79,
-  76, 45, 28, 55, 80, 41, 83, 212, 165, 208, 165, 208, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 165, 208,
-  161, 208, 82, 82, 212, 212, 125, 111, 122, 129, 165, 89, 56, 39, 21, 57,
-  73, 74, 119, 212, 208, 208, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 165, 161, 161, 69, 150,
-  208, 208, 92, 165, 165, 212, 139, 55, 55, 21, 28, 56, 76, 69, 119, 212,
-  165, 208, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 208, 208, 156, 212, 95, 83, 212, 212, 122, 125, 212,
-  194, 165, 94, 87, 45, 20, 39, 76, 55, 95, 212, 165, 208, 208, 208, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  208, 208, 1, 18, 23, 208, 208, 208, 208, 97, 146, 194, 212, 70, 33, 11,
+  74, 20, 46, 203, 80, 36, 68, 212, 165, 208, 208, 208, 1, 18, 24, 208,
+  208, 194, 212, 136, 122, 212, 212, 146, 75, 212, 75, 41, 20, 139, 121, 46,
+  36, 132, 212, 165, 208, 208, 208, 1, 19, 23, 208, 208, 156, 161, 208, 208,
+  165, 212, 92, 122, 150, 69, 44, 44, 146, 89, 73, 36, 124, 212, 165, 208,
+  208, 1, 19, 24, 208, 208, 161, 161, 165, 208, 165, 212, 96, 39, 208, 132,
+  69, 45, 79, 92, 76, 41, 68, 212, 208, 194, 208, 208, 1, 20, 23, 208,
+  165, 156, 208, 208, 165, 212, 165, 28, 87, 212, 75, 73, 39, 44, 76, 80,
+  67, 66, 194, 208, 165, 208, 1, 20, 24, 208, 208, 156, 161, 165, 212, 165,
+  212, 96, 39, 153, 212, 98, 55, 39, 54, 76, 80, 36, 75, 212, 165, 208,
+  208, 1, 21, 24, 212, 161, 143, 165, 146, 165, 212, 146, 28, 76, 161, 212,
+  122, 46, 44, 76, 80, 73, 34, 124, 212, 165, 208, 208, 1, 21, 25, 212,
+  165, 143, 203, 136, 136, 212, 212, 79, 39, 57, 84, 71, 73, 76, 45, 76,
+  80, 41, 70, 212, 165, 208, 208, 208, 1, 21, 26, 208, 212, 161, 156, 208,
+  83, 212, 165, 212, 89, 56, 61, 82, 79, 76, 45, 28, 55, 80, 41, 83,
+  212, 165, 208, 165, 208, 1, 22, 26, 165, 208, 161, 208, 82, 82, 212, 212,
+  125, 111, 122, 129, 165, 89, 56, 39, 21, 57, 73, 74, 119, 212, 208, 208,
+  165, 208, 1, 22, 27, 208, 208, 165, 161, 161, 69, 150, 208, 208, 92, 165,
+  165, 212, 139, 55, 55, 21, 28, 56, 76, 69, 119, 212, 165, 208, 165, 208,
+  1, 23, 26, 208, 208, 156, 212, 95, 83, 212, 212, 122, 125, 212, 194, 165,
+  94, 87, 45, 20, 39, 76, 55, 95, 212, 165, 208, 208, 208, 2, 23, 27,
   208, 208, 161, 161, 148, 80, 148, 212, 146, 110, 165, 208, 208, 161, 76, 56,
-  39, 20, 45, 42, 55, 165, 212, 165, 208, 165, 208, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 156, 212,
-  98, 79, 212, 212, 144, 123, 212, 165, 208, 110, 56, 55, 20, 28, 45, 54,
-  110, 165, 208, 194, 208, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 165,
-  165, 208, 208, 165, 165, 165, 165, 165, 165, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 208, 208, 161, 161, 212, 92, 75, 135, 156,
-  92, 122, 212, 208, 212, 89, 56, 45, 20, 42, 42, 55, 95, 212, 165, 208,
-  165, 208, 255, 255, 255, 255, 255, 212, 165, 165, 208, 212, 212, 165, 165, 165,
-  165, 165, 165, 165, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 208, 208, 161, 212, 161, 41, 124, 203, 123, 93, 165, 165, 212,
-  139, 89, 56, 45, 45, 39, 44, 76, 125, 212, 165, 208, 165, 208, 255, 255,
-  255, 212, 165, 212, 212, 165, 136, 148, 212, 212, 212, 212, 212, 212, 212, 165,
-  208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208,
-  153, 161, 204, 97, 97, 144, 156, 97, 98, 212, 165, 208, 203, 92, 56, 76,
-  55, 28, 47, 89, 212, 208, 194, 208, 208, 255, 165, 165, 165, 44, 10, 46,
-  40, 1, 1, 11, 21, 21, 21, 21, 11, 79, 212, 165, 208, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 208, 165, 161, 156, 143, 125,
-  165, 156, 123, 80, 136, 208, 208, 165, 161, 76, 110, 156, 57, 28, 44, 98,
-  165, 208, 194, 208, 208, 165, 212, 94, 1, 0, 18, 96, 9, 2, 1, 1,
-  1, 1, 1, 1, 9, 150, 165, 165, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 165, 208, 161, 161, 143, 203, 212, 165, 156, 92, 93,
-  212, 165, 212, 165, 112, 89, 156, 142, 76, 45, 55, 93, 208, 208, 208, 208,
-  165, 212, 49, 1, 9, 146, 48, 19, 38, 40, 38, 17, 17, 17, 17, 9,
-  9, 165, 208, 208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  165, 208, 165, 156, 156, 143, 203, 208, 161, 142, 93, 136, 212, 165, 165, 212,
-  92, 92, 204, 143, 89, 57, 55, 125, 212, 165, 208, 165, 212, 46, 1, 40,
-  212, 146, 150, 165, 165, 165, 208, 212, 119, 79, 96, 9, 96, 212, 165, 208,
-  208, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 161, 161,
-  143, 161, 208, 212, 156, 123, 73, 122, 212, 165, 212, 161, 57, 84, 142, 143,
-  61, 54, 89, 165, 208, 203, 165, 212, 72, 0, 40, 212, 212, 212, 212, 165,
-  212, 124, 79, 40, 40, 38, 19, 40, 165, 208, 165, 208, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 203, 143, 156, 208, 208, 165,
+  39, 20, 45, 42, 55, 165, 212, 165, 208, 165, 208, 17, 1, 208, 2, 24,
+  26, 208, 208, 156, 212, 98, 79, 212, 212, 144, 123, 212, 165, 208, 110, 56,
+  55, 20, 28, 45, 54, 110, 165, 208, 194, 208, 165, 9, 10, 165, 165, 208,
+  208, 165, 165, 165, 165, 165, 165, 2, 24, 27, 208, 208, 161, 161, 212, 92,
+  75, 135, 156, 92, 122, 212, 208, 212, 89, 56, 45, 20, 42, 42, 55, 95,
+  212, 165, 208, 165, 208, 5, 14, 212, 165, 165, 208, 212, 212, 165, 165, 165,
+  165, 165, 165, 165, 208, 2, 25, 27, 208, 208, 161, 212, 161, 41, 124, 203,
+  123, 93, 165, 165, 212, 139, 89, 56, 45, 45, 39, 44, 76, 125, 212, 165,
+  208, 165, 208, 3, 16, 212, 165, 212, 212, 165, 136, 148, 212, 212, 212, 212,
+  212, 212, 212, 165, 208, 2, 25, 27, 208, 208, 153, 161, 204, 97, 97, 144,
+  156, 97, 98, 212, 165, 208, 203, 92, 56, 76, 55, 28, 47, 89, 212, 208,
+  194, 208, 208, 1, 19, 165, 165, 165, 44, 10, 46, 40, 1, 1, 11, 21,
+  21, 21, 21, 11, 79, 212, 165, 208, 1, 25, 47, 212, 208, 165, 161, 156,
+  143, 125, 165, 156, 123, 80, 136, 208, 208, 165, 161, 76, 110, 156, 57, 28,
+  44, 98, 165, 208, 194, 208, 208, 165, 212, 94, 1, 0, 18, 96, 9, 2,
+  1, 1, 1, 1, 1, 1, 9, 150, 165, 165, 1, 26, 47, 165, 208, 161,
+  161, 143, 203, 212, 165, 156, 92, 93, 212, 165, 212, 165, 112, 89, 156, 142,
+  76, 45, 55, 93, 208, 208, 208, 208, 165, 212, 49, 1, 9, 146, 48, 19,
+  38, 40, 38, 17, 17, 17, 17, 9, 9, 165, 208, 208, 1, 26, 49, 165,
+  208, 165, 156, 156, 143, 203, 208, 161, 142, 93, 136, 212, 165, 165, 212, 92,
+  92, 204, 143, 89, 57, 55, 125, 212, 165, 208, 165, 212, 46, 1, 40, 212,
+  146, 150, 165, 165, 165, 208, 212, 119, 79, 96, 9, 96, 212, 165, 208, 208,
+  1, 26, 49, 208, 208, 208, 161, 161, 143, 161, 208, 212, 156, 123, 73, 122,
+  212, 165, 212, 161, 57, 84, 142, 143, 61, 54, 89, 165, 208, 203, 165, 212,
+  72, 0, 40, 212, 212, 212, 212, 165, 212, 124, 79, 40, 40, 38, 19, 40,
+  165, 208, 165, 208, 1, 27, 48, 208, 208, 208, 203, 143, 156, 208, 208, 165,
   156, 121, 82, 208, 165, 165, 212, 146, 92, 142, 156, 112, 84, 45, 92, 212,
   165, 165, 212, 38, 4, 91, 212, 96, 71, 40, 124, 212, 119, 17, 19, 17,
-  19, 19, 48, 124, 212, 165, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 208, 208, 208, 212, 161, 143, 165, 208, 212, 161, 143, 165, 146, 208,
-  208, 165, 203, 212, 143, 144, 203, 144, 110, 121, 165, 208, 212, 212, 9, 9,
-  146, 212, 9, 5, 17, 38, 119, 212, 71, 19, 48, 124, 135, 48, 71, 212,
-  165, 212, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208,
+  19, 19, 48, 124, 212, 165, 165, 1, 27, 48, 208, 208, 208, 212, 161, 143,
+  165, 208, 212, 161, 143, 165, 146, 208, 208, 165, 203, 212, 143, 144, 203, 144,
+  110, 121, 165, 208, 212, 212, 9, 9, 146, 212, 9, 5, 17, 38, 119, 212,
+  71, 19, 48, 124, 135, 48, 71, 212, 165, 212, 1, 27, 48, 208, 208, 208,
   208, 165, 143, 161, 212, 208, 208, 156, 156, 208, 208, 208, 208, 161, 161, 165,
   156, 161, 161, 208, 212, 212, 212, 78, 37, 9, 5, 135, 212, 9, 9, 24,
-  19, 79, 212, 165, 122, 208, 212, 212, 5, 48, 212, 165, 212, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 208, 156, 143, 203,
-  208, 212, 161, 143, 165, 208, 208, 208, 212, 156, 161, 165, 153, 165, 212, 212,
-  165, 10, 1, 5, 5, 17, 165, 96, 9, 9, 19, 19, 48, 208, 208, 212,
-  212, 165, 19, 9, 146, 208, 212, 96, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 208, 208, 208, 212, 161, 143, 161, 208, 208, 208, 161, 143,
-  165, 208, 208, 208, 208, 161, 208, 212, 212, 161, 39, 1, 1, 9, 9, 79,
-  212, 38, 5, 5, 9, 19, 19, 24, 119, 212, 212, 91, 9, 5, 48, 212,
-  165, 212, 17, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208,
-  208, 208, 208, 165, 156, 161, 208, 208, 208, 212, 156, 156, 212, 208, 208, 208,
-  165, 212, 95, 11, 2, 1, 5, 9, 48, 135, 212, 79, 5, 9, 11, 19,
-  48, 122, 165, 150, 208, 165, 71, 9, 19, 165, 208, 212, 19, 9, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208, 212, 156,
-  161, 212, 208, 208, 208, 165, 143, 165, 208, 208, 208, 208, 212, 1, 0, 5,
-  9, 17, 146, 212, 212, 212, 91, 9, 17, 24, 19, 165, 212, 212, 212, 212,
-  212, 212, 150, 208, 208, 212, 96, 5, 19, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 208, 208, 208, 208, 165, 156, 212, 165, 165, 212,
-  208, 153, 165, 208, 208, 208, 165, 212, 11, 9, 11, 5, 35, 165, 146, 124,
-  79, 38, 24, 24, 19, 96, 212, 212, 135, 48, 71, 122, 212, 212, 165, 208,
-  165, 5, 9, 38, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 208, 208, 208, 208, 208, 165, 212, 212, 161, 212, 208, 165, 208, 208,
-  208, 165, 212, 212, 150, 165, 96, 71, 96, 71, 24, 19, 38, 38, 19, 79,
-  212, 212, 135, 24, 19, 19, 17, 17, 94, 212, 212, 165, 71, 40, 19, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 208,
-  208, 165, 212, 119, 21, 1, 39, 212, 212, 165, 208, 165, 212, 135, 48, 165,
-  208, 212, 212, 212, 212, 165, 165, 165, 165, 165, 165, 208, 146, 19, 17, 19,
-  9, 9, 9, 17, 71, 119, 212, 212, 208, 79, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 208, 208, 165, 212, 135, 9, 5,
-  5, 5, 17, 135, 212, 208, 165, 212, 17, 18, 82, 135, 212, 124, 135, 165,
-  165, 165, 165, 165, 208, 165, 212, 122, 71, 96, 38, 9, 17, 38, 38, 17,
-  96, 212, 194, 212, 212,
+  19, 79, 212, 165, 122, 208, 212, 212, 5, 48, 212, 165, 212, 1, 28, 47,
+  208, 208, 208, 208, 156, 143, 203, 208, 212, 161, 143, 165, 208, 208, 208, 212,
+  156, 161, 165, 153, 165, 212, 212, 165, 10, 1, 5, 5, 17, 165, 96, 9,
+  9, 19, 19, 48, 208, 208, 212, 212, 165, 19, 9, 146, 208, 212, 96, 1,
+  28, 47, 208, 208, 208, 212, 161, 143, 161, 208, 208, 208, 161, 143, 165, 208,
+  208, 208, 208, 161, 208, 212, 212, 161, 39, 1, 1, 9, 9, 79, 212, 38,
+  5, 5, 9, 19, 19, 24, 119, 212, 212, 91, 9, 5, 48, 212, 165, 212,
+  17, 1, 28, 47, 208, 208, 208, 208, 165, 156, 161, 208, 208, 208, 212, 156,
+  156, 212, 208, 208, 208, 165, 212, 95, 11, 2, 1, 5, 9, 48, 135, 212,
+  79, 5, 9, 11, 19, 48, 122, 165, 150, 208, 165, 71, 9, 19, 165, 208,
+  212, 19, 9, 1, 29, 46, 208, 208, 208, 212, 156, 161, 212, 208, 208, 208,
+  165, 143, 165, 208, 208, 208, 208, 212, 1, 0, 5, 9, 17, 146, 212, 212,
+  212, 91, 9, 17, 24, 19, 165, 212, 212, 212, 212, 212, 212, 150, 208, 208,
+  212, 96, 5, 19, 1, 29, 46, 208, 208, 208, 208, 165, 156, 212, 165, 165,
+  212, 208, 153, 165, 208, 208, 208, 165, 212, 11, 9, 11, 5, 35, 165, 146,
+  124, 79, 38, 24, 24, 19, 96, 212, 212, 135, 48, 71, 122, 212, 212, 165,
+  208, 165, 5, 9, 38, 1, 30, 45, 208, 208, 208, 208, 208, 165, 212, 212,
+  161, 212, 208, 165, 208, 208, 208, 165, 212, 212, 150, 165, 96, 71, 96, 71,
+  24, 19, 38, 38, 19, 79, 212, 212, 135, 24, 19, 19, 17, 17, 94, 212,
+  212, 165, 71, 40, 19, 1, 30, 45, 208, 208, 208, 208, 165, 212, 119, 21,
+  1, 39, 212, 212, 165, 208, 165, 212, 135, 48, 165, 208, 212, 212, 212, 212,
+  165, 165, 165, 165, 165, 165, 208, 146, 19, 17, 19, 9, 9, 9, 17, 71,
+  119, 212, 212, 208, 79, 1, 31, 44, 208, 208, 165, 212, 135, 9, 5, 5,
+  5, 17, 135, 212, 208, 165, 212, 17, 18, 82, 135, 212, 124, 135, 165, 165,
+  165, 165, 165, 208, 165, 212, 122, 71, 96, 38, 9, 17, 38, 38, 17, 96,
+  212, 194, 212, 212,
 };
 
 #endif
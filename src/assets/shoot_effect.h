@@ -8,656 +8,225 @@
 #define SHOOT_EFFECT_HEIGHT 86
 #define SHOOT_EFFECT_TRANSPARENT_IDX 255
 
-typedef struct { int x, y, w, h; int offset; } shoot_effect_frame_t;
+// spans: offset of the frame in shoot_effect_spans, lines: index of its first row in shoot_effect_lines
+typedef struct { int x, y, w, h; int spans, lines; } shoot_effect_frame_t;
 
 static const shoot_effect_frame_t shoot_effect_frame_info[4] = {
-  { 21, 15, 48, 57, 0 },
-  { 4, 4, 68, 77, 2736 },
-  { 23, 23, 39, 28, 7972 },
-  { 27, 19, 41, 27, 9064 },
+  { 21, 15, 48, 57, 0, 0 },
+  { 4, 4, 68, 77, 846, 57 },
+  { 23, 23, 39, 28, 1788, 134 },
+  { 27, 19, 41, 27, 2542, 162 },
 };
 
 static const uint16_t shoot_effect_palette[256] = {
 65503, 65503, 65503, 65503, 65503, 65503, 65503, 65502, 65503, 65503, 65503, 65503, 65503, 65502, 65502, 65500, 65498, 65500, 65497, 65493, 65489, 65472, 65502, 65501, 65500, 65436, 65435, 63389, 63325, 65434, 65434, 65434, 65369, 65368, 65365, 65304, 65302, 63256, 59165, 61145, 57050, 65302, 65302, 65300, 63125, 61077, 65167, 65113, 65106, 65036, 65032, 64966, 64966, 62921, 62858, 64903, 62854, 64902, 62789, 62790, 58965, 54872, 52825, 50712, 58900, 58896, 54801, 60879, 54736, 60743, 50645, 48466, 64850, 64842, 64841, 62790, 58630, 62789, 62722, 60677, 62665, 58505, 64709, 58565, 58440, 62476, 64512, 54539, 48400, 54406, 50312, 54344, 54279, 50183, 44308, 44301, 40080, 41994, 35856, 31688, 52167, 48071, 46022, 49988, 43845, 41797, 39814, 35724, 39749, 39685, 37638, 35589, 35526, 29581, 27404, 31431, 25291, 27271, 21130, 21120, 29253, 27206, 27205, 23110, 19017, 25092, 23045, 22980, 20932, 18821, 18820, 16904, 14791, 16833, 16772, 14791, 12678, 12675, 18820, 18756, 16772, 14724, 16708, 16643, 12612, 12546, 10565, 10565, 10563, 10500, 8452, 10499, 10499, 8451, 8452, 8452, 8451, 8450, 8451, 8387, 8387, 8387, 8387, 8387, 8387, 8387, 8387, 8387, 8387, 8452, 8387, 6339, 8387, 8387, 8387, 6339, 8387, 8387, 6339, 6339, 6339, 8387, 8387, 6339, 6339, 6339, 6339, 6338, 2438, 6339, 6338, 6339, 6339, 6339, 6339, 6338, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 12418, 8322, 8387, 8387, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6339, 6274, 4291, 4227, 4227, 4226, 4227, 4226, 2179, 2179, 2178, 2113, 2112, 65, 1, 0, 0, 38913, 14336, 2048, 6, 0, 63519
 };
 
-static const uint8_t shoot_effect_pixels[10171] = {
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 58, 255, 0, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 58, 255, 0, 32, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 58, 255, 0, 32, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 58, 255, 0, 33, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 58, 255, 0, 29, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 51, 78, 23, 0, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 78, 7, 0, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 130, 255,
-  255, 255, 255, 255, 255, 255, 78, 43, 0, 7, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 255, 255, 255, 255, 255, 255, 255, 139, 139, 255,
-  255, 255, 255, 255, 255, 59, 78, 43, 0, 26, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 59, 57, 255, 255, 255, 129, 130, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 49, 15, 0, 26, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 58, 53, 63, 255, 255, 128, 130, 130, 142,
-  255, 71, 255, 255, 255, 92, 67, 29, 0, 15, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 46, 29, 94, 145, 142, 129, 145,
-  66, 48, 36, 255, 255, 81, 81, 45, 0, 26, 128, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 105, 58, 34, 62, 123, 145, 115,
-  67, 103, 66, 68, 122, 18, 33, 25, 0, 7, 97, 255, 255, 125, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 122, 101, 34, 28, 88, 79,
-  92, 60, 33, 35, 67, 88, 67, 0, 0, 0, 96, 125, 105, 142, 130, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 93, 76, 102, 43, 0, 37,
-  81, 88, 23, 0, 45, 109, 45, 0, 0, 0, 96, 105, 105, 141, 129, 129,
-  142, 145, 27, 94, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 105, 50, 108, 104, 36, 0,
+// start of each row in shoot_effect_spans, relative to its frame
+static const uint16_t shoot_effect_lines[189] = {
+  0, 4, 8, 12, 19, 23, 31, 40, 49, 56, 65, 74, 81, 87, 97, 112,
+  127, 149, 170, 194, 218, 247, 275, 300, 332, 368, 401, 431, 475, 526, 563, 588,
+  610, 633, 661, 680, 699, 716, 731, 741, 753, 760, 767, 773, 778, 784, 790, 796,
+  801, 806, 812, 817, 821, 826, 832, 836, 841, 0, 5, 10, 15, 20, 25, 30,
+  35, 40, 45, 49, 53, 57, 61, 65, 69, 74, 79, 84, 89, 94, 105, 113,
+  122, 140, 160, 185, 207, 230, 261, 291, 321, 350, 382, 420, 461, 500, 539, 588,
+  632, 667, 700, 723, 747, 765, 790, 812, 834, 851, 863, 867, 868, 872, 877, 878,
+  879, 880, 881, 882, 883, 888, 889, 894, 899, 900, 901, 902, 903, 904, 905, 910,
+  915, 920, 925, 930, 934, 938, 0, 6, 17, 34, 55, 81, 110, 139, 172, 206,
+  242, 282, 323, 359, 392, 423, 453, 487, 521, 553, 578, 605, 630, 652, 674, 696,
+  718, 737, 0, 5, 17, 32, 53, 81, 103, 119, 132, 148, 167, 184, 198, 210,
+  231, 252, 275, 298, 322, 350, 372, 393, 410, 418, 428, 434, 438,
+};
+
+// per row: span count, then { skip, run, run indices } for each span
+static const uint8_t shoot_effect_spans[2984] = {
+  1, 21, 1, 59, 1, 21, 1, 59, 1, 21, 1, 59, 2, 21, 1, 59,
+  2, 1, 0, 1, 24, 1, 0, 2, 21, 2, 59, 58, 1, 1, 0, 2,
+  21, 2, 59, 58, 1, 2, 0, 32, 2, 21, 2, 59, 58, 1, 2, 0,
+  32, 2, 21, 1, 59, 2, 1, 0, 2, 21, 2, 59, 58, 1, 2, 0,
+  33, 2, 21, 2, 59, 58, 1, 2, 0, 29, 1, 21, 4, 51, 78, 23,
+  0, 1, 22, 3, 78, 7, 0, 2, 14, 1, 130, 7, 4, 78, 43, 0,
+  7, 3, 5, 1, 59, 7, 2, 139, 139, 6, 5, 59, 78, 43, 0, 26,
+  3, 6, 2, 59, 57, 3, 2, 129, 130, 9, 4, 49, 15, 0, 26, 4,
+  7, 3, 58, 53, 63, 2, 4, 128, 130, 130, 142, 1, 1, 71, 3, 5,
+  92, 67, 29, 0, 15, 2, 9, 10, 46, 29, 94, 145, 142, 129, 145, 66,
+  48, 36, 2, 6, 81, 81, 45, 0, 26, 128, 2, 9, 18, 105, 58, 34,
+  62, 123, 145, 115, 67, 103, 66, 68, 122, 18, 33, 25, 0, 7, 97, 2,
+  1, 125, 1, 10, 21, 122, 101, 34, 28, 88, 79, 92, 60, 33, 35, 67,
+  88, 67, 0, 0, 0, 96, 125, 105, 142, 130, 1, 10, 26, 93, 76, 102,
+  43, 0, 37, 81, 88, 23, 0, 45, 109, 45, 0, 0, 0, 96, 105, 105,
+  141, 129, 129, 142, 145, 27, 94, 1, 10, 25, 105, 50, 108, 104, 36, 0,
   15, 68, 70, 0, 0, 65, 37, 0, 0, 0, 33, 93, 142, 129, 142, 145,
-  128, 96, 61, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 101, 67, 23,
-  0, 0, 32, 23, 0, 7, 60, 0, 0, 0, 33, 45, 123, 145, 255, 98,
-  0, 32, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 56, 59, 255, 255, 255, 255, 255, 255, 53, 87, 90, 70,
-  15, 7, 0, 7, 0, 0, 60, 60, 0, 7, 26, 7, 88, 98, 27, 0,
-  98, 104, 255, 120, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 59, 57, 59, 51, 93, 106, 94, 70, 38, 15, 37,
-  66, 90, 32, 0, 0, 0, 7, 87, 7, 0, 0, 7, 15, 0, 40, 88,
-  66, 102, 57, 51, 50, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 59, 50, 51, 53, 68, 89, 97, 71, 37,
-  61, 114, 115, 40, 0, 0, 0, 60, 60, 0, 0, 7, 68, 65, 45, 60,
-  7, 53, 58, 89, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 71, 16, 108, 78, 78, 46,
-  34, 0, 40, 40, 0, 0, 0, 0, 25, 0, 0, 7, 67, 25, 7, 0,
-  23, 36, 97, 107, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 94, 15, 26, 26, 26, 0, 40, 63, 7, 23, 63, 40, 26, 0,
+  128, 96, 61, 2, 13, 17, 101, 67, 23, 0, 0, 32, 23, 0, 7, 60,
+  0, 0, 0, 33, 45, 123, 145, 1, 3, 98, 0, 32, 3, 4, 2, 56,
+  59, 6, 22, 53, 87, 90, 70, 15, 7, 0, 7, 0, 0, 60, 60, 0,
+  7, 26, 7, 88, 98, 27, 0, 98, 104, 1, 1, 120, 1, 5, 33, 59,
+  57, 59, 51, 93, 106, 94, 70, 38, 15, 37, 66, 90, 32, 0, 0, 0,
+  7, 87, 7, 0, 0, 7, 15, 0, 40, 88, 66, 102, 57, 51, 50, 111,
+  1, 7, 30, 59, 50, 51, 53, 68, 89, 97, 71, 37, 61, 114, 115, 40,
+  0, 0, 0, 60, 60, 0, 0, 7, 68, 65, 45, 60, 7, 53, 58, 89,
+  111, 1, 9, 27, 251, 71, 16, 108, 78, 78, 46, 34, 0, 40, 40, 0,
+  0, 0, 0, 25, 0, 0, 7, 67, 25, 7, 0, 23, 36, 97, 107, 1,
+  2, 41, 94, 15, 26, 26, 26, 0, 40, 63, 7, 23, 63, 40, 26, 0,
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  23, 29, 26, 15, 16, 15, 26, 26, 15, 33, 33, 255, 255, 255, 255, 255,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 64, 65, 39, 39, 39,
-  39, 39, 45, 60, 66, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 15, 29, 15, 36, 48, 48, 45,
-  45, 45, 39, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-  0, 0, 7, 0, 0, 7, 0, 7, 0, 23, 26, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 99, 96, 60, 70, 29,
-  34, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 36, 26, 15,
-  29, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 143, 206, 108, 69,
-  33, 23, 61, 28, 0, 0, 0, 66, 23, 0, 26, 0, 37, 66, 34, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 93, 55, 81,
-  107, 94, 0, 0, 7, 0, 68, 66, 0, 0, 44, 64, 0, 60, 34, 49,
-  58, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 142, 255, 83, 89, 255, 120, 125,
-  61, 61, 39, 67, 0, 68, 68, 0, 0, 7, 18, 90, 39, 64, 35, 18,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 96,
-  61, 117, 92, 87, 44, 45, 23, 0, 0, 61, 107, 123, 102, 94, 0, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 27, 94,
-  145, 142, 120, 104, 93, 34, 25, 0, 0, 15, 88, 255, 255, 255, 0, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 129, 107, 142,
-  129, 129, 139, 149, 104, 46, 26, 0, 0, 16, 33, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 139, 143, 130,
-  139, 255, 255, 255, 255, 90, 37, 0, 0, 18, 33, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 129, 255,
-  255, 255, 255, 255, 255, 255, 35, 0, 0, 16, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 130, 255, 255, 255,
-  255, 255, 255, 255, 255, 123, 35, 0, 0, 16, 33, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 33, 0, 0, 32, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 33, 0, 0, 33, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 0, 0, 33, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 36, 7, 7, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 7, 7, 36, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 36, 7, 23, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 7, 25, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 23, 15, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 36, 0, 25, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 0, 23, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 29, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 15, 32, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 35, 0, 32, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 15, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 15, 29, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 15, 29, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171,
-  171, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 171, 159, 171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 171, 171, 171, 171, 171, 171, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  0, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171, 171, 171, 171, 255,
-  255, 255, 255, 255, 255, 255, 131, 234, 171, 171, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 171, 171, 234, 171,
-  171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 159, 171, 171, 159, 171, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 149, 171,
-  159, 187, 136, 171, 171, 171, 159, 171, 255, 255, 255, 255, 255, 171, 171, 171,
-  171, 159, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
-  0, 62, 248, 171, 150, 238, 116, 113, 244, 159, 159, 255, 255, 255, 255, 255,
-  255, 171, 171, 171, 171, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 0, 40, 146, 245, 150, 234, 98, 149, 234, 159, 171,
-  255, 255, 255, 255, 171, 171, 171, 171, 171, 171, 171, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 27, 28, 98, 244, 244, 124,
-  113, 238, 153, 159, 171, 141, 120, 110, 159, 171, 171, 171, 171, 171, 171, 171,
-  255, 255, 255, 255, 171, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 94,
-  0, 63, 136, 248, 98, 124, 248, 243, 120, 81, 84, 126, 238, 151, 171, 171,
-  159, 171, 171, 171, 171, 159, 159, 248, 131, 94, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 248, 132, 0, 28, 114, 159, 124, 98, 97, 84, 84, 100, 109,
-  120, 112, 120, 153, 171, 159, 171, 171, 171, 244, 187, 118, 70, 118, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 248, 144, 94, 113, 171, 116, 70, 64,
-  81, 84, 32, 81, 84, 91, 81, 101, 151, 236, 159, 171, 159, 118, 113, 113,
-  171, 244, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 114, 171, 255, 171, 238, 110,
-  127, 113, 98, 39, 67, 104, 98, 81, 79, 81, 110, 142, 120, 141, 171, 244,
-  113, 94, 132, 244, 159, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 171, 171, 153, 255, 255, 255, 171, 244, 187,
-  131, 159, 124, 67, 111, 124, 0, 0, 7, 66, 118, 157, 76, 57, 120, 246,
-  128, 81, 125, 236, 159, 244, 238, 153, 171, 171, 171, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 153, 171, 171, 171, 255,
-  171, 159, 159, 171, 187, 252, 98, 88, 145, 38, 32, 37, 38, 7, 28, 102,
-  84, 87, 115, 247, 120, 74, 111, 241, 159, 159, 159, 171, 171, 171, 171, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171,
-  171, 171, 171, 159, 171, 171, 171, 171, 159, 238, 131, 131, 244, 94, 38, 64,
-  87, 45, 49, 49, 111, 16, 71, 120, 91, 112, 151, 171, 171, 171, 171, 171,
-  171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 171, 159, 171, 171, 171, 159, 171, 171, 171, 171, 171, 171, 238, 244,
-  146, 62, 96, 84, 54, 44, 53, 33, 99, 45, 44, 109, 111, 246, 134, 151,
-  171, 171, 171, 171, 159, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 0, 255, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-  171, 171, 171, 141, 101, 101, 83, 49, 15, 28, 76, 43, 15, 33, 37, 150,
-  238, 128, 159, 171, 159, 171, 159, 171, 171, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 0, 0, 0, 0, 0, 255, 0, 255, 255, 255, 62, 255, 255, 144, 187,
-  171, 171, 171, 171, 171, 171, 171, 137, 121, 61, 110, 74, 53, 46, 68, 45,
-  0, 33, 53, 151, 159, 128, 255, 171, 171, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 171, 171, 171, 159, 159, 171, 171, 171, 159, 236, 171, 87, 141, 137,
-  64, 54, 48, 15, 7, 95, 130, 159, 171, 236, 255, 255, 255, 255, 255, 255,
-  0, 255, 255, 255, 255, 255, 255, 0, 0, 0, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 153, 171, 171, 171, 171, 171, 171, 171, 159,
-  171, 120, 101, 105, 97, 104, 126, 116, 71, 26, 118, 238, 171, 146, 40, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171,
-  159, 171, 159, 171, 159, 246, 112, 101, 145, 151, 171, 248, 132, 62, 153, 171,
-  171, 150, 114, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 171, 171, 171, 171, 171, 171, 159, 171, 141, 151, 236, 171, 153, 238,
-  63, 28, 171, 171, 171, 171, 244, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171, 171,
-  159, 171, 171, 150, 118, 118, 150, 171, 171, 171, 159, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 159, 171, 159, 255,
-  171, 159, 171, 171, 171, 171, 171, 171, 238, 238, 171, 171, 171, 255, 171, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 159,
-  171, 153, 171, 171, 171, 159, 171, 171, 171, 171, 171, 171, 159, 159, 171, 171,
-  171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 171, 159, 171, 244, 171, 150, 171, 171, 171, 159, 171, 171, 171, 171,
-  171, 171, 171, 171, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 153, 245, 94, 62, 63, 255, 255, 255, 255,
-  255, 255, 171, 171, 171, 171, 159, 171, 171, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 98, 0, 255, 255,
-  255, 255, 255, 255, 255, 255, 171, 159, 171, 171, 159, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 0, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 159, 171,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 171, 171, 171, 171, 171, 171, 171, 171, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171, 171, 171, 171,
-  171, 171, 171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 159, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 159, 171, 171, 255, 255,
-  255, 255, 255, 171, 159, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 159, 171, 171, 171, 171, 171, 171, 171, 171,
-  171, 171, 171, 171, 159, 171, 255, 255, 159, 159, 159, 171, 171, 171, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171,
-  159, 159, 151, 151, 171, 159, 171, 171, 171, 171, 171, 171, 171, 255, 171, 159,
-  238, 236, 235, 159, 159, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 171, 171, 235, 134, 109, 112, 93, 243, 236, 171, 171, 171,
-  171, 171, 159, 171, 255, 171, 171, 111, 120, 145, 236, 236, 159, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 159, 241, 112, 81,
-  128, 91, 104, 120, 159, 171, 159, 171, 171, 171, 255, 255, 171, 159, 125, 101,
-  84, 101, 125, 235, 159, 255, 255, 255, 255, 171, 171, 255, 255, 255, 255, 255,
-  255, 255, 171, 171, 171, 145, 110, 89, 76, 69, 84, 101, 159, 171, 171, 171,
-  171, 171, 171, 171, 171, 241, 171, 128, 122, 134, 171, 159, 255, 255, 255, 171,
-  159, 159, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171, 171, 241, 106, 51,
-  57, 55, 104, 236, 159, 171, 171, 159, 159, 171, 171, 171, 159, 171, 236, 241,
-  236, 171, 255, 255, 171, 159, 171, 171, 171, 171, 255, 255, 171, 171, 255, 255,
-  255, 171, 171, 171, 171, 236, 125, 125, 125, 137, 171, 153, 159, 171, 171, 171,
-  171, 159, 171, 255, 171, 159, 159, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-  159, 255, 171, 159, 159, 159, 255, 255, 255, 171, 171, 171, 159, 241, 246, 241,
-  236, 236, 241, 241, 159, 255, 255, 171, 171, 171, 255, 235, 235, 159, 159, 159,
-  159, 171, 171, 171, 171, 159, 171, 171, 171, 159, 171, 171, 171, 171, 255, 255,
-  159, 171, 159, 236, 137, 105, 144, 133, 128, 108, 108, 236, 255, 255, 255, 255,
-  255, 255, 112, 130, 236, 241, 241, 236, 171, 171, 171, 171, 171, 255, 255, 255,
-  159, 171, 171, 171, 171, 255, 171, 171, 159, 236, 151, 93, 81, 89, 58, 89,
-  93, 255, 255, 255, 255, 255, 255, 255, 255, 255, 91, 137, 102, 76, 115, 236,
-  159, 171, 171, 171, 255, 255, 255, 159, 171, 171, 171, 255, 171, 159, 171, 171,
-  159, 101, 81, 91, 59, 89, 137, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 92, 105, 111, 80, 128, 236, 159, 171, 159, 255, 255, 171, 159, 171,
-  171, 171, 255, 171, 171, 171, 171, 151, 84, 92, 101, 93, 56, 57, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 84, 115, 171, 171, 171,
-  171, 171, 255, 255, 255, 159, 171, 171, 171, 171, 171, 171, 171, 159, 236, 110,
-  130, 246, 112, 57, 255, 255, 57, 59, 255, 255, 255, 255, 255, 255, 255, 104,
-  104, 101, 109, 171, 171, 171, 171, 159, 171, 255, 255, 171, 159, 171, 171, 171,
-  171, 171, 171, 171, 171, 171, 151, 151, 112, 81, 55, 55, 100, 108, 51, 51,
-  57, 255, 255, 255, 255, 255, 255, 171, 236, 134, 153, 171, 159, 171, 255, 255,
-  255, 255, 255, 171, 171, 171, 159, 171, 171, 171, 171, 171, 159, 236, 141, 122,
-  125, 128, 128, 134, 108, 51, 57, 51, 255, 255, 255, 255, 255, 255, 171, 151,
-  101, 125, 236, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171,
-  171, 171, 171, 171, 171, 101, 93, 246, 246, 246, 246, 134, 255, 255, 247, 243,
-  255, 255, 255, 255, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 153, 171, 171, 159, 171, 171, 171, 144, 100, 101, 127,
-  126, 141, 149, 137, 108, 91, 102, 93, 159, 255, 171, 159, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 255, 255, 255,
-  171, 171, 159, 236, 153, 112, 101, 104, 109, 112, 102, 80, 101, 92, 80, 122,
-  236, 159, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 171, 171, 171, 171, 159, 171, 236, 236, 236, 171,
-  236, 159, 122, 241, 151, 128, 144, 171, 159, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171,
-  171, 171, 171, 159, 159, 159, 171, 171, 171, 236, 159, 171, 236, 171, 171, 171,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
-  159, 171, 171, 159, 159, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 171, 171, 171, 171, 171,
-  171, 171, 171, 255, 255, 171, 171, 171, 171, 171, 171, 171, 171, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 159, 171, 171, 171, 171, 159, 171, 255, 255, 255, 171, 171, 171,
-  171, 171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171, 159, 171, 171,
-  255, 255, 255, 255, 159, 171, 159, 171, 159, 171, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171, 171, 159, 159,
-  159, 159, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 159, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 159, 171, 171, 171, 171, 171,
-  159, 171, 171, 171, 171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 171,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 171, 171, 171, 171, 171, 171, 171, 255, 171, 171, 171, 171, 171, 159,
-  171, 255, 255, 171, 171, 171, 171, 171, 159, 171, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171,
-  159, 255, 255, 255, 255, 255, 171, 159, 171, 159, 255, 255, 171, 171, 171, 159,
-  171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 171, 153, 171, 255, 255, 255, 255, 171, 171, 171, 171, 159, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 255, 255, 255, 171,
-  255, 255, 255, 255, 171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 255, 255, 171, 159, 171,
-  255, 255, 255, 171, 255, 255, 171, 171, 255, 171, 153, 171, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 171, 171, 255, 255, 159, 159, 171, 171, 159,
-  171, 171, 171, 171, 171, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 171, 171, 171, 171, 171, 171, 171, 159, 171, 171, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 159, 171,
-  171, 171, 171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 171, 171, 171, 159, 171, 171, 171, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 171, 171, 171, 255, 171, 153, 255, 255, 255, 255, 255, 255,
-  255, 171, 159, 171, 255, 159, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 159, 171, 171, 159,
-  171, 171, 171, 171, 171, 171, 255, 255, 255, 255, 171, 171, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 159, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 171, 159, 171, 171, 171, 171, 171, 171, 171, 171, 159, 159, 171,
-  171, 255, 255, 255, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  171, 159, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 159, 171, 171,
-  171, 171, 171, 171, 171, 171, 171, 171, 171, 153, 171, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 159, 171, 171, 171, 255,
-  255, 255, 255, 255, 255, 255, 171, 171, 171, 159, 171, 171, 171, 171, 159, 159,
-  171, 171, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 171, 171, 171, 159, 159, 159, 171, 171, 159, 171, 171, 159, 171,
-  171, 171, 159, 255, 171, 159, 159, 171, 171, 171, 171, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171,
-  171, 171, 159, 171, 171, 159, 150, 255, 171, 159, 171, 171, 171, 153, 171, 171,
-  153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 171, 171, 171, 171, 255, 255,
-  171, 171, 171, 171, 159, 159, 159, 255, 171, 153, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 171, 171, 159, 171, 255, 255, 171, 171, 159, 171, 171, 171, 171, 171,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 171, 171, 171, 171, 171, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 159, 255, 255, 171, 171, 171,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 171, 159, 171, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 171, 255, 255, 255, 255, 255,
-  255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+  23, 29, 26, 15, 16, 15, 26, 26, 15, 33, 33, 1, 0, 48, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 60, 64, 65, 39, 39, 39, 39, 39,
+  45, 60, 66, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 1, 9,
+  34, 15, 29, 15, 36, 48, 48, 45, 45, 45, 39, 28, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 7, 0, 7,
+  0, 23, 26, 1, 11, 22, 99, 96, 60, 70, 29, 34, 36, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 33, 36, 26, 15, 29, 1, 12, 19, 143,
+  206, 108, 69, 33, 23, 61, 28, 0, 0, 0, 66, 23, 0, 26, 0, 37,
+  66, 34, 1, 13, 20, 93, 55, 81, 107, 94, 0, 0, 7, 0, 68, 66,
+  0, 0, 44, 64, 0, 60, 34, 49, 58, 3, 9, 1, 142, 1, 2, 83,
+  89, 1, 18, 120, 125, 61, 61, 39, 67, 0, 68, 68, 0, 0, 7, 18,
+  90, 39, 64, 35, 18, 1, 15, 16, 96, 61, 117, 92, 87, 44, 45, 23,
+  0, 0, 61, 107, 123, 102, 94, 0, 2, 14, 13, 27, 94, 145, 142, 120,
+  104, 93, 34, 25, 0, 0, 15, 88, 3, 1, 0, 1, 13, 14, 129, 107,
+  142, 129, 129, 139, 149, 104, 46, 26, 0, 0, 16, 33, 2, 13, 4, 139,
+  143, 130, 139, 4, 6, 90, 37, 0, 0, 18, 33, 2, 14, 1, 129, 7,
+  4, 35, 0, 0, 16, 2, 12, 1, 130, 8, 6, 123, 35, 0, 0, 16,
+  33, 1, 22, 4, 33, 0, 0, 32, 1, 22, 4, 33, 0, 0, 33, 1,
+  23, 3, 0, 0, 33, 1, 23, 2, 0, 0, 1, 22, 3, 36, 7, 7,
+  1, 23, 3, 7, 7, 36, 1, 22, 3, 36, 7, 23, 1, 23, 2, 7,
+  25, 1, 23, 2, 23, 15, 1, 22, 3, 36, 0, 25, 1, 23, 2, 0,
+  23, 1, 24, 1, 29, 1, 23, 2, 15, 32, 1, 22, 3, 35, 0, 32,
+  1, 23, 1, 15, 1, 23, 2, 15, 29, 1, 23, 2, 15, 29, 1, 42,
+  2, 0, 0, 1, 42, 2, 0, 0, 1, 42, 2, 0, 0, 1, 42, 2,
+  0, 0, 1, 42, 2, 0, 0, 1, 42, 2, 0, 0, 1, 42, 2, 0,
+  0, 1, 42, 2, 0, 0, 1, 42, 2, 0, 0, 1, 42, 1, 0, 1,
+  42, 1, 0, 1, 42, 1, 0, 1, 42, 1, 0, 1, 42, 1, 0, 1,
+  42, 1, 0, 1, 41, 2, 0, 0, 1, 41, 2, 0, 0, 1, 41, 2,
+  0, 0, 1, 41, 2, 0, 0, 1, 41, 2, 0, 0, 2, 29, 4, 171,
+  171, 171, 171, 8, 2, 0, 0, 1, 29, 5, 171, 159, 171, 171, 171, 1,
+  29, 6, 171, 171, 171, 171, 171, 171, 3, 20, 1, 0, 8, 6, 171, 171,
+  171, 171, 171, 171, 7, 4, 131, 234, 171, 171, 3, 21, 1, 0, 6, 7,
+  171, 171, 234, 171, 171, 171, 171, 7, 5, 159, 171, 171, 159, 171, 3, 22,
+  2, 0, 0, 2, 10, 149, 171, 159, 187, 136, 171, 171, 171, 159, 171, 5,
+  6, 171, 171, 171, 171, 159, 171, 2, 23, 12, 0, 0, 62, 248, 171, 150,
+  238, 116, 113, 244, 159, 159, 6, 5, 171, 171, 171, 171, 159, 2, 25, 11,
+  0, 40, 146, 245, 150, 234, 98, 149, 234, 159, 171, 4, 7, 171, 171, 171,
+  171, 171, 171, 171, 3, 26, 22, 27, 28, 98, 244, 244, 124, 113, 238, 153,
+  159, 171, 141, 120, 110, 159, 171, 171, 171, 171, 171, 171, 171, 4, 1, 171,
+  2, 1, 0, 1, 27, 27, 94, 0, 63, 136, 248, 98, 124, 248, 243, 120,
+  81, 84, 126, 238, 151, 171, 171, 159, 171, 171, 171, 171, 159, 159, 248, 131,
+  94, 1, 27, 27, 248, 132, 0, 28, 114, 159, 124, 98, 97, 84, 84, 100,
+  109, 120, 112, 120, 153, 171, 159, 171, 171, 171, 244, 187, 118, 70, 118, 1,
+  28, 26, 248, 144, 94, 113, 171, 116, 70, 64, 81, 84, 32, 81, 84, 91,
+  81, 101, 151, 236, 159, 171, 159, 118, 113, 113, 171, 244, 2, 26, 2, 114,
+  171, 1, 25, 171, 238, 110, 127, 113, 98, 39, 67, 104, 98, 81, 79, 81,
+  110, 142, 120, 141, 171, 244, 113, 94, 132, 244, 159, 159, 2, 19, 3, 171,
+  171, 153, 3, 30, 171, 244, 187, 131, 159, 124, 67, 111, 124, 0, 0, 7,
+  66, 118, 157, 76, 57, 120, 246, 128, 81, 125, 236, 159, 244, 238, 153, 171,
+  171, 171, 2, 18, 5, 171, 153, 171, 171, 171, 1, 31, 171, 159, 159, 171,
+  187, 252, 98, 88, 145, 38, 32, 37, 38, 7, 28, 102, 84, 87, 115, 247,
+  120, 74, 111, 241, 159, 159, 159, 171, 171, 171, 171, 1, 19, 36, 171, 171,
+  171, 171, 159, 171, 171, 171, 171, 159, 238, 131, 131, 244, 94, 38, 64, 87,
+  45, 49, 49, 111, 16, 71, 120, 91, 112, 151, 171, 171, 171, 171, 171, 171,
+  171, 171, 1, 18, 36, 171, 159, 171, 171, 171, 159, 171, 171, 171, 171, 171,
+  171, 238, 244, 146, 62, 96, 84, 54, 44, 53, 33, 99, 45, 44, 109, 111,
+  246, 134, 151, 171, 171, 171, 171, 159, 171, 3, 0, 1, 0, 1, 6, 0,
+  0, 0, 0, 0, 0, 10, 35, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 141, 101, 101, 83, 49, 15, 28, 76, 43, 15, 33, 37,
+  150, 238, 128, 159, 171, 159, 171, 159, 171, 171, 5, 9, 5, 0, 0, 0,
+  0, 0, 1, 1, 0, 3, 1, 62, 2, 24, 144, 187, 171, 171, 171, 171,
+  171, 171, 171, 137, 121, 61, 110, 74, 53, 46, 68, 45, 0, 33, 53, 151,
+  159, 128, 1, 2, 171, 171, 3, 22, 24, 171, 171, 171, 159, 159, 171, 171,
+  171, 159, 236, 171, 87, 141, 137, 64, 54, 48, 15, 7, 95, 130, 159, 171,
+  236, 6, 1, 0, 6, 3, 0, 0, 0, 2, 23, 24, 153, 171, 171, 171,
+  171, 171, 171, 171, 159, 171, 120, 101, 105, 97, 104, 126, 116, 71, 26, 118,
+  238, 171, 146, 40, 17, 4, 0, 0, 0, 0, 1, 27, 20, 171, 159, 171,
+  159, 171, 159, 246, 112, 101, 145, 151, 171, 248, 132, 62, 153, 171, 171, 150,
+  114, 1, 26, 21, 171, 171, 171, 171, 171, 171, 159, 171, 141, 151, 236, 171,
+  153, 238, 63, 28, 171, 171, 171, 171, 244, 1, 32, 15, 171, 171, 171, 171,
+  159, 171, 171, 150, 118, 118, 150, 171, 171, 171, 159, 3, 27, 4, 171, 159,
+  171, 159, 1, 13, 171, 159, 171, 171, 171, 171, 171, 171, 238, 238, 171, 171,
+  171, 1, 1, 171, 1, 26, 19, 171, 159, 171, 153, 171, 171, 171, 159, 171,
+  171, 171, 171, 171, 171, 159, 159, 171, 171, 171, 1, 26, 19, 171, 159, 171,
+  244, 171, 150, 171, 171, 171, 159, 171, 171, 171, 171, 171, 171, 171, 171, 159,
+  2, 27, 5, 153, 245, 94, 62, 63, 6, 7, 171, 171, 171, 171, 159, 171,
+  171, 2, 28, 2, 98, 0, 8, 5, 171, 159, 171, 171, 159, 1, 27, 1,
+  0, 0, 1, 25, 1, 0, 1, 24, 2, 0, 0, 0, 0, 0, 0, 0,
+  0, 1, 40, 2, 0, 0, 0, 1, 40, 2, 0, 0, 1, 40, 2, 0,
+  0, 0, 0, 0, 0, 0, 0, 1, 40, 2, 0, 0, 1, 40, 2, 0,
+  0, 1, 40, 2, 0, 0, 1, 40, 2, 0, 0, 1, 40, 2, 0, 0,
+  1, 40, 1, 0, 1, 40, 1, 0, 1, 40, 1, 0, 1, 9, 3, 171,
+  159, 171, 1, 9, 8, 171, 171, 171, 171, 171, 171, 171, 171, 2, 8, 11,
+  171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 8, 1, 159, 2, 8,
+  13, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 159, 171, 171, 5, 3,
+  171, 159, 159, 2, 7, 15, 159, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 171, 171, 159, 171, 2, 6, 159, 159, 159, 171, 171, 171, 2, 6, 16,
+  171, 171, 171, 159, 159, 151, 151, 171, 159, 171, 171, 171, 171, 171, 171, 171,
+  1, 8, 171, 159, 238, 236, 235, 159, 159, 171, 2, 6, 16, 171, 171, 235,
+  134, 109, 112, 93, 243, 236, 171, 171, 171, 171, 171, 159, 171, 1, 8, 171,
+  171, 111, 120, 145, 236, 236, 159, 3, 6, 15, 171, 159, 241, 112, 81, 128,
+  91, 104, 120, 159, 171, 159, 171, 171, 171, 2, 9, 171, 159, 125, 101, 84,
+  101, 125, 235, 159, 4, 2, 171, 171, 2, 6, 26, 171, 171, 171, 145, 110,
+  89, 76, 69, 84, 101, 159, 171, 171, 171, 171, 171, 171, 171, 171, 241, 171,
+  128, 122, 134, 171, 159, 3, 3, 171, 159, 159, 2, 6, 25, 171, 171, 171,
+  171, 241, 106, 51, 57, 55, 104, 236, 159, 171, 171, 159, 159, 171, 171, 171,
+  159, 171, 236, 241, 236, 171, 2, 6, 171, 159, 171, 171, 171, 171, 3, 2,
+  2, 171, 171, 3, 18, 171, 171, 171, 171, 236, 125, 125, 125, 137, 171, 153,
+  159, 171, 171, 171, 171, 159, 171, 1, 13, 171, 159, 159, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 159, 4, 1, 4, 171, 159, 159, 159, 3, 12, 171,
+  171, 171, 159, 241, 246, 241, 236, 236, 241, 241, 159, 2, 3, 171, 171, 171,
+  1, 13, 235, 235, 159, 159, 159, 159, 171, 171, 171, 171, 159, 171, 171, 3,
+  0, 6, 171, 159, 171, 171, 171, 171, 2, 12, 159, 171, 159, 236, 137, 105,
+  144, 133, 128, 108, 108, 236, 6, 11, 112, 130, 236, 241, 241, 236, 171, 171,
+  171, 171, 171, 3, 1, 5, 159, 171, 171, 171, 171, 1, 11, 171, 171, 159,
+  236, 151, 93, 81, 89, 58, 89, 93, 9, 10, 91, 137, 102, 76, 115, 236,
+  159, 171, 171, 171, 3, 1, 4, 159, 171, 171, 171, 1, 11, 171, 159, 171,
+  171, 159, 101, 81, 91, 59, 89, 137, 11, 9, 92, 105, 111, 80, 128, 236,
+  159, 171, 159, 3, 0, 5, 171, 159, 171, 171, 171, 1, 11, 171, 171, 171,
+  171, 151, 84, 92, 101, 93, 56, 57, 13, 7, 84, 115, 171, 171, 171, 171,
+  171, 3, 1, 15, 159, 171, 171, 171, 171, 171, 171, 171, 159, 236, 110, 130,
+  246, 112, 57, 2, 2, 57, 59, 7, 10, 104, 104, 101, 109, 171, 171, 171,
+  171, 159, 171, 2, 0, 22, 171, 159, 171, 171, 171, 171, 171, 171, 171, 171,
+  171, 151, 151, 112, 81, 55, 55, 100, 108, 51, 51, 57, 6, 7, 171, 236,
+  134, 153, 171, 159, 171, 2, 1, 21, 171, 171, 171, 159, 171, 171, 171, 171,
+  171, 159, 236, 141, 122, 125, 128, 128, 134, 108, 51, 57, 51, 6, 6, 171,
+  151, 101, 125, 236, 159, 3, 4, 15, 171, 171, 171, 171, 171, 171, 171, 171,
+  101, 93, 246, 246, 246, 246, 134, 2, 2, 247, 243, 4, 1, 171, 2, 5,
+  20, 153, 171, 171, 159, 171, 171, 171, 144, 100, 101, 127, 126, 141, 149, 137,
+  108, 91, 102, 93, 159, 1, 2, 171, 159, 2, 5, 1, 171, 3, 19, 171,
+  171, 159, 236, 153, 112, 101, 104, 109, 112, 102, 80, 101, 92, 80, 122, 236,
+  159, 171, 1, 8, 19, 171, 171, 171, 171, 159, 171, 236, 236, 236, 171, 236,
+  159, 122, 241, 151, 128, 144, 171, 159, 1, 8, 19, 171, 171, 171, 171, 171,
+  171, 159, 159, 159, 171, 171, 171, 236, 159, 171, 236, 171, 171, 171, 1, 7,
+  19, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 159, 171,
+  171, 159, 159, 171, 2, 7, 9, 159, 171, 171, 171, 171, 171, 171, 171, 171,
+  2, 8, 171, 171, 171, 171, 171, 171, 171, 171, 2, 9, 7, 159, 171, 171,
+  171, 171, 159, 171, 3, 7, 171, 171, 171, 171, 171, 171, 171, 2, 9, 6,
+  171, 171, 171, 159, 171, 171, 4, 6, 159, 171, 159, 171, 159, 171, 1, 14,
+  2, 171, 171, 1, 9, 9, 171, 171, 171, 171, 159, 159, 159, 159, 171, 1,
+  7, 12, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 159, 2, 5,
+  15, 171, 171, 159, 171, 171, 171, 171, 171, 159, 171, 171, 171, 171, 171, 171,
+  8, 1, 171, 3, 6, 7, 171, 171, 171, 171, 171, 171, 171, 1, 7, 171,
+  171, 171, 171, 171, 159, 171, 2, 7, 171, 171, 171, 171, 171, 159, 171, 3,
+  8, 4, 171, 171, 171, 159, 5, 4, 171, 159, 171, 159, 2, 7, 171, 171,
+  171, 159, 171, 171, 171, 3, 6, 1, 171, 12, 3, 171, 153, 171, 4, 5,
+  171, 171, 171, 171, 159, 3, 19, 2, 171, 171, 3, 1, 171, 4, 3, 171,
+  171, 171, 4, 26, 1, 171, 2, 3, 171, 159, 171, 3, 1, 171, 2, 2,
+  171, 171, 3, 0, 3, 171, 153, 171, 27, 2, 171, 171, 2, 7, 159, 159,
+  171, 171, 159, 171, 171, 2, 0, 4, 171, 171, 171, 159, 29, 8, 171, 171,
+  171, 171, 171, 171, 171, 159, 2, 0, 2, 171, 171, 32, 7, 171, 159, 171,
+  171, 171, 171, 171, 2, 0, 1, 171, 34, 6, 171, 171, 171, 159, 171, 171,
+  5, 0, 1, 171, 22, 3, 171, 171, 171, 1, 2, 171, 153, 7, 3, 171,
+  159, 171, 1, 1, 159, 3, 0, 1, 171, 20, 11, 171, 159, 171, 171, 159,
+  171, 171, 171, 171, 171, 171, 4, 2, 171, 171, 3, 8, 1, 159, 11, 14,
+  171, 159, 171, 171, 171, 171, 171, 171, 171, 171, 159, 159, 171, 171, 3, 1,
+  171, 2, 8, 4, 171, 159, 171, 171, 9, 14, 159, 171, 171, 171, 171, 171,
+  171, 171, 171, 171, 171, 171, 153, 171, 2, 8, 6, 171, 171, 159, 171, 171,
+  171, 7, 13, 171, 171, 171, 159, 171, 171, 171, 171, 159, 159, 171, 171, 159,
+  2, 9, 16, 171, 171, 171, 159, 159, 159, 171, 171, 159, 171, 171, 159, 171,
+  171, 171, 159, 1, 7, 171, 159, 159, 171, 171, 171, 171, 2, 12, 8, 171,
+  171, 171, 159, 171, 171, 159, 150, 1, 9, 171, 159, 171, 171, 171, 153, 171,
+  171, 153, 3, 13, 5, 171, 171, 171, 171, 171, 2, 7, 171, 171, 171, 171,
+  159, 159, 159, 1, 2, 171, 153, 2, 13, 4, 171, 171, 159, 171, 2, 8,
+  171, 171, 159, 171, 171, 171, 171, 171, 1, 19, 5, 171, 171, 171, 171, 171,
+  2, 18, 2, 171, 159, 2, 3, 171, 171, 171, 1, 21, 3, 171, 159, 171,
+  1, 22, 1, 171, 1, 24, 1, 171,
 };
 
 #endif
@@ -0,0 +1,15 @@
+#include "camera.h"
+
+void camera_update(Camera *cam, float posX, float posY, float dirX, float dirY, float planeX, float planeY) {
+    cam->posX = posX; cam->posY = posY;
+    cam->dirX = dirX; cam->dirY = dirY;
+    cam->planeX = planeX; cam->planeY = planeY;
+    float invDet = 1.0f / (planeX * dirY - dirX * planeY);
+    cam->invDet = invDet;
+
+    // tx - ty and -tx - ty written out from camera_transform()
+    cam->rightX = invDet * (dirY + planeY);
+    cam->rightY = invDet * (-dirX - planeX);
+    cam->leftX = invDet * (planeY - dirY);
+    cam->leftY = invDet * (dirX - planeX);
+}
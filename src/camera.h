@@ -0,0 +1,36 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include <stdbool.h>
+
+// player view as seen by billboards (enemies, the exit sphere, the bullet,
+// particles). filled by camera_update() once per rendered frame
+typedef struct {
+    float posX, posY;
+    float dirX, dirY, planeX, planeY;
+    float invDet; // 1 / (planeX * dirY - dirX * planeY)
+    // view cone edges as half-planes, already scaled by invDet: dot with a
+    // point relative to pos gives tx - ty (right) and -tx - ty (left)
+    float rightX, rightY, leftX, leftY;
+} Camera;
+
+void camera_update(Camera *cam, float posX, float posY, float dirX, float dirY, float planeX, float planeY);
+
+// two dot products, no division. false if a billboard at (x, y) can't reach
+// the screen: behind the camera or past a side edge. halfWidth is its half
+// width over its depth in screen halves, height / width of the target for a
+// square billboard as tall as the wall it stands by, 0 for a point
+static inline bool camera_in_view(const Camera *cam, float x, float y, float halfWidth) {
+    float rx = x - cam->posX, ry = y - cam->posY;
+    return cam->rightX * rx + cam->rightY * ry <= halfWidth
+        && cam->leftX * rx + cam->leftY * ry <= halfWidth;
+}
+
+// camera space: tx across the view, ty depth (screen x is width / 2 * (1 + tx / ty))
+static inline void camera_transform(const Camera *cam, float x, float y, float *tx, float *ty) {
+    float rx = x - cam->posX, ry = y - cam->posY;
+    *tx = cam->invDet * (cam->dirY * rx - cam->dirX * ry);
+    *ty = cam->invDet * (-cam->planeY * rx + cam->planeX * ry);
+}
+
+#endif
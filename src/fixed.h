@@ -0,0 +1,19 @@
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <stdint.h>
+
+// 16.16 fixed point, the CG50 build has no FPU (-m4-nofpu) so floats are soft calls
+typedef int32_t fix_t;
+
+#define FIX_SHIFT 16
+#define FIX_ONE (1 << FIX_SHIFT)
+#define FIX_FRAC_MASK (FIX_ONE - 1)
+
+static inline fix_t fix_from_float(float f) { return (fix_t)(f * FIX_ONE); }
+static inline fix_t fix_from_int(int i) { return (fix_t)(i << FIX_SHIFT); }
+static inline int fix_to_int(fix_t f) { return f >> FIX_SHIFT; }
+static inline fix_t fix_mul(fix_t a, fix_t b) { return (fix_t)(((int64_t)a * b) >> FIX_SHIFT); }
+static inline fix_t fix_div(fix_t a, fix_t b) { return (fix_t)(((int64_t)a << FIX_SHIFT) / b); }
+
+#endif
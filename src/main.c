@@ -1,14 +1,24 @@
 #include <gint/display.h>
 #include <gint/keyboard.h>
 #include <gint/rtc.h>
+#include <gint/timer.h>
+#include <gint/clock.h>
 #include <math.h>
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include "map.h"
+#include "pvs.h"
+#include "camera.h"
+#include "screen.h"
+#include "fixed.h"
+#include "raycast.h"
+#include "wall.h"
+#include "sprite.h"
+#include "perf.h"
 #include "assets/enemy_melee_walk.h"
 #include "assets/enemy_melee_attack.h"
-#include "assets/wall_texture.h"
 #include "assets/shoot_effect.h"
 #include "assets/gun_idle.h"
 #include "assets/gun_shoot.h"
@@ -19,9 +29,6 @@
 #include "screens/deathscreen.h"
 #include "screens/winscreen.h"
 
-#define SCREEN_WIDTH 396
-#define SCREEN_HEIGHT 224
-#define H_RES 4 // render each 4th pixel horizontally for faster rendering
 #define NUM_LEVELS 7
 #define MAX_ENEMIES 10
 
@@ -34,7 +41,8 @@ float playerHP = 125.0f;
 float maxHP = 125.0f;
 float hpDecay = 0.25f; // per frame
 
-float zBuffer[SCREEN_WIDTH];
+fix_t zBuffer[SCREEN_WIDTH]; // perpendicular wall distance per column
+Camera camera; // billboard view of the frame being rendered
 float sphereX = MAP_WIDTH - 2.5f;
 float sphereY = MAP_HEIGHT - 2.5f;
 int currentLevel = 1;
@@ -51,109 +59,168 @@ typedef struct { float x, y; bool alive; float speed; int mode; bool attacking;
 Enemy enemies[MAX_ENEMIES];
 int actualEnemyCount = 0;
 
-void render() {
-    uint16_t *vram = gint_vram;
-    int horiz = (int)pitch;
-
-    // fast clear: background
-    dclear(C_RGB(4, 4, 4));
-    int ceilingEnd = (SCREEN_HEIGHT / 2) + horiz;
-    if (ceilingEnd > 0) {
-        int cLimit = ceilingEnd > SCREEN_HEIGHT ? SCREEN_HEIGHT : ceilingEnd;
-        drect(0, 0, SCREEN_WIDTH - 1, cLimit - 1, C_RGB(2, 2, 2));
+// doors_update() keeps a door open while this is true for its cell
+static bool enemy_in_cell(int x, int y) {
+    for (int i = 0; i < actualEnemyCount; i++) {
+        if (enemies[i].alive && (int)enemies[i].x == x && (int)enemies[i].y == y) return true;
     }
+    return false;
+}
 
-    // wall rendering (optimized)
-    for(int x = 0; x < SCREEN_WIDTH; x += H_RES) {
-        float cameraX = 2.0f * x / (float)SCREEN_WIDTH - 1.0f; 
-        float rayDirX = dirX + planeX * cameraX;
-        float rayDirY = dirY + planeY * cameraX;
-
-        int mapX = (int)posX;
-        int mapY = (int)posY;
-
-        float deltaDistX = (rayDirX == 0) ? 1e30f : fabsf(1.0f / rayDirX);
-        float deltaDistY = (rayDirY == 0) ? 1e30f : fabsf(1.0f / rayDirY);
-
-        float sideDistX, sideDistY;
-        int stepX, stepY;
-        int hit = 0, side;
-
-        if (rayDirX < 0) {
-            stepX = -1;
-            sideDistX = (posX - mapX) * deltaDistX;
-        } else {
-            stepX = 1;
-            sideDistX = (mapX + 1.0f - posX) * deltaDistX;
-        }
-        if (rayDirY < 0) {
-            stepY = -1;
-            sideDistY = (posY - mapY) * deltaDistY;
-        } else {
-            stepY = 1;
-            sideDistY = (mapY + 1.0f - posY) * deltaDistY;
-        }
+// dynamic resolution: wall columns get wider when frames run over budget
+#define TARGET_FPS 20
+#define RES_WINDOW 8 // frames per measurement
+static int colWidth = H_RES;
+
+// a frame is timed from the end of one frame_wait() to the start of the next,
+// so the sleep isn't counted. only frames that drew the world count: idle ones
+// cost almost nothing and would pull the width down for the next frames that
+// do real work
+static bool drewWorld = false;
+
+static void update_column_width(int start) {
+    static int frames = 0, elapsed = 0;
+    if (drewWorld) {
+        elapsed += rtc_ticks() - start;
+        frames++;
+    }
+    if (frames < RES_WINDOW) return;
 
-        int iter = 0;
-        while (hit == 0 && iter < 64) {
-            if (sideDistX < sideDistY) {
-                sideDistX += deltaDistX;
-                mapX += stepX;
-                side = 0;
-            } else {
-                sideDistY += deltaDistY;
-                mapY += stepY;
-                side = 1;
-            }
-            if (worldMap[mapX][mapY] == 1) hit = 1;
-            iter++;
-        }
+    // rtc ticks are 1/128 s, a window is too short to measure single frames
+    int budget = RES_WINDOW * 128 / TARGET_FPS;
+    if (elapsed > budget + budget / 8 && colWidth < H_RES) colWidth *= 2;
+    else if (elapsed < budget / 2 && colWidth > 1) colWidth /= 2;
 
-        float perpWallDist = (side == 0) ? (sideDistX - deltaDistX) : (sideDistY - deltaDistY);
-        if (perpWallDist < 0.1f) perpWallDist = 0.1f;
-        
-        for(int i=0; i<H_RES; i++) zBuffer[x+i] = perpWallDist;
+    frames = 0;
+    elapsed = 0;
+}
 
-        int lineHeight = (int)(SCREEN_HEIGHT / perpWallDist);
-        int drawStart = -lineHeight / 2 + SCREEN_HEIGHT / 2 + horiz;
-        int drawEnd = lineHeight / 2 + SCREEN_HEIGHT / 2 + horiz;
+// game state advances once per loop, so every frame has to last the same time
+// or standing still (idle frames) would speed the game up. a timer ticks at
+// TARGET_FPS and the cpu sleeps until it fires; frames that run over start
+// the next one right away
+static volatile int frameTick = 0;
+static int frameTimer = -1;
 
-        float wallX = (side == 0) ? (posY + perpWallDist * rayDirY) : (posX + perpWallDist * rayDirX);
-        wallX -= (float)((int)wallX);
+static void frame_pacing_start(void) {
+    frameTimer = timer_configure(TIMER_ANY, 1000000 / TARGET_FPS, GINT_CALL_SET(&frameTick));
+    if (frameTimer >= 0) timer_start(frameTimer);
+}
 
-        int texX = (int)(wallX * (float)TEX_WIDTH);
-        if((side == 0 && rayDirX > 0) || (side == 1 && rayDirY < 0)) texX = TEX_WIDTH - texX - 1;
+static void frame_wait(void) {
+    static int frameStart = -1;
+    if (frameStart >= 0) update_column_width(frameStart);
+    if (frameTimer >= 0) {
+        while (!frameTick) sleep();
+        frameTick = 0;
+    }
+    frameStart = rtc_ticks();
+}
 
-        float step_tex = (float)TEX_HEIGHT / lineHeight;
-        float texPos = (drawStart - horiz - SCREEN_HEIGHT / 2 + lineHeight / 2) * step_tex;
+// performance mode: the 3d view is drawn at half resolution and doubled
+#define HALF_WIDTH (SCREEN_WIDTH / 2)
+#define HALF_HEIGHT (SCREEN_HEIGHT / 2)
+static uint16_t halfBuffer[HALF_WIDTH * HALF_HEIGHT] __attribute__((aligned(4)));
+bool perfMode = false;
+
+// doubles the half resolution view into vram, each pixel pair is one 32-bit store
+static void upscale_2x(const uint16_t *src, uint16_t *vram) {
+    for (int y = 0; y < HALF_HEIGHT; y++) {
+        uint32_t *row = (uint32_t *)&vram[2 * y * SCREEN_WIDTH];
+        for (int x = 0; x < HALF_WIDTH; x++) {
+            uint32_t p = *src++;
+            p |= p << 16;
+            row[x] = p;
+            row[x + HALF_WIDTH] = p; // same pixel on the row below
+        }
+    }
+}
 
-        int y_start = (drawStart < 0) ? 0 : drawStart;
-        int y_end = (drawEnd >= SCREEN_HEIGHT) ? SCREEN_HEIGHT - 1 : drawEnd;
+// everything the world and overlay passes draw from. each vram buffer remembers
+// the view it holds so a frame where none of this changed only redraws the hud
+typedef struct {
+    float posX, posY, dirX, dirY, pitch;
+    float bulletX, bulletY;
+    int bulletActive, colWidth, perfMode, texturedFloor, level, shootEffectTimer, gunShootTimer, gunIdleFrame;
+    unsigned doorGen;
+    struct { float x, y; int frame; } enemies[MAX_ENEMIES]; // frame -1 = dead, attack frames + 0x100
+} ViewState;
+
+// gint may alternate between two vram buffers
+static struct { const uint16_t *vram; ViewState view; } drawnViews[2];
+
+static void capture_view(ViewState *v) {
+    memset(v, 0, sizeof *v);
+    v->posX = posX; v->posY = posY;
+    v->dirX = dirX; v->dirY = dirY;
+    v->pitch = pitch;
+    if (bullet.active) {
+        v->bulletActive = 1;
+        v->bulletX = bullet.x; v->bulletY = bullet.y;
+    }
+    v->colWidth = colWidth;
+    v->perfMode = perfMode;
+    v->texturedFloor = texturedFloor;
+    v->level = currentLevel;
+    v->doorGen = doorGen;
+    v->shootEffectTimer = shootEffectTimer;
+    v->gunShootTimer = gunShootTimer;
+    v->gunIdleFrame = gunIdleAnimFrame % GUN_IDLE_FRAMES;
+    for (int i = 0; i < actualEnemyCount; i++) {
+        v->enemies[i].x = enemies[i].x;
+        v->enemies[i].y = enemies[i].y;
+        v->enemies[i].frame = !enemies[i].alive ? -1 : enemies[i].anim_frame | (enemies[i].attacking ? 0x100 : 0);
+    }
+}
 
-        int shade = (side == 1) ? 180 : 255;
-        float intensity = 1.0f / (1.0f + perpWallDist * 0.2f);
-        int final_shade = (int)(shade * intensity);
+// returns true if vram already holds this view, otherwise records it as drawn
+static bool view_unchanged(const ViewState *v) {
+    const uint16_t *vram = gint_vram;
+    int slot = (drawnViews[0].vram == vram || drawnViews[0].vram == NULL) ? 0 : 1;
+    if (drawnViews[slot].vram == vram && !memcmp(&drawnViews[slot].view, v, sizeof *v)) return true;
+    drawnViews[slot].vram = vram;
+    drawnViews[slot].view = *v;
+    return false;
+}
 
-        uint16_t *dest = &vram[y_start * SCREEN_WIDTH + x];
-        for(int y = y_start; y <= y_end; y++) {
-            int texY = (int)texPos & (TEX_HEIGHT - 1);
-            texPos += step_tex;
-            uint8_t idx = wall_textures[currentLevel - 1][texY * TEX_WIDTH + texX];
-            uint16_t color = wall_palette[idx];
+// vram was overwritten (splash screens) or the map changed
+static void invalidate_view(void) {
+    drawnViews[0].vram = NULL;
+    drawnViews[1].vram = NULL;
+}
 
-            if (final_shade < 240) {
-                int r = ((color >> 11) * final_shade) >> 8;
-                int g = (((color >> 6) & 0x1F) * final_shade) >> 8;
-                int b = ((color & 0x1F) * final_shade) >> 8;
-                color = (r << 11) | (g << 6) | b;
-            }
+static void render_world(const RenderTarget *rt) {
+    int scale = SCREEN_WIDTH / rt->width;
+    int horiz = (int)pitch / scale;
 
-            dest[0] = color; dest[1] = color; dest[2] = color; dest[3] = color;
-            dest += SCREEN_WIDTH;
-        }
+    // wall rendering (fixed point, see raycast.c), also fills ceiling and floor
+    PERF_ENTER(PERF_WALLS);
+    fix_t camX = fix_from_float(posX), camY = fix_from_float(posY);
+    uint8_t tileTexture[TILE_TYPE_COUNT];
+    for(int t = 0; t < TILE_TYPE_COUNT; t++) {
+        tileTexture[t] = (tileInfo[t].texture == TEX_LEVEL) ? currentLevel - 1 : tileInfo[t].texture;
+    }
+    for(int x = 0; x < rt->width; x += colWidth) {
+        RayHit hit;
+        raycast_column(camX, camY, x * scale, &hit);
+
+        // the half resolution view is 198 wide, not a multiple of 4
+        int width = (x + colWidth > rt->width) ? rt->width - x : colWidth;
+        for(int i=0; i<width; i++) zBuffer[x+i] = hit.perpDist;
+        wall_draw_column(rt, x, width, &hit, horiz, tileTexture[hit.tile]);
     }
+    if (texturedFloor) wall_draw_floor(rt, camX, camY, horiz, colWidth, currentLevel - 1);
+    PERF_LEAVE(PERF_WALLS);
 
     // enemy and sphere thingy rendering
+    PERF_ENTER(PERF_SPRITES);
+    // visible sprites nearest first, drawn front to back so rows a nearer one
+    // covered are never touched again
+    struct { float tx, ty; int i; } order[MAX_ENEMIES + 1];
+    int visible = 0;
+    int cellX = (int)posX, cellY = (int)posY;
+    // enemies and the sphere are as wide as they are tall
+    float halfWidth = (float)rt->height / rt->width;
     for(int i = 0; i < actualEnemyCount + 1; i++) {
         float sx, sy;
         bool active = false;
@@ -163,74 +230,69 @@ void render() {
         else { sx = enemies[i].x; sy = enemies[i].y; active = enemies[i].alive; }
         
         if (!active) continue;
+        if (!pvs_visible(cellX, cellY, (int)sx, (int)sy)) continue;
+        if (!camera_in_view(&camera, sx, sy, halfWidth)) continue;
 
-        float rx = sx - posX, ry = sy - posY;
-        float invDet = 1.0f / (planeX * dirY - dirX * planeY);
-        float tx = invDet * (dirY * rx - dirX * ry);
-        float ty = invDet * (-planeY * rx + planeX * ry);
-
-        if(ty > 0.3f) {
-            int screenX = (int)((SCREEN_WIDTH / 2) * (1 + tx / ty));
-            int h = (int)fabsf(SCREEN_HEIGHT / ty);
-            int spr_w = ENEMY_MELEE_WALK_WIDTH, spr_h = ENEMY_MELEE_WALK_HEIGHT;
-            int w = isSphere ? h : (int)(h * (float)spr_w / spr_h);
-            int x_s = screenX - w/2, y_s = SCREEN_HEIGHT / 2 - h / 2 + horiz;
-            int x_e = screenX + w/2;
-
-            if (isSphere) {
-                for(int x = x_s; x < x_e; x++) {
-                    if(x >= 0 && x < SCREEN_WIDTH && ty < zBuffer[x]) {
-                        int vh = h / 2;
-                        int vs = SCREEN_HEIGHT / 2 + horiz;
-                        int ve = vs + vh;
-                        if (vs < 0) vs = 0;
-                        if (ve >= SCREEN_HEIGHT) ve = SCREEN_HEIGHT - 1;
-                        for(int y = vs; y <= ve; y++) vram[y * SCREEN_WIDTH + x] = C_WHITE;
-                    }
-                }
+        float tx, ty;
+        camera_transform(&camera, sx, sy, &tx, &ty);
+        if (ty <= 0.3f) continue;
+
+        int n = visible++;
+        for (; n > 0 && order[n - 1].ty > ty; n--) order[n] = order[n - 1];
+        order[n].tx = tx; order[n].ty = ty; order[n].i = i;
+    }
+
+    sprite_clip_reset(rt->width);
+    for(int s = 0; s < visible; s++) {
+        int i = order[s].i;
+        float tx = order[s].tx, ty = order[s].ty;
+        bool isSphere = (i == actualEnemyCount);
+        fix_t depth = fix_from_float(ty);
+        int screenX = (int)((rt->width / 2) * (1 + tx / ty));
+        int h = (int)fabsf(rt->height / ty);
+        int spr_w = ENEMY_MELEE_WALK_WIDTH, spr_h = ENEMY_MELEE_WALK_HEIGHT;
+        int w = isSphere ? h : (int)(h * (float)spr_w / spr_h);
+        int x_s = screenX - w/2, y_s = rt->height / 2 - h / 2 + horiz;
+        int x_e = screenX + w/2;
+
+        if (isSphere) {
+            sprite_fill(rt, zBuffer, depth, x_s, rt->height / 2 + horiz, x_e - x_s, h / 2 + 1, C_WHITE);
+        } else {
+            // smallest level that is still at least as tall as the sprite on screen,
+            // far enemies then walk a half or quarter size frame
+            int lod = 0;
+            while (lod < ENEMY_MELEE_WALK_LODS - 1 && (spr_h >> (lod + 1)) >= h) lod++;
+            spr_w >>= lod; spr_h >>= lod;
+            const enemy_melee_walk_frame_t *fi_w = &enemy_melee_walk_frame_info[lod][enemies[i].anim_frame % ENEMY_MELEE_WALK_FRAMES];
+            const enemy_melee_attack_frame_t *fi_a = &enemy_melee_attack_frame_info[lod][enemies[i].anim_frame % ENEMY_MELEE_ATTACK_FRAMES];
+            SpriteImage img;
+            int fx, fy;
+            if (enemies[i].attacking) {
+                fx = fi_a->x; fy = fi_a->y;
+                img.w = fi_a->w; img.h = fi_a->h;
+                img.spans = &enemy_melee_attack_spans[fi_a->spans];
+                img.lines = &enemy_melee_attack_lines[fi_a->lines];
+                img.palette = enemy_melee_attack_palette;
             } else {
-                const enemy_melee_walk_frame_t *fi_w = &enemy_melee_walk_frame_info[enemies[i].anim_frame % ENEMY_MELEE_WALK_FRAMES];
-                const enemy_melee_attack_frame_t *fi_a = &enemy_melee_attack_frame_info[enemies[i].anim_frame % ENEMY_MELEE_ATTACK_FRAMES];
-                int fx, fy, fw, fh;
-                const uint8_t *pixels;
-                const uint16_t *palette;
-                int trans_idx;
-                if (enemies[i].attacking) {
-                    fx = fi_a->x; fy = fi_a->y; fw = fi_a->w; fh = fi_a->h;
-                    pixels = &enemy_melee_attack_pixels[fi_a->offset];
-                    palette = enemy_melee_attack_palette;
-                    trans_idx = ENEMY_MELEE_ATTACK_TRANSPARENT_IDX;
-                } else {
-                    fx = fi_w->x; fy = fi_w->y; fw = fi_w->w; fh = fi_w->h;
-                    pixels = &enemy_melee_walk_pixels[fi_w->offset];
-                    palette = enemy_melee_walk_palette;
-                    trans_idx = ENEMY_MELEE_WALK_TRANSPARENT_IDX;
-                }
-                float scale_x = (float)w / spr_w, scale_y = (float)h / spr_h;
-                int crop_scr_w = (int)(fw * scale_x);
-                int crop_scr_h = (int)(fh * scale_y);
-                int x0_scr = x_s + (int)(fx * scale_x);
-                int y0_scr = y_s + (int)(fy * scale_y);
-                for (int dy = 0; dy < crop_scr_h; dy++) {
-                    int py = y0_scr + dy;
-                    if (py < 0 || py >= SCREEN_HEIGHT) continue;
-                    int texY = dy * fh / crop_scr_h;
-                    for (int dx = 0; dx < crop_scr_w; dx++) {
-                        int px = x0_scr + dx;
-                        if (px < 0 || px >= SCREEN_WIDTH) continue;
-                        if (ty >= zBuffer[px]) continue;
-                        int texX = dx * fw / crop_scr_w;
-                        uint8_t idx = pixels[texY * fw + texX];
-                        if (idx != trans_idx) {
-                            uint16_t color = palette[idx];
-                            vram[py * SCREEN_WIDTH + px] = color;
-                        }
-                    }
-                }
+                fx = fi_w->x; fy = fi_w->y;
+                img.w = fi_w->w; img.h = fi_w->h;
+                img.spans = &enemy_melee_walk_spans[fi_w->spans];
+                img.lines = &enemy_melee_walk_lines[fi_w->lines];
+                img.palette = enemy_melee_walk_palette;
             }
+            float scale_x = (float)w / spr_w, scale_y = (float)h / spr_h;
+            int crop_scr_w = (int)(img.w * scale_x);
+            int crop_scr_h = (int)(img.h * scale_y);
+            int x0_scr = x_s + (int)(fx * scale_x);
+            int y0_scr = y_s + (int)(fy * scale_y);
+            sprite_draw(rt, zBuffer, depth, x0_scr, y0_scr, crop_scr_w, crop_scr_h, &img);
         }
     }
 
+    PERF_LEAVE(PERF_SPRITES);
+}
+
+static void render_hud(void) {
     // health bar (will eventually be white liquid jar)
     int hp_bar_w = 100;
     int hp_bar_h = 10;
@@ -242,17 +304,45 @@ void render() {
         if (current_hp_w > hp_bar_w) current_hp_w = hp_bar_w;
         drect(hp_x, hp_y, hp_x + current_hp_w, hp_y + hp_bar_h, C_RGB(31, 0, 0));
     }
+}
+
+// gun and shoot effect frames never move, decoded once at startup
+static SpriteOverlay shootEffectOverlays[SHOOT_EFFECT_FRAMES];
+static SpriteOverlay gunIdleOverlays[GUN_IDLE_FRAMES];
+static SpriteOverlay gunShootOverlays[GUN_SHOOT_FRAMES];
+
+static void prepare_overlays(void) {
+    for (int i = 0; i < SHOOT_EFFECT_FRAMES; i++) {
+        const shoot_effect_frame_t *fi = &shoot_effect_frame_info[i];
+        SpriteImage img = { &shoot_effect_spans[fi->spans], &shoot_effect_lines[fi->lines], fi->w, fi->h, shoot_effect_palette };
+        sprite_prepare_overlay(&shootEffectOverlays[i], SCREEN_WIDTH, SCREEN_HEIGHT,
+            SCREEN_WIDTH / 2 - SHOOT_EFFECT_WIDTH / 2 + fi->x, (SCREEN_HEIGHT - SHOOT_EFFECT_HEIGHT) / 2 + fi->y, &img);
+    }
+    for (int i = 0; i < GUN_IDLE_FRAMES; i++) {
+        const gun_idle_frame_t *fi = &gun_idle_frame_info[i];
+        SpriteImage img = { &gun_idle_spans[fi->spans], &gun_idle_lines[fi->lines], fi->w, fi->h, gun_idle_palette };
+        sprite_prepare_overlay(&gunIdleOverlays[i], SCREEN_WIDTH, SCREEN_HEIGHT,
+            SCREEN_WIDTH - GUN_IDLE_WIDTH + fi->x, SCREEN_HEIGHT - GUN_IDLE_HEIGHT + fi->y, &img);
+    }
+    for (int i = 0; i < GUN_SHOOT_FRAMES; i++) {
+        const gun_shoot_frame_t *fi = &gun_shoot_frame_info[i];
+        SpriteImage img = { &gun_shoot_spans[fi->spans], &gun_shoot_lines[fi->lines], fi->w, fi->h, gun_shoot_palette };
+        sprite_prepare_overlay(&gunShootOverlays[i], SCREEN_WIDTH, SCREEN_HEIGHT,
+            SCREEN_WIDTH - GUN_SHOOT_WIDTH + fi->x, SCREEN_HEIGHT - GUN_SHOOT_HEIGHT + fi->y, &img);
+    }
+}
+
+static void render_overlays(void) {
+    RenderTarget screen = { gint_vram, SCREEN_WIDTH, SCREEN_HEIGHT };
 
     // bullet and crosshair rendering
-    if(bullet.active) {
-        float bx = bullet.x - posX, by = bullet.y - posY;
-        float invDetB = 1.0f / (planeX * dirY - dirX * planeY);
-        float tbx = invDetB * (dirY * bx - dirX * by);
-        float tby = invDetB * (-planeY * bx + planeX * by);
+    if(bullet.active && camera_in_view(&camera, bullet.x, bullet.y, 0.0f)) {
+        float tbx, tby;
+        camera_transform(&camera, bullet.x, bullet.y, &tbx, &tby);
         if(tby > 0.1f) {
             int bsx = (int)((SCREEN_WIDTH / 2) * (1 + tbx / tby));
             int bsy = SCREEN_HEIGHT / 2;
-            if(bsx >= 0 && bsx < SCREEN_WIDTH && tby < zBuffer[bsx]) drect(bsx-1, bsy-1, bsx+1, bsy+1, C_WHITE);
+            if(bsx >= 0 && bsx < SCREEN_WIDTH && fix_from_float(tby) < zBuffer[perfMode ? bsx / 2 : bsx]) drect(bsx-1, bsy-1, bsx+1, bsy+1, C_WHITE);
         }
     }
 
@@ -265,76 +355,59 @@ void render() {
         int frame = SHOOT_EFFECT_FRAMES - shootEffectTimer;
         if (frame < 0) frame = 0;
         if (frame >= SHOOT_EFFECT_FRAMES) frame = SHOOT_EFFECT_FRAMES - 1;
-        const shoot_effect_frame_t *fi = &shoot_effect_frame_info[frame];
-        const uint8_t *src_indices = &shoot_effect_pixels[fi->offset];
-        int x0 = cx - SHOOT_EFFECT_WIDTH / 2 + fi->x, y0 = (SCREEN_HEIGHT - SHOOT_EFFECT_HEIGHT) / 2 + fi->y;
-        for (int dy = 0; dy < fi->h; dy++) {
-            for (int dx = 0; dx < fi->w; dx++) {
-                uint8_t idx = src_indices[dy * fi->w + dx];
-                if (idx != SHOOT_EFFECT_TRANSPARENT_IDX) {
-                    uint16_t color = shoot_effect_palette[idx];
-                    int px = x0 + dx, py = y0 + dy;
-                    if (px >= 0 && px < SCREEN_WIDTH && py >= 0 && py < SCREEN_HEIGHT)
-                        vram[py * SCREEN_WIDTH + px] = color;
-                }
-            }
-        }
+        sprite_blit_overlay(&screen, &shootEffectOverlays[frame]);
     }
 
     // gun rendering
-    {
-        int gun_frame;
-        const gun_idle_frame_t *fi_idle;
-        const gun_shoot_frame_t *fi_shoot;
-        const uint8_t *src_indices;
-        const uint16_t *palette;
-        int x0, y0, fw, fh;
-        int transparent_idx;
-
-        if (gunShootTimer > 0) {
-            int t = GUN_SHOOT_DURATION - gunShootTimer - 1;
-            gun_frame = t * GUN_SHOOT_FRAMES / GUN_SHOOT_DURATION;
-            if (gun_frame < 0) gun_frame = 0;
-            if (gun_frame >= GUN_SHOOT_FRAMES) gun_frame = GUN_SHOOT_FRAMES - 1;
-            fi_shoot = &gun_shoot_frame_info[gun_frame];
-            src_indices = &gun_shoot_pixels[fi_shoot->offset];
-            palette = gun_shoot_palette;
-            x0 = SCREEN_WIDTH - GUN_SHOOT_WIDTH + fi_shoot->x;
-            y0 = SCREEN_HEIGHT - GUN_SHOOT_HEIGHT + fi_shoot->y;
-            fw = fi_shoot->w;
-            fh = fi_shoot->h;
-            transparent_idx = GUN_SHOOT_TRANSPARENT_IDX;
-        } else {
-            gun_frame = gunIdleAnimFrame % GUN_IDLE_FRAMES;
-            fi_idle = &gun_idle_frame_info[gun_frame];
-            src_indices = &gun_idle_pixels[fi_idle->offset];
-            palette = gun_idle_palette;
-            x0 = SCREEN_WIDTH - GUN_IDLE_WIDTH + fi_idle->x;
-            y0 = SCREEN_HEIGHT - GUN_IDLE_HEIGHT + fi_idle->y;
-            fw = fi_idle->w;
-            fh = fi_idle->h;
-            transparent_idx = GUN_IDLE_TRANSPARENT_IDX;
-        }
-        for (int dy = 0; dy < fh; dy++) {
-            for (int dx = 0; dx < fw; dx++) {
-                uint8_t idx = src_indices[dy * fw + dx];
-                if (idx != transparent_idx) {
-                    uint16_t color = palette[idx];
-                    int px = x0 + dx, py = y0 + dy;
-                    if (px >= 0 && px < SCREEN_WIDTH && py >= 0 && py < SCREEN_HEIGHT)
-                        vram[py * SCREEN_WIDTH + px] = color;
-                }
-            }
-        }
+    if (gunShootTimer > 0) {
+        int t = GUN_SHOOT_DURATION - gunShootTimer - 1;
+        int gun_frame = t * GUN_SHOOT_FRAMES / GUN_SHOOT_DURATION;
+        if (gun_frame < 0) gun_frame = 0;
+        if (gun_frame >= GUN_SHOOT_FRAMES) gun_frame = GUN_SHOOT_FRAMES - 1;
+        sprite_blit_overlay(&screen, &gunShootOverlays[gun_frame]);
+    } else {
+        sprite_blit_overlay(&screen, &gunIdleOverlays[gunIdleAnimFrame % GUN_IDLE_FRAMES]);
     }
+}
 
+void render() {
+    perf_frame_begin();
+
+    ViewState view;
+    capture_view(&view);
+    bool idle = view_unchanged(&view);
+    if (!idle) camera_update(&camera, posX, posY, dirX, dirY, planeX, planeY);
+    drewWorld = !idle;
+
+    if (!idle && perfMode) {
+        RenderTarget rt = { halfBuffer, HALF_WIDTH, HALF_HEIGHT };
+        render_world(&rt);
+        upscale_2x(halfBuffer, gint_vram);
+    } else if (!idle) {
+        RenderTarget rt = { gint_vram, SCREEN_WIDTH, SCREEN_HEIGHT };
+        render_world(&rt);
+    }
+    PERF_ENTER(PERF_OVERLAY);
+    render_hud();
+    if (!idle) render_overlays();
+    PERF_LEAVE(PERF_OVERLAY);
+    perf_draw();
+
+    PERF_ENTER(PERF_PRESENT);
     dupdate();
+    PERF_LEAVE(PERF_PRESENT);
+    perf_frame_end();
 }
 
+// second vram: dupdate() hands the finished frame to the DMA and switches
+// gint_vram here, so the next frame is drawn while the transfer runs
+static uint16_t vram_back[SCREEN_WIDTH * SCREEN_HEIGHT] __attribute__((aligned(32)));
+
 unsigned int entropy_seed = 0;
 
 bool show_splash(const uint8_t *pixels, const uint16_t *palette) {
     uint16_t *vram = gint_vram;
+    invalidate_view();
     for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
         vram[i] = palette[pixels[i]];
     }
@@ -358,10 +431,11 @@ bool show_splash(const uint8_t *pixels, const uint16_t *palette) {
 }
 
 bool show_controls_selection() {
-    uint16_t *vram = gint_vram;
+    invalidate_view();
     int current = selectedPreset;
     clearevents();
     while(1) {
+        uint16_t *vram = gint_vram; // switches on every dupdate()
         const uint8_t *pixels;
         const uint16_t *palette;
         if (current == 1) { pixels = preset1_pixels; palette = preset1_palette; }
@@ -399,6 +473,13 @@ bool show_controls_selection() {
 }
 
 int main(void) {
+    perf_init();
+    wall_init();
+    prepare_overlays();
+    perf_calibrate_present();
+    dvram(gint_vram, vram_back);
+    frame_pacing_start();
+
     main_menu:
     while(1) {
         // Initial seed with RTC as a fallback
@@ -413,6 +494,7 @@ int main(void) {
         currentLevel = 1;
         while(1) {
             generateMap();
+            invalidate_view();
 
             // player state reset
             posX = 1.5f; posY = MAP_HEIGHT / 2.0f + 0.5f;
@@ -421,11 +503,11 @@ int main(void) {
             pitch = 0.0f;
             playerHP = 125.0f;
 
-            // scan worldMap for enemies (marked as 3) and sphere (marked as 2)
+            // scan the map for enemies (TILE_ENEMY) and the sphere (TILE_EXIT)
             actualEnemyCount = 0;
             for(int y = 0; y < MAP_HEIGHT; y++) {
                 for(int x = 0; x < MAP_WIDTH; x++) {
-                    if(worldMap[x][y] == 3 && actualEnemyCount < MAX_ENEMIES) {
+                    if(map_get(x, y) == TILE_ENEMY && actualEnemyCount < MAX_ENEMIES) {
                         enemies[actualEnemyCount].x = (float)x + 0.5f;
                         enemies[actualEnemyCount].y = (float)y + 0.5f;
                         enemies[actualEnemyCount].alive = true;
@@ -435,17 +517,18 @@ int main(void) {
                         enemies[actualEnemyCount].anim_frame = 0;
                         actualEnemyCount++;
                     }
-                    if(worldMap[x][y] == 2) {
+                    if(map_get(x, y) == TILE_EXIT) {
                         sphereX = (float)x + 0.5f;
                         sphereY = (float)y + 0.5f;
                     }
                 }
             }
 
-            if (worldMap[(int)posX + 1][(int)posY] == 0) { dirX = 1.0f; dirY = 0.0f; planeX = 0.0f; planeY = 0.66f; }
-            else if (worldMap[(int)posX][(int)posY + 1] == 0) { dirX = 0.0f; dirY = 1.0f; planeX = -0.66f; planeY = 0.0f; }
-            else if (worldMap[(int)posX - 1][(int)posY] == 0) { dirX = -1.0f; dirY = 0.0f; planeX = 0.0f; planeY = -0.66f; }
-            else if (worldMap[(int)posX][(int)posY - 1] == 0) { dirX = 0.0f; dirY = -1.0f; planeX = 0.66f; planeY = 0.0f; }
+            if (map_get((int)posX + 1, (int)posY) == TILE_EMPTY) { dirX = 1.0f; dirY = 0.0f; planeX = 0.0f; planeY = 0.66f; }
+            else if (map_get((int)posX, (int)posY + 1) == TILE_EMPTY) { dirX = 0.0f; dirY = 1.0f; planeX = -0.66f; planeY = 0.0f; }
+            else if (map_get((int)posX - 1, (int)posY) == TILE_EMPTY) { dirX = -1.0f; dirY = 0.0f; planeX = 0.0f; planeY = -0.66f; }
+            else if (map_get((int)posX, (int)posY - 1) == TILE_EMPTY) { dirX = 0.0f; dirY = -1.0f; planeX = 0.66f; planeY = 0.0f; }
+            raycast_set_view(dirX, dirY, planeX, planeY);
 
             bool died = false;
             while(1) {
@@ -463,7 +546,7 @@ int main(void) {
                     bullet.x += bullet.dx * 0.7f;
                     bullet.y += bullet.dy * 0.7f;
                     int bx = (int)bullet.x, by = (int)bullet.y;
-                    if(bx < 0 || bx >= MAP_WIDTH || by < 0 || by >= MAP_HEIGHT || worldMap[bx][by] == 1) {
+                    if(bx < 0 || bx >= MAP_WIDTH || by < 0 || by >= MAP_HEIGHT || map_blocks_bullets(bx, by)) {
                         bullet.active = false;
                     } else {
                         for(int i = 0; i < actualEnemyCount; i++) {
@@ -493,17 +576,12 @@ int main(void) {
                                 if (fabsf(offset) < worldW / 2.0f) {
                                     int texX = (int)((offset / worldW + 0.5f) * ENEMY_MELEE_WALK_WIDTH);
                                     if (texX >= 0 && texX < ENEMY_MELEE_WALK_WIDTH) {
-                                        const enemy_melee_walk_frame_t *hb = &enemy_melee_walk_frame_info[0];
+                                        const enemy_melee_walk_frame_t *hb = &enemy_melee_walk_frame_info[0][0];
                                         bool hit = false;
                                         if (texX >= hb->x && texX < hb->x + hb->w) {
-                                            int px = texX - hb->x;
-                                            for (int ty = hb->y; ty < hb->y + hb->h; ty++) {
-                                                int py = ty - hb->y;
-                                                if (enemy_melee_walk_pixels[hb->offset + py * hb->w + px] != ENEMY_MELEE_WALK_TRANSPARENT_IDX) {
-                                                    hit = true;
-                                                    break;
-                                                }
-                                            }
+                                            // any opaque span in that column of the frame
+                                            int column = enemy_melee_walk_lines[hb->lines + texX - hb->x];
+                                            hit = enemy_melee_walk_spans[hb->spans + column] > 0;
                                         }
                                         
                                         if (hit) {
@@ -533,7 +611,8 @@ int main(void) {
 
                 enemies[i].attacking = (distSq < 0.49f);  // attack animation
 
-                if(enemies[i].mode == 0 && distSq < 64.0f) { // 8 blocks aggro
+                if(enemies[i].mode == 0 && distSq < 64.0f && // 8 blocks aggro, needs line of sight
+                   pvs_visible((int)posX, (int)posY, (int)enemies[i].x, (int)enemies[i].y)) {
                     enemies[i].mode = 1;
                 }
 
@@ -557,8 +636,8 @@ int main(void) {
                         float n_edx = posX - nextX;
                         float n_edy = posY - nextY;
                         if(n_edx*n_edx + n_edy*n_edy > 0.25f) { // keep 0.5 distance
-                            if(worldMap[(int)nextX][(int)enemies[i].y] != 1) enemies[i].x = nextX;
-                            if(worldMap[(int)enemies[i].x][(int)nextY] != 1) enemies[i].y = nextY;
+                            if(!map_solid((int)nextX, (int)enemies[i].y)) enemies[i].x = nextX;
+                            if(!map_solid((int)enemies[i].x, (int)nextY)) enemies[i].y = nextY;
                         } else {
                             // if colliding with player slow player down
                             playerSlowed = true;
@@ -613,18 +692,26 @@ int main(void) {
                     shoot = keydown(KEY_F1);
                 }
 
-                if(moveFwd) { if(worldMap[(int)(posX + dirX * moveStep)][(int)posY] != 1) posX += dirX * moveStep; if(worldMap[(int)posX][(int)(posY + dirY * moveStep)] != 1) posY += dirY * moveStep; }
-                if(moveBack) { if(worldMap[(int)(posX - dirX * moveStep)][(int)posY] != 1) posX -= dirX * moveStep; if(worldMap[(int)posX][(int)(posY - dirY * moveStep)] != 1) posY -= dirY * moveStep; }
-                if(strafeRight) { if(worldMap[(int)(posX + planeX * moveStep)][(int)posY] != 1) posX += planeX * moveStep; if(worldMap[(int)posX][(int)(posY + planeY * moveStep)] != 1) posY += planeY * moveStep; }
-                if(strafeLeft) { if(worldMap[(int)(posX - planeX * moveStep)][(int)posY] != 1) posX -= planeX * moveStep; if(worldMap[(int)posX][(int)(posY - planeY * moveStep)] != 1) posY -= planeY * moveStep; }
-                if(rotateRight) { float odx = dirX; dirX = dirX * cosf(rotStep) - dirY * sinf(rotStep); dirY = odx * sinf(rotStep) + dirY * cosf(rotStep); float opx = planeX; planeX = planeX * cosf(rotStep) - planeY * sinf(rotStep); planeY = opx * sinf(rotStep) + planeY * cosf(rotStep); }
-                if(rotateLeft) { float odx = dirX; dirX = dirX * cosf(-rotStep) - dirY * sinf(-rotStep); dirY = odx * sinf(-rotStep) + dirY * cosf(-rotStep); float opx = planeX; planeX = planeX * cosf(-rotStep) - planeY * sinf(-rotStep); planeY = opx * sinf(-rotStep) + planeY * cosf(-rotStep); }
+                if(moveFwd) { if(!map_solid((int)(posX + dirX * moveStep), (int)posY)) posX += dirX * moveStep; if(!map_solid((int)posX, (int)(posY + dirY * moveStep))) posY += dirY * moveStep; }
+                if(moveBack) { if(!map_solid((int)(posX - dirX * moveStep), (int)posY)) posX -= dirX * moveStep; if(!map_solid((int)posX, (int)(posY - dirY * moveStep))) posY -= dirY * moveStep; }
+                if(strafeRight) { if(!map_solid((int)(posX + planeX * moveStep), (int)posY)) posX += planeX * moveStep; if(!map_solid((int)posX, (int)(posY + planeY * moveStep))) posY += planeY * moveStep; }
+                if(strafeLeft) { if(!map_solid((int)(posX - planeX * moveStep), (int)posY)) posX -= planeX * moveStep; if(!map_solid((int)posX, (int)(posY - planeY * moveStep))) posY -= planeY * moveStep; }
+                if(rotateRight) { float odx = dirX; dirX = dirX * cosf(rotStep) - dirY * sinf(rotStep); dirY = odx * sinf(rotStep) + dirY * cosf(rotStep); float opx = planeX; planeX = planeX * cosf(rotStep) - planeY * sinf(rotStep); planeY = opx * sinf(rotStep) + planeY * cosf(rotStep); raycast_set_view(dirX, dirY, planeX, planeY); }
+                if(rotateLeft) { float odx = dirX; dirX = dirX * cosf(-rotStep) - dirY * sinf(-rotStep); dirY = odx * sinf(-rotStep) + dirY * cosf(-rotStep); float opx = planeX; planeX = planeX * cosf(-rotStep) - planeY * sinf(-rotStep); planeY = opx * sinf(-rotStep) + planeY * cosf(-rotStep); raycast_set_view(dirX, dirY, planeX, planeY); }
                 
                 if (selectedPreset != 3) {
                     if(keydown(KEY_UP)) { pitch += 5.0f; if (pitch > 110) pitch = 110; }
                     if(keydown(KEY_DOWN)) { pitch -= 5.0f; if (pitch < -110) pitch = -110; }
                 }
 
+                // VARS toggles the half resolution performance mode, F5 the textured floor
+                static bool perfKeyHeld = false, floorKeyHeld = false;
+                bool perfKey = keydown(KEY_VARS), floorKey = keydown(KEY_F5);
+                if (perfKey && !perfKeyHeld) perfMode = !perfMode;
+                if (floorKey && !floorKeyHeld) texturedFloor = !texturedFloor;
+                perfKeyHeld = perfKey;
+                floorKeyHeld = floorKey;
+
                 if(shoot) {
                     if (!bullet.active) {
                         bullet.x = posX + dirX * 0.2f; bullet.y = posY + dirY * 0.2f;
@@ -637,8 +724,10 @@ int main(void) {
                     }
                 }
 
-                // Check if player is on the exit area (tile type 2)
-                if (worldMap[(int)posX][(int)posY] == 2) {
+                doors_update(posX, posY, enemy_in_cell);
+
+                // Check if player is on the exit area
+                if (map_get((int)posX, (int)posY) == TILE_EXIT) {
                     if (currentLevel == NUM_LEVELS) {
                         if (!show_splash(winscreen_pixels, winscreen_palette)) return 0;
                         currentLevel = 1;
@@ -649,6 +738,7 @@ int main(void) {
                 }
 
                 clearevents();  // clear events
+                frame_wait();
             }
 
             if (died) {
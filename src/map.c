@@ -1,26 +1,126 @@
 #include <stdlib.h>
 #include <stdbool.h>
 #include <math.h>
+#include <string.h>
 #include "map.h"
+#include "pvs.h"
+#include "perf.h"
+#include "assets/wall_texture.h" // WALL_TEX_DOOR
 
-int worldMap[MAP_WIDTH][MAP_HEIGHT];
+const TileInfo tileInfo[TILE_TYPE_COUNT] = {
+    [TILE_EMPTY] = { 0, TEX_LEVEL },
+    [TILE_WALL]  = { TILE_SOLID | TILE_BLOCKS_BULLETS, TEX_LEVEL },
+    [TILE_EXIT]  = { 0, TEX_LEVEL },
+    [TILE_ENEMY] = { 0, TEX_LEVEL },
+    [TILE_DOOR]  = { TILE_SOLID | TILE_BLOCKS_BULLETS, WALL_TEX_DOOR },
+};
+
+uint8_t mapCells[MAP_HEIGHT][MAP_WIDTH];
+uint32_t mapSolid[MAP_HEIGHT];
+uint32_t mapOpaque[MAP_HEIGHT];
+uint8_t wallDistance[MAP_HEIGHT][MAP_WIDTH];
+
+Door doors[MAX_DOORS];
+int doorCount;
+unsigned doorGen;
+
+#define DOOR_SPEED (FIX_ONE / 8)           // open fraction per frame
+#define DOOR_PASSABLE (FIX_ONE * 3 / 4)    // stops being solid from here
+#define DOOR_RANGE_SQ 4.0f                 // opens within 2 cells of the player
+
+void map_set(int x, int y, int type) {
+    uint32_t bit = (uint32_t)1 << x;
+    uint8_t flags = tileInfo[type].flags;
+    mapCells[y][x] = type;
+    mapSolid[y] = (flags & TILE_SOLID) ? (mapSolid[y] | bit) : (mapSolid[y] & ~bit);
+    // a solid tile that isn't see-through is what the DDA stops on
+    bool opaque = (flags & TILE_SOLID) && !(flags & TILE_TRANSPARENT);
+    mapOpaque[y] = opaque ? (mapOpaque[y] | bit) : (mapOpaque[y] & ~bit);
+}
 
 static void create_room(int rx, int ry, int rw, int rh) {
     for (int x = rx; x < rx + rw; x++) {
         for (int y = ry; y < ry + rh; y++) {
             if (x > 0 && x < MAP_WIDTH - 1 && y > 0 && y < MAP_HEIGHT - 1) {
-                worldMap[x][y] = 0;
+                map_set(x, y, TILE_EMPTY);
             }
         }
     }
 }
 
+static bool is_open(int x, int y) { return map_get(x, y) == TILE_EMPTY; }
+
+// a one cell wide corridor running along (dx, dy) that opens into a room
+// (open on both sides) at either end
+static bool door_fits(int x, int y, int dx, int dy) {
+    if (!is_open(x, y) || !map_solid(x - dy, y - dx) || !map_solid(x + dy, y + dx)) return false;
+    if (!is_open(x - dx, y - dy) || !is_open(x + dx, y + dy)) return false;
+    for (int s = -1; s <= 1; s += 2) {
+        int rx = x + s * dx, ry = y + s * dy;
+        if (is_open(rx - dy, ry - dx) && is_open(rx + dy, ry + dx)) return true;
+    }
+    return false;
+}
+
+static void place_doors(void) {
+    doorCount = 0;
+    for (int x = 5; x < MAP_WIDTH - 1; x++) {
+        for (int y = 1; y < MAP_HEIGHT - 1; y++) {
+            if (doorCount == MAX_DOORS) return;
+            int axis;
+            if (door_fits(x, y, 1, 0)) axis = 0;
+            else if (door_fits(x, y, 0, 1)) axis = 1;
+            else continue;
+
+            bool crowded = false;
+            for (int i = 0; i < doorCount; i++) {
+                if (abs(doors[i].x - x) <= 1 && abs(doors[i].y - y) <= 1) crowded = true;
+            }
+            if (crowded) continue;
+
+            doors[doorCount].x = x;
+            doors[doorCount].y = y;
+            doors[doorCount].axis = axis;
+            doors[doorCount].open = 0;
+            doorCount++;
+            map_set(x, y, TILE_DOOR);
+        }
+    }
+}
+
+const Door *map_door(int x, int y) {
+    for (int i = 0; i < doorCount; i++) {
+        if (doors[i].x == x && doors[i].y == y) return &doors[i];
+    }
+    return NULL;
+}
+
+void doors_update(float playerX, float playerY, bool (*occupied)(int x, int y)) {
+    for (int i = 0; i < doorCount; i++) {
+        Door *d = &doors[i];
+        // the player's own cell is always in range
+        float dx = playerX - (d->x + 0.5f), dy = playerY - (d->y + 0.5f);
+        fix_t open = d->open;
+        if (dx * dx + dy * dy < DOOR_RANGE_SQ || occupied(d->x, d->y)) open += DOOR_SPEED;
+        else open -= DOOR_SPEED;
+        if (open < 0) open = 0;
+        if (open > FIX_ONE) open = FIX_ONE;
+        if (open == d->open) continue;
+
+        d->open = open;
+        doorGen++;
+        uint32_t bit = (uint32_t)1 << d->x;
+        if (open >= DOOR_PASSABLE) mapSolid[d->y] &= ~bit;
+        else mapSolid[d->y] |= bit;
+    }
+}
+
 void generateMap(void) {
     // 1. Initialize with walls
-    for (int x = 0; x < MAP_WIDTH; x++) {
-        for (int y = 0; y < MAP_HEIGHT; y++) {
-            worldMap[x][y] = 1;
-        }
+    memset(mapCells, TILE_WALL, sizeof(mapCells));
+    for (int y = 0; y < MAP_HEIGHT; y++) {
+        mapSolid[y] = 0xFFFFFFFFu >> (32 - MAP_WIDTH);
+        mapOpaque[y] = mapSolid[y];
     }
 
     // 2. Path-based generation (inspired by obj_world_builder)
@@ -29,13 +129,13 @@ void generateMap(void) {
     int goal_x = MAP_WIDTH - 2;
 
     while (path_x <= goal_x) {
-        worldMap[path_x][path_y] = 0;
+        map_set(path_x, path_y, TILE_EMPTY);
         
         // Occasionally clear extra Y for wider corridors
         if (rand() % 100 < 40) {
             int extra_y = path_y + (rand() % 2 == 0 ? 1 : -1);
             if (extra_y > 0 && extra_y < MAP_HEIGHT - 1) {
-                worldMap[path_x][extra_y] = 0;
+                map_set(path_x, extra_y, TILE_EMPTY);
             }
         }
 
@@ -62,28 +162,31 @@ void generateMap(void) {
                 int px = rx + rw / 2;
                 int py = ry + rh / 2;
                 if (px > 0 && px < MAP_WIDTH - 1 && py > 0 && py < MAP_HEIGHT - 1) {
-                    worldMap[px][py] = 1;
+                    map_set(px, py, TILE_WALL);
                 }
             }
         }
     }
 
     // 3. Ensure the start is clear
-    worldMap[1][MAP_HEIGHT / 2] = 0;
-    worldMap[2][MAP_HEIGHT / 2] = 0;
+    map_set(1, MAP_HEIGHT / 2, TILE_EMPTY);
+    map_set(2, MAP_HEIGHT / 2, TILE_EMPTY);
 
     // 4. Place exit sphere at the end of the path and create a small room around it
     create_room(goal_x - 1, path_y - 1, 3, 3);
-    worldMap[goal_x][path_y] = 2;
+    map_set(goal_x, path_y, TILE_EXIT);
+
+    // 5. Put doors where a one cell wide corridor opens into a room
+    place_doors();
 
-    // 5. Find air spaces and pick enemy locations
+    // 6. Find air spaces and pick enemy locations
     struct { int x, y; } air_spaces[MAP_WIDTH * MAP_HEIGHT];
     int air_count = 0;
 
     for (int x = 1; x < MAP_WIDTH - 1; x++) {
         for (int y = 1; y < MAP_HEIGHT - 1; y++) {
             // Avoid placing enemies too close to the start or on the goal
-            if (worldMap[x][y] == 0 && (x > 4)) {
+            if (map_get(x, y) == TILE_EMPTY && (x > 4)) {
                 air_spaces[air_count].x = x;
                 air_spaces[air_count].y = y;
                 air_count++;
@@ -91,7 +194,7 @@ void generateMap(void) {
         }
     }
 
-    // 6. Place enemies (marked as 3)
+    // 7. Place enemies (marked as 3)
     int enemies_to_place = (air_count < 10) ? air_count : 10;
     // Shuffle air_spaces
     for (int i = 0; i < air_count; i++) {
@@ -105,6 +208,40 @@ void generateMap(void) {
     }
 
     for (int i = 0; i < enemies_to_place; i++) {
-        worldMap[air_spaces[i].x][air_spaces[i].y] = 3;
+        map_set(air_spaces[i].x, air_spaces[i].y, TILE_ENEMY);
+    }
+
+    buildDistanceField();
+    // no loading screen, so this stalls the frame a new level starts on
+    perf_time_load("pvs build", pvs_build);
+}
+
+static uint8_t min_u8(uint8_t a, uint8_t b) { return a < b ? a : b; }
+
+void buildDistanceField(void) {
+    // two-pass chamfer over the 8 neighbours, exact for the Chebyshev metric.
+    // the border is all walls so out of range neighbours never matter
+    for (int x = 0; x < MAP_WIDTH; x++) {
+        for (int y = 0; y < MAP_HEIGHT; y++) {
+            wallDistance[y][x] = map_opaque(x, y) ? 0 : 255;
+        }
+    }
+    for (int x = 1; x < MAP_WIDTH; x++) {
+        for (int y = 1; y < MAP_HEIGHT - 1; y++) {
+            uint8_t d = wallDistance[y - 1][x - 1];
+            d = min_u8(d, wallDistance[y][x - 1]);
+            d = min_u8(d, wallDistance[y + 1][x - 1]);
+            d = min_u8(d, wallDistance[y - 1][x]);
+            if (d + 1 < wallDistance[y][x]) wallDistance[y][x] = d + 1;
+        }
+    }
+    for (int x = MAP_WIDTH - 2; x >= 0; x--) {
+        for (int y = MAP_HEIGHT - 2; y > 0; y--) {
+            uint8_t d = wallDistance[y - 1][x + 1];
+            d = min_u8(d, wallDistance[y][x + 1]);
+            d = min_u8(d, wallDistance[y + 1][x + 1]);
+            d = min_u8(d, wallDistance[y + 1][x]);
+            if (d + 1 < wallDistance[y][x]) wallDistance[y][x] = d + 1;
+        }
     }
 }
@@ -1,11 +1,73 @@
 #ifndef MAP_H
 #define MAP_H
 
+#include <stdint.h>
+#include <stdbool.h>
+#include "fixed.h"
+
 #define MAP_WIDTH 32
 #define MAP_HEIGHT 20
 
-extern int worldMap[MAP_WIDTH][MAP_HEIGHT];
+#if MAP_WIDTH > 32
+#error "mapSolid keeps one 32-bit mask per row"
+#endif
+
+enum { TILE_EMPTY = 0, TILE_WALL = 1, TILE_EXIT = 2, TILE_ENEMY = 3, TILE_DOOR = 4, TILE_TYPE_COUNT };
+
+// tile flags
+#define TILE_SOLID 0x01          // blocks the player and enemies
+#define TILE_BLOCKS_BULLETS 0x02
+#define TILE_TRANSPARENT 0x04    // rays pass through (glass, open doors)
+
+#define TEX_LEVEL 0xFF // use the current level's wall texture
+
+typedef struct {
+    uint8_t flags;
+    uint8_t texture; // wall texture index or TEX_LEVEL
+} TileInfo;
+
+extern const TileInfo tileInfo[TILE_TYPE_COUNT];
+
+#define MAX_DOORS 8
+
+// a sliding panel through the middle of its cell, doors are never adjacent
+typedef struct {
+    uint8_t x, y;
+    uint8_t axis; // 0 = panel at x + 0.5 (corridor along x), 1 = panel at y + 0.5
+    fix_t open;   // 0 = closed, FIX_ONE = slid fully into the wall
+} Door;
+
+extern Door doors[MAX_DOORS];
+extern int doorCount;
+// bumped whenever a door moves, so idle frames notice the animation
+extern unsigned doorGen;
+
+// one byte per cell, row-major so a 32-cell row fills one cache line
+extern uint8_t mapCells[MAP_HEIGHT][MAP_WIDTH];
+// bit x of mapSolid[y] is set when cell (x, y) is TILE_SOLID
+extern uint32_t mapSolid[MAP_HEIGHT];
+// bit x of mapOpaque[y] is set when rays stop at cell (x, y)
+extern uint32_t mapOpaque[MAP_HEIGHT];
+// Chebyshev distance to the nearest opaque cell, 0 on those. every cell
+// within distance - 1 of a cell is open, which lets the raycaster skip ahead
+extern uint8_t wallDistance[MAP_HEIGHT][MAP_WIDTH];
+
+// none of these check bounds, the outer ring of the map is always wall
+static inline int map_get(int x, int y) { return mapCells[y][x]; }
+static inline const TileInfo *map_tile(int x, int y) { return &tileInfo[mapCells[y][x]]; }
+static inline bool map_solid(int x, int y) { return (mapSolid[y] >> x) & 1; }
+static inline bool map_opaque(int x, int y) { return (mapOpaque[y] >> x) & 1; }
+// doors only stop bullets while they are still solid
+static inline bool map_blocks_bullets(int x, int y) { return map_solid(x, y) && (map_tile(x, y)->flags & TILE_BLOCKS_BULLETS); }
 
+void map_set(int x, int y, int type);
+// NULL if there is no door at (x, y)
+const Door *map_door(int x, int y);
+// slide doors open near the player and shut again behind them, once per frame.
+// a door also opens while `occupied` says something is standing in its cell,
+// so it never closes on an enemy
+void doors_update(float playerX, float playerY, bool (*occupied)(int x, int y));
 void generateMap(void);
+void buildDistanceField(void);
 
 #endif
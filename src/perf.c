@@ -0,0 +1,76 @@
+#include "perf.h"
+
+#ifdef POSTVOID_PROFILE
+#include <gint/display.h>
+
+#define PERF_AVG_FRAMES 16
+
+prof_t perf_timers[PERF_TIMER_COUNT];
+uint32_t perf_counters[PERF_COUNTER_COUNT];
+
+static const char *timer_names[PERF_TIMER_COUNT] = { "walls", "sprites", "overlay", "present" };
+static const char *counter_names[PERF_COUNTER_COUNT] = { "dda steps", "wall px", "fill px", "door tests" };
+
+// running sums over PERF_AVG_FRAMES frames, shown as averages
+static uint32_t timer_sum[PERF_TIMER_COUNT], counter_sum[PERF_COUNTER_COUNT];
+static uint32_t timer_avg[PERF_TIMER_COUNT], counter_avg[PERF_COUNTER_COUNT];
+static int frames = 0;
+
+// one dupdate() timed before the second vram is installed, i.e. a full synchronous transfer
+static uint32_t sync_present_us;
+
+static const char *load_name = "load";
+static uint32_t load_us;
+
+void perf_init(void) {
+    prof_init();
+    perf_frame_begin();
+}
+
+void perf_calibrate_present(void) {
+    prof_t p = prof_make();
+    prof_enter(p);
+    dupdate();
+    prof_leave(p);
+    sync_present_us = prof_time(p);
+}
+
+void perf_time_load(const char *name, void (*step)(void)) {
+    prof_t p = prof_make();
+    prof_enter(p);
+    step();
+    prof_leave(p);
+    load_name = name;
+    load_us = prof_time(p);
+}
+
+void perf_frame_begin(void) {
+    for (int i = 0; i < PERF_TIMER_COUNT; i++) perf_timers[i] = prof_make();
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) perf_counters[i] = 0;
+}
+
+void perf_frame_end(void) {
+    for (int i = 0; i < PERF_TIMER_COUNT; i++) timer_sum[i] += prof_time(perf_timers[i]);
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) counter_sum[i] += perf_counters[i];
+    if (++frames < PERF_AVG_FRAMES) return;
+
+    for (int i = 0; i < PERF_TIMER_COUNT; i++) { timer_avg[i] = timer_sum[i] / PERF_AVG_FRAMES; timer_sum[i] = 0; }
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++) { counter_avg[i] = counter_sum[i] / PERF_AVG_FRAMES; counter_sum[i] = 0; }
+    frames = 0;
+}
+
+void perf_draw(void) {
+    // opaque so idle frames that skip the world pass don't smear the text
+    drect(0, 0, 130, 2 + 12 * (PERF_TIMER_COUNT + PERF_COUNTER_COUNT + 2), C_BLACK);
+    int y = 2;
+    for (int i = 0; i < PERF_TIMER_COUNT; i++, y += 12)
+        dprint(2, y, C_WHITE, "%s: %d us", timer_names[i], (int)timer_avg[i]);
+    for (int i = 0; i < PERF_COUNTER_COUNT; i++, y += 12)
+        dprint(2, y, C_WHITE, "%s: %d", counter_names[i], (int)counter_avg[i]);
+
+    // transfer time the cpu no longer waits for in dupdate()
+    int hidden = (int)sync_present_us - (int)timer_avg[PERF_PRESENT];
+    dprint(2, y, C_WHITE, "xfer hidden: %d us", hidden > 0 ? hidden : 0);
+    dprint(2, y + 12, C_WHITE, "%s: %d us", load_name, (int)load_us);
+}
+#endif
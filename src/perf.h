@@ -0,0 +1,40 @@
+#ifndef PERF_H
+#define PERF_H
+
+#include <stdint.h>
+
+// per-frame timings and counters, only compiled in with -DPOSTVOID_PROFILE=ON
+enum { PERF_WALLS, PERF_SPRITES, PERF_OVERLAY, PERF_PRESENT, PERF_TIMER_COUNT };
+enum { PERF_DDA_STEPS, PERF_WALL_PIXELS, PERF_FILL_PIXELS, PERF_DOOR_TESTS, PERF_COUNTER_COUNT };
+
+#ifdef POSTVOID_PROFILE
+#include <libprof.h>
+
+extern prof_t perf_timers[PERF_TIMER_COUNT];
+extern uint32_t perf_counters[PERF_COUNTER_COUNT];
+
+#define PERF_ENTER(t) prof_enter(perf_timers[t])
+#define PERF_LEAVE(t) prof_leave(perf_timers[t])
+#define PERF_ADD(c, n) (perf_counters[c] += (n))
+
+void perf_init(void);
+void perf_frame_begin(void);
+void perf_frame_end(void);
+void perf_draw(void);
+void perf_calibrate_present(void);
+// times one map load step, e.g. pvs_build(). the overlay shows the last one
+void perf_time_load(const char *name, void (*step)(void));
+#else
+#define PERF_ENTER(t) ((void)0)
+#define PERF_LEAVE(t) ((void)0)
+#define PERF_ADD(c, n) ((void)0)
+
+static inline void perf_init(void) {}
+static inline void perf_frame_begin(void) {}
+static inline void perf_frame_end(void) {}
+static inline void perf_draw(void) {}
+static inline void perf_calibrate_present(void) {}
+static inline void perf_time_load(const char *name, void (*step)(void)) { (void)name; step(); }
+#endif
+
+#endif
@@ -0,0 +1,295 @@
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "pvs.h"
+#include "fixed.h"
+
+// cell a sees cell b when some segment joins them without touching a wall.
+// two passes find every such pair:
+//  - a fan of rays from each cell's centre. it finds every pair where all
+//    segments between the two cells are clear: the other cell is at most 37
+//    cells away so it spans more than 1.5 degrees, over twice the fan's step
+//  - otherwise one of the clear segments can be slid until it grazes a wall
+//    corner and then turned around that corner until it hits a second grid
+//    vertex. every line through a wall corner and another vertex is walked
+//    along the clear stretch around the corner, marking the pairs it joins
+// so the sets may hold a few cells too many but never miss one
+
+#define PVS_RAYS 512     // fan cast from each cell centre
+#define PVS_MAX_STEPS 64
+#define PVS_MAX_DIRS (MAP_WIDTH * MAP_HEIGHT * 2)
+#define PVS_MAX_ITEMS (4 * (MAP_WIDTH + MAP_HEIGHT))
+
+uint8_t pvsIndex[MAP_HEIGHT][MAP_WIDTH];
+uint32_t pvsSets[PVS_MAX_CELLS][MAP_HEIGHT];
+
+typedef struct {
+    fix_t deltaDistX, deltaDistY;
+    int stepX, stepY;
+} FanRay;
+
+static FanRay fan[PVS_RAYS];
+// line directions through a corner: one of each opposite pair, in lowest
+// terms, and only those short enough to reach a second vertex
+static int8_t dirs[PVS_MAX_DIRS][2];
+static int dirCount;
+static bool tablesReady = false;
+
+static fix_t delta_dist(float rayDir) {
+    float d = fabsf(1.0f / rayDir);
+    return (rayDir == 0.0f || d > 16384.0f) ? (1 << 30) : fix_from_float(d);
+}
+
+static int gcd(int a, int b) {
+    while (b) { int t = a % b; a = b; b = t; }
+    return a;
+}
+
+static void build_tables(void) {
+    for (int i = 0; i < PVS_RAYS; i++) {
+        // half step offset keeps rays off the axes
+        float a = (i + 0.5f) * (2.0f * 3.14159265f / PVS_RAYS);
+        float dx = cosf(a), dy = sinf(a);
+        fan[i].deltaDistX = delta_dist(dx);
+        fan[i].deltaDistY = delta_dist(dy);
+        fan[i].stepX = (dx < 0) ? -1 : 1;
+        fan[i].stepY = (dy < 0) ? -1 : 1;
+    }
+    // axis lines are walked separately
+    dirCount = 0;
+    for (int dx = 1; dx < MAP_WIDTH; dx++) {
+        for (int dy = 1 - MAP_HEIGHT; dy < MAP_HEIGHT; dy++) {
+            if (dy == 0 || gcd(dx, abs(dy)) != 1) continue;
+            dirs[dirCount][0] = dx;
+            dirs[dirCount][1] = dy;
+            dirCount++;
+        }
+    }
+    tablesReady = true;
+}
+
+// marks every cell the ray passes through up to and including the first
+// blocking one. the map border is all walls so it never leaves the grid
+static void cast(fix_t posX, fix_t posY, const FanRay *r, const uint32_t *blocks, uint32_t *seen) {
+    int mapX = fix_to_int(posX), mapY = fix_to_int(posY);
+    fix_t fracX = posX & FIX_FRAC_MASK, fracY = posY & FIX_FRAC_MASK;
+    int64_t sideDistX = fix_mul((r->stepX < 0) ? fracX : FIX_ONE - fracX, r->deltaDistX);
+    int64_t sideDistY = fix_mul((r->stepY < 0) ? fracY : FIX_ONE - fracY, r->deltaDistY);
+    for (int i = 0; i < PVS_MAX_STEPS; i++) {
+        if (sideDistX < sideDistY) { sideDistX += r->deltaDistX; mapX += r->stepX; }
+        else { sideDistY += r->deltaDistY; mapY += r->stepY; }
+        seen[mapY] |= (uint32_t)1 << mapX;
+        if ((blocks[mapY] >> mapX) & 1) return;
+    }
+}
+
+// what a line meets in order: a cell it crosses, or a grid vertex (an edge
+// for axis lines) with the one or two cells it only touches there
+typedef struct {
+    int8_t x[2], y[2];
+    uint8_t n;
+    bool block;  // crosses a wall, or touches walls on both sides at once
+    int8_t side; // touches a wall on its left (1) or right (-1) only, else 0
+} LineItem;
+
+static LineItem items[PVS_MAX_ITEMS];
+static LineItem back[PVS_MAX_ITEMS];
+
+static bool blocked(const uint32_t *blocks, int x, int y) {
+    if (x < 0 || x >= MAP_WIDTH || y < 0 || y >= MAP_HEIGHT) return true;
+    return (blocks[y] >> x) & 1;
+}
+
+static void item_cross(LineItem *it, const uint32_t *blocks, int x, int y) {
+    it->x[0] = x; it->y[0] = y; it->n = 1;
+    it->block = blocked(blocks, x, y);
+    it->side = 0;
+}
+
+static void item_touch(LineItem *it, const uint32_t *blocks, int lx, int ly, int rx, int ry) {
+    bool l = blocked(blocks, lx, ly), r = blocked(blocks, rx, ry);
+    it->x[0] = lx; it->y[0] = ly;
+    it->x[1] = rx; it->y[1] = ry;
+    it->n = 2;
+    it->block = l && r;
+    it->side = l ? 1 : r ? -1 : 0;
+}
+
+// the vertex a line steps through diagonally from cell (x, y). the cells
+// beside the step are touched, the one along x is on the left when the
+// step's signs differ. flip swaps sides for lines walked backwards
+static void item_corner(LineItem *it, const uint32_t *blocks, int x, int y, int sx, int sy, int flip) {
+    if (sx * sy * flip < 0) item_touch(it, blocks, x + sx, y, x, y + sy);
+    else item_touch(it, blocks, x, y + sy, x + sx, y);
+}
+
+// walks from grid vertex (vx, vy) along (dx, dy), up to and including the
+// first item that blocks. the vertex itself is left out
+static int walk(const uint32_t *blocks, int vx, int vy, int dx, int dy, int flip, LineItem *out) {
+    int sx = (dx < 0) ? -1 : 1, sy = (dy < 0) ? -1 : 1;
+    int adx = abs(dx), ady = abs(dy);
+    int x = vx - (sx < 0), y = vy - (sy < 0);
+    // next x and y crossings along the line, in steps of 1 / (adx * ady)
+    int nextX = ady, nextY = adx;
+    int n = 0;
+    for (;;) {
+        item_cross(&out[n], blocks, x, y);
+        if (out[n++].block) return n;
+        if (nextX == nextY) {
+            item_corner(&out[n], blocks, x, y, sx, sy, flip);
+            if (out[n++].block) return n;
+            x += sx; y += sy;
+            nextX += ady; nextY += adx;
+        } else if (nextX < nextY) {
+            x += sx; nextX += ady;
+        } else {
+            y += sy; nextY += adx;
+        }
+    }
+}
+
+static void window_toggle(uint32_t *win, const LineItem *it) {
+    for (int i = 0; i < it->n; i++) win[(int)it->y[i]] ^= (uint32_t)1 << it->x[i];
+}
+
+// a pair of items sees each other when nothing between them blocks and the
+// walls touched in between can all be cleared by nudging the line: they sit
+// on one side, or on one side up to some point and on the other after it.
+// marks what each item sees further along, walking the list in one direction
+static void mark_pairs(int n, int step, int rowLo, int rowHi) {
+    uint32_t win[MAP_HEIGHT] = { 0 };
+    int first = (step > 0) ? 0 : n - 1;
+    #define ITEM(k) (&items[first + (k) * step])
+
+    // the window is items a+1..j, the ones in between are a+1..j-1. touched
+    // walls in between form at most two runs of one side each
+    int j = 0;
+    int runs = 0, firstLen = 0, lastLen = 0, lastSide = 0;
+    for (int a = 0; a < n - 1; a++) {
+        if (a > 0 && a <= j) {
+            window_toggle(win, ITEM(a));
+            if (a < j && ITEM(a)->side && --firstLen == 0) {
+                firstLen = lastLen;
+                lastLen = 0;
+                runs--;
+            }
+        }
+        if (j <= a) {
+            j = a + 1;
+            window_toggle(win, ITEM(j));
+            runs = 0;
+        }
+        while (j + 1 < n) {
+            const LineItem *it = ITEM(j);
+            if (it->block) break;
+            if (it->side) {
+                if (runs == 0) { runs = 1; lastSide = it->side; firstLen = 1; }
+                else if (it->side == lastSide) { if (runs == 1) firstLen++; else lastLen++; }
+                else if (runs == 1) { runs = 2; lastSide = it->side; lastLen = 1; }
+                else break;
+            }
+            j++;
+            window_toggle(win, ITEM(j));
+        }
+
+        const LineItem *it = ITEM(a);
+        for (int i = 0; i < it->n; i++) {
+            int idx = pvsIndex[(int)it->y[i]][(int)it->x[i]];
+            if (idx == PVS_NONE) continue;
+            for (int row = rowLo; row <= rowHi; row++) pvsSets[idx][row] |= win[row];
+        }
+    }
+    #undef ITEM
+}
+
+static void mark_line(int n) {
+    int rowLo = MAP_HEIGHT, rowHi = -1;
+    for (int k = 0; k < n; k++) {
+        for (int i = 0; i < items[k].n; i++) {
+            if (items[k].y[i] < rowLo) rowLo = items[k].y[i];
+            if (items[k].y[i] > rowHi) rowHi = items[k].y[i];
+        }
+    }
+    mark_pairs(n, 1, rowLo, rowHi);
+    mark_pairs(n, -1, rowLo, rowHi);
+}
+
+static void corner_lines(const uint32_t *blocks) {
+    for (int vy = 1; vy < MAP_HEIGHT; vy++) {
+        for (int vx = 1; vx < MAP_WIDTH; vx++) {
+            // a line can only graze a wall at a corner with one wall cell
+            int walls = blocked(blocks, vx - 1, vy - 1) + blocked(blocks, vx, vy - 1)
+                      + blocked(blocks, vx - 1, vy) + blocked(blocks, vx, vy);
+            if (walls != 1) continue;
+
+            for (int d = 0; d < dirCount; d++) {
+                int dx = dirs[d][0], dy = dirs[d][1];
+                bool ahead = vx + dx <= MAP_WIDTH && vy + dy >= 0 && vy + dy <= MAP_HEIGHT;
+                bool behind = vx - dx >= 0 && vy - dy >= 0 && vy - dy <= MAP_HEIGHT;
+                if (!ahead && !behind) continue;
+                // lines into the wall cell block right at the corner
+                int sy = (dy < 0) ? -1 : 1;
+                int x = vx, y = vy - (sy < 0);
+                if (blocked(blocks, x, y) || blocked(blocks, x - 1, y - sy)) continue;
+
+                int nb = walk(blocks, vx, vy, -dx, -dy, -1, back);
+                int n = 0;
+                while (nb > 0) items[n++] = back[--nb];
+                item_corner(&items[n++], blocks, x - 1, y - sy, 1, sy, 1);
+                n += walk(blocks, vx, vy, dx, dy, 1, &items[n]);
+                mark_line(n);
+            }
+        }
+    }
+}
+
+// lines along grid rows and columns graze walls along whole edges
+static void axis_lines(const uint32_t *blocks) {
+    for (int y = 1; y < MAP_HEIGHT; y++) {
+        for (int x = 0; x < MAP_WIDTH; x++) item_touch(&items[x], blocks, x, y, x, y - 1);
+        mark_line(MAP_WIDTH);
+    }
+    for (int x = 1; x < MAP_WIDTH; x++) {
+        for (int y = 0; y < MAP_HEIGHT; y++) item_touch(&items[y], blocks, x - 1, y, x, y);
+        mark_line(MAP_HEIGHT);
+    }
+}
+
+void pvs_build(void) {
+    if (!tablesReady) build_tables();
+
+    // doors can open, so only walls block the view
+    uint32_t blocks[MAP_HEIGHT];
+    for (int y = 0; y < MAP_HEIGHT; y++) blocks[y] = mapOpaque[y];
+    for (int i = 0; i < doorCount; i++) blocks[doors[i].y] &= ~((uint32_t)1 << doors[i].x);
+
+    memset(pvsIndex, PVS_NONE, sizeof(pvsIndex));
+    int count = 0;
+    for (int y = 1; y < MAP_HEIGHT - 1; y++) {
+        for (int x = 1; x < MAP_WIDTH - 1; x++) {
+            if (map_get(x, y) == TILE_WALL || count == PVS_MAX_CELLS) continue;
+            uint32_t *set = pvsSets[count];
+            memset(set, 0, sizeof(pvsSets[0]));
+            set[y] = (uint32_t)1 << x;
+            fix_t px = fix_from_int(x) + FIX_ONE / 2, py = fix_from_int(y) + FIX_ONE / 2;
+            for (int r = 0; r < PVS_RAYS; r++) cast(px, py, &fan[r], blocks, set);
+            pvsIndex[y][x] = count++;
+        }
+    }
+
+    corner_lines(blocks);
+    axis_lines(blocks);
+
+    // grow by one cell for sprites that stick out of the cell their centre
+    // is in
+    for (int i = 0; i < count; i++) {
+        uint32_t seen[MAP_HEIGHT];
+        memcpy(seen, pvsSets[i], sizeof(seen));
+        for (int row = 0; row < MAP_HEIGHT; row++) {
+            uint32_t m = seen[row];
+            if (row > 0) m |= seen[row - 1];
+            if (row < MAP_HEIGHT - 1) m |= seen[row + 1];
+            pvsSets[i][row] = m | (m << 1) | (m >> 1);
+        }
+    }
+}
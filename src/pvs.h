@@ -0,0 +1,27 @@
+#ifndef PVS_H
+#define PVS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "map.h"
+
+// at most this many non-wall cells get their own set, 80 bytes each. the
+// generator makes about 80 (145 seen over 20000 seeds)
+#define PVS_MAX_CELLS 192
+#define PVS_NONE 0xFF // no set for this cell, treat everything as visible
+
+// index into pvsSets for every non-wall cell
+extern uint8_t pvsIndex[MAP_HEIGHT][MAP_WIDTH];
+// bit x of pvsSets[i][y] is set when cell (x, y) may be visible from some
+// point of cell i. includes the walls that bound the view
+extern uint32_t pvsSets[PVS_MAX_CELLS][MAP_HEIGHT];
+
+// rebuilds the sets for the current map, generateMap() calls this
+void pvs_build(void);
+
+static inline bool pvs_visible(int fromX, int fromY, int toX, int toY) {
+    int i = pvsIndex[fromY][fromX];
+    return i == PVS_NONE || ((pvsSets[i][toY] >> toX) & 1);
+}
+
+#endif
@@ -0,0 +1,158 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include "raycast.h"
+#include "map.h"
+#include "screen.h"
+#include "perf.h"
+
+#define DELTA_DIST_MAX (1 << 28) // stands in for 1e30f on axis-parallel rays
+#define MIN_WALL_DIST (FIX_ONE / 10)
+#define MAX_DDA_STEPS 64
+
+// per screen column ray, only depends on the view direction so it survives
+// pure translation. entries are rebuilt lazily when their gen is stale
+typedef struct {
+    fix_t rayDirX, rayDirY;
+    fix_t deltaDistX, deltaDistY;
+    int stepX, stepY;
+    uint32_t gen;
+} RayColumn;
+
+static RayColumn ray_table[SCREEN_WIDTH];
+static uint32_t ray_table_gen = 1;
+
+RayView ray_view;
+
+// |1 / rayDir|, clamped so sideDist sums can't overflow
+static fix_t delta_dist(fix_t rayDir) {
+    if (rayDir == 0) return DELTA_DIST_MAX;
+    int64_t d = ((int64_t)1 << (2 * FIX_SHIFT)) / abs(rayDir);
+    return d > DELTA_DIST_MAX ? DELTA_DIST_MAX : (fix_t)d;
+}
+
+void raycast_set_view(float dirX, float dirY, float planeX, float planeY) {
+    ray_view.dirX = fix_from_float(dirX);
+    ray_view.dirY = fix_from_float(dirY);
+    ray_view.planeX = fix_from_float(planeX);
+    ray_view.planeY = fix_from_float(planeY);
+    ray_table_gen++;
+}
+
+static const RayColumn *ray_column(int x) {
+    RayColumn *col = &ray_table[x];
+    if (col->gen == ray_table_gen) return col;
+
+    fix_t cameraX = (fix_t)(((int64_t)(2 * x) << FIX_SHIFT) / SCREEN_WIDTH) - FIX_ONE;
+    col->rayDirX = ray_view.dirX + fix_mul(ray_view.planeX, cameraX);
+    col->rayDirY = ray_view.dirY + fix_mul(ray_view.planeY, cameraX);
+    col->deltaDistX = delta_dist(col->rayDirX);
+    col->deltaDistY = delta_dist(col->rayDirY);
+    col->stepX = (col->rayDirX < 0) ? -1 : 1;
+    col->stepY = (col->rayDirY < 0) ? -1 : 1;
+    col->gen = ray_table_gen;
+    return col;
+}
+
+// the ray is in a door cell with sideDist* pointing at the cell's far edges.
+// hits the panel halfway through the cell unless the ray leaves the cell
+// first or passes through the part that slid open
+static bool door_hit(const Door *door, fix_t posX, fix_t posY, fix_t rayDirX, fix_t rayDirY,
+                     fix_t sideDistX, fix_t sideDistY, fix_t deltaDistX, fix_t deltaDistY, int side, RayHit *hit) {
+    fix_t entry = (side == 0) ? sideDistX - deltaDistX : sideDistY - deltaDistY;
+    fix_t dist, exit, u;
+    if (door->axis == 0) {
+        dist = sideDistX - deltaDistX / 2;
+        exit = sideDistY;
+        u = posY + fix_mul(dist, rayDirY) - fix_from_int(door->y);
+    } else {
+        dist = sideDistY - deltaDistY / 2;
+        exit = sideDistX;
+        u = posX + fix_mul(dist, rayDirX) - fix_from_int(door->x);
+    }
+    if (dist < entry || dist >= exit) return false;
+    if (u > FIX_FRAC_MASK) u = FIX_FRAC_MASK;
+    if (u < door->open) return false;
+
+    hit->perpDist = (dist < MIN_WALL_DIST) ? MIN_WALL_DIST : dist;
+    hit->texU = u - door->open;
+    hit->side = door->axis;
+    hit->tile = TILE_DOOR;
+    return true;
+}
+
+void raycast_column(fix_t posX, fix_t posY, int x, RayHit *hit) {
+    const RayColumn *col = ray_column(x);
+    fix_t rayDirX = col->rayDirX, rayDirY = col->rayDirY;
+    fix_t deltaDistX = col->deltaDistX, deltaDistY = col->deltaDistY;
+    int stepX = col->stepX, stepY = col->stepY;
+
+    int mapX = fix_to_int(posX);
+    int mapY = fix_to_int(posY);
+    fix_t fracX = posX & FIX_FRAC_MASK;
+    fix_t fracY = posY & FIX_FRAC_MASK;
+
+    fix_t sideDistX = fix_mul((stepX < 0) ? fracX : FIX_ONE - fracX, deltaDistX);
+    fix_t sideDistY = fix_mul((stepY < 0) ? fracY : FIX_ONE - fracY, deltaDistY);
+    int side = 0;
+
+    int iter = 0;
+    while (iter < MAX_DDA_STEPS) {
+        int d = wallDistance[mapY][mapX];
+        if (d >= 2) {
+            // every cell within d - 1 is open: take all crossings before the ray
+            // leaves that square at once. the axis that leaves first makes d - 1
+            // crossings, the other one catches up to that point, ties in the same order as below
+            int64_t exitX = sideDistX + (int64_t)(d - 1) * deltaDistX;
+            int64_t exitY = sideDistY + (int64_t)(d - 1) * deltaDistY;
+            if (exitX <= exitY) {
+                sideDistX += (d - 2) * deltaDistX;
+                mapX += stepX * (d - 2);
+                while (sideDistY <= sideDistX) { sideDistY += deltaDistY; mapY += stepY; }
+                sideDistX += deltaDistX;
+                mapX += stepX;
+                side = 0;
+            } else {
+                sideDistY += (d - 2) * deltaDistY;
+                mapY += stepY * (d - 2);
+                while (sideDistX < sideDistY) { sideDistX += deltaDistX; mapX += stepX; }
+                sideDistY += deltaDistY;
+                mapY += stepY;
+                side = 1;
+            }
+            iter++;
+            continue;
+        }
+        if (sideDistX < sideDistY) {
+            sideDistX += deltaDistX;
+            mapX += stepX;
+            side = 0;
+        } else {
+            sideDistY += deltaDistY;
+            mapY += stepY;
+            side = 1;
+        }
+        iter++;
+        if (map_opaque(mapX, mapY)) {
+            if (map_get(mapX, mapY) != TILE_DOOR) break;
+            PERF_ADD(PERF_DOOR_TESTS, 1);
+            if (door_hit(map_door(mapX, mapY), posX, posY, rayDirX, rayDirY,
+                         sideDistX, sideDistY, deltaDistX, deltaDistY, side, hit)) {
+                PERF_ADD(PERF_DDA_STEPS, iter);
+                return;
+            }
+        }
+    }
+    PERF_ADD(PERF_DDA_STEPS, iter);
+
+    fix_t perpWallDist = (side == 0) ? (sideDistX - deltaDistX) : (sideDistY - deltaDistY);
+    if (perpWallDist < MIN_WALL_DIST) perpWallDist = MIN_WALL_DIST;
+
+    fix_t wallX = (side == 0) ? (posY + fix_mul(perpWallDist, rayDirY)) : (posX + fix_mul(perpWallDist, rayDirX));
+    fix_t texU = wallX & FIX_FRAC_MASK;
+    if ((side == 0 && rayDirX > 0) || (side == 1 && rayDirY < 0)) texU = FIX_FRAC_MASK - texU;
+
+    hit->perpDist = perpWallDist;
+    hit->texU = texU;
+    hit->side = side;
+    hit->tile = map_get(mapX, mapY);
+}
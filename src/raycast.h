@@ -0,0 +1,23 @@
+#ifndef RAYCAST_H
+#define RAYCAST_H
+
+#include "fixed.h"
+
+typedef struct {
+    fix_t perpDist;  // perpendicular distance to the wall, clamped to 0.1
+    fix_t texU;      // horizontal texture coordinate in [0, 1), already flipped
+    int side;        // 0 = x side, 1 = y side
+    int tile;        // tile type of the cell that was hit
+} RayHit;
+
+typedef struct { fix_t dirX, dirY, planeX, planeY; } RayView;
+
+// current view direction and camera plane, set by raycast_set_view()
+extern RayView ray_view;
+
+// call whenever dir/plane change, invalidates the per-column ray table
+void raycast_set_view(float dirX, float dirY, float planeX, float planeY);
+// x is a screen column (0 to SCREEN_WIDTH - 1)
+void raycast_column(fix_t posX, fix_t posY, int x, RayHit *hit);
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include <stdint.h>
+
+#define SCREEN_WIDTH 396
+#define SCREEN_HEIGHT 224
+#define H_RES 4 // widest wall column, the renderer picks 1, 2 or 4 per frame
+
+
+// the 3d view is drawn into either vram or the half resolution buffer
+typedef struct {
+    uint16_t *pixels;
+    int width, height; // width is also the row stride
+} RenderTarget;
+
+#endif
@@ -0,0 +1,277 @@
+#include <stdbool.h>
+#include "sprite.h"
+
+typedef struct {
+    uint32_t dst;  // first pixel, as an offset into the target
+    uint16_t src;  // first pixel in overlayPixels
+    uint16_t len;
+} OverlaySpan;
+
+// each span starts at the same 4-byte parity as its destination, so all but
+// its ends are copied as 32-bit words
+static uint16_t overlayPixels[OVERLAY_PIXELS] __attribute__((aligned(4)));
+static OverlaySpan overlaySpans[OVERLAY_SPANS];
+static int overlayPixelsUsed, overlaySpansUsed;
+
+// texel column for each clipped screen column and texel row for each clipped
+// screen row of the current sprite
+static uint8_t colTexel[SCREEN_WIDTH];
+static uint8_t rowTexel[SCREEN_HEIGHT];
+// first screen row (from the sprite's top) showing each texel row, and one past the end
+static int16_t rowStart[256 + 1];
+
+// rows already covered by nearer sprites this frame, per target column. a
+// sorted list of disjoint [top, bottom) spans, one spare entry while merging
+typedef struct {
+    uint8_t n;
+    uint8_t top[SPRITE_CLIP_SPANS + 1], bottom[SPRITE_CLIP_SPANS + 1];
+} ClipList;
+
+static ClipList clip[SCREEN_WIDTH];
+
+// appends [top, bottom), which must not start above the last span. a full list
+// closes its smallest gap, later sprites then treat those rows as covered
+static void clip_append(ClipList *l, int top, int bottom) {
+    int n = l->n;
+    if (n && top <= l->bottom[n - 1]) {
+        if (bottom > l->bottom[n - 1]) l->bottom[n - 1] = bottom;
+        return;
+    }
+    l->top[n] = top;
+    l->bottom[n] = bottom;
+    if (n < SPRITE_CLIP_SPANS) { l->n = n + 1; return; }
+
+    int best = 0;
+    for (int i = 1; i < n; i++)
+        if (l->top[i + 1] - l->bottom[i] < l->top[best + 1] - l->bottom[best]) best = i;
+    l->bottom[best] = l->bottom[best + 1];
+    for (int i = best + 1; i < n; i++) {
+        l->top[i] = l->top[i + 1];
+        l->bottom[i] = l->bottom[i + 1];
+    }
+}
+
+// true if rows [top, bottom) are covered entirely
+static bool clip_covers(const ClipList *l, int top, int bottom) {
+    for (int i = 0; i < l->n && l->top[i] <= top; i++)
+        if (l->bottom[i] >= bottom) return true;
+    return false;
+}
+
+void sprite_clip_reset(int width) {
+    for (int x = 0; x < width; x++) clip[x].n = 0;
+}
+
+// out[i] = (first + i) * size / scr, stepped as quotient and remainder so
+// only the first entry needs a divide. exact, not rounded
+static void build_steps(uint8_t *out, int n, int first, int size, int scr) {
+    int tex = first * size / scr, rem = first * size % scr;
+    int stepQ = size / scr, stepR = size % scr;
+    for (int i = 0; i < n; i++) {
+        out[i] = tex;
+        tex += stepQ;
+        rem += stepR;
+        if (rem >= scr) { rem -= scr; tex++; }
+    }
+}
+
+// rowStart[t] = ceil(t * scrH / h), the inverse of the texel row table
+static void build_row_starts(int h, int scrH) {
+    int row = 0, rem = h - 1;
+    int stepQ = scrH / h, stepR = scrH % h;
+    for (int t = 0; t <= h; t++) {
+        rowStart[t] = row;
+        row += stepQ;
+        rem += stepR;
+        if (rem >= h) { rem -= h; row++; }
+    }
+}
+
+void sprite_draw(const RenderTarget *rt, const fix_t *zbuf, fix_t depth, int x, int y, int scrW, int scrH, const SpriteImage *img) {
+    if (scrW <= 0 || scrH <= 0) return;
+    int x0 = (x < 0) ? 0 : x, x1 = (x + scrW > rt->width) ? rt->width : x + scrW;
+    int y0 = (y < 0) ? 0 : y, y1 = (y + scrH > rt->height) ? rt->height : y + scrH;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    build_steps(colTexel, x1 - x0, x0 - x, img->w, scrW);
+    build_steps(rowTexel, y1 - y0, y0 - y, img->h, scrH);
+    build_row_starts(img->h, scrH);
+
+    // columns outer: one depth test per column, hidden ones cost nothing.
+    // each opaque span maps to a run of screen rows, transparent texels are
+    // never read and rows a nearer sprite covered are skipped
+    const uint16_t *palette = img->palette;
+    int stride = rt->width;
+    const uint8_t *rowTex = rowTexel - y0; // indexed by target row
+    for (int px = x0; px < x1; px++) {
+        if (depth >= zbuf[px]) continue;
+        ClipList *cover = &clip[px];
+        const uint8_t *line = img->spans + img->lines[colTexel[px - x0]];
+        int spans = *line++;
+        int t = 0;
+
+        // nothing nearer in this column yet, the common case
+        if (!cover->n) {
+            while (spans--) {
+                t += line[0];
+                int run = line[1];
+                const uint8_t *idx = line + 2;
+                line += 2 + run;
+                int first = t, r0 = y + rowStart[t], r1 = y + rowStart[t + run];
+                t += run;
+                if (r0 >= y1) break;
+                if (r0 < y0) r0 = y0;
+                if (r1 > y1) r1 = y1;
+                if (r0 >= r1) continue;
+
+                uint16_t *dst = rt->pixels + r0 * stride + px;
+                for (int r = r0; r < r1; r++, dst += stride) *dst = palette[idx[rowTex[r] - first]];
+                clip_append(cover, r0, r1);
+            }
+            continue;
+        }
+
+        if (clip_covers(cover, y0, y1)) continue;
+        ClipList next;
+        next.n = 0;
+        int k = 0, j = 0;
+        while (spans--) {
+            t += line[0];
+            int run = line[1];
+            const uint8_t *idx = line + 2;
+            line += 2 + run;
+            int first = t, r0 = y + rowStart[t], r1 = y + rowStart[t + run];
+            t += run;
+            if (r0 >= y1) break;
+            if (r0 < y0) r0 = y0;
+            if (r1 > y1) r1 = y1;
+            if (r0 >= r1) continue;
+
+            for (int r = r0; r < r1;) {
+                while (k < cover->n && cover->bottom[k] <= r) k++;
+                int e = r1;
+                if (k < cover->n && cover->top[k] < e) {
+                    if (cover->top[k] <= r) { r = cover->bottom[k]; continue; }
+                    e = cover->top[k];
+                }
+                uint16_t *dst = rt->pixels + r * stride + px;
+                for (; r < e; r++, dst += stride) *dst = palette[idx[rowTex[r] - first]];
+            }
+            for (; j < cover->n && cover->top[j] <= r0; j++) clip_append(&next, cover->top[j], cover->bottom[j]);
+            clip_append(&next, r0, r1);
+        }
+        if (!next.n) continue;
+        for (; j < cover->n; j++) clip_append(&next, cover->top[j], cover->bottom[j]);
+        clip[px] = next;
+    }
+}
+
+void sprite_fill(const RenderTarget *rt, const fix_t *zbuf, fix_t depth, int x, int y, int w, int h, uint16_t color) {
+    int x0 = (x < 0) ? 0 : x, x1 = (x + w > rt->width) ? rt->width : x + w;
+    int y0 = (y < 0) ? 0 : y, y1 = (y + h > rt->height) ? rt->height : y + h;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    int stride = rt->width;
+    for (int px = x0; px < x1; px++) {
+        if (depth >= zbuf[px]) continue;
+        ClipList *cover = &clip[px];
+        if (clip_covers(cover, y0, y1)) continue;
+        int k = 0;
+        for (int r = y0; r < y1;) {
+            while (k < cover->n && cover->bottom[k] <= r) k++;
+            int e = y1;
+            if (k < cover->n && cover->top[k] < e) {
+                if (cover->top[k] <= r) { r = cover->bottom[k]; continue; }
+                e = cover->top[k];
+            }
+            uint16_t *dst = rt->pixels + r * stride + px;
+            for (; r < e; r++, dst += stride) *dst = color;
+        }
+
+        ClipList next;
+        next.n = 0;
+        int j = 0;
+        for (; j < cover->n && cover->top[j] <= y0; j++) clip_append(&next, cover->top[j], cover->bottom[j]);
+        clip_append(&next, y0, y1);
+        for (; j < cover->n; j++) clip_append(&next, cover->top[j], cover->bottom[j]);
+        *cover = next;
+    }
+}
+
+void sprite_blit(const RenderTarget *rt, int x, int y, const SpriteImage *img) {
+    for (int row = 0; row < img->h; row++) {
+        int py = y + row;
+        if (py < 0) continue;
+        if (py >= rt->height) break;
+        const uint8_t *line = img->spans + img->lines[row];
+        uint16_t *dst = rt->pixels + py * rt->width;
+        int spans = *line++;
+        int px = x;
+        while (spans--) {
+            px += line[0];
+            int run = line[1];
+            const uint8_t *idx = line + 2;
+            line += 2 + run;
+
+            int s = 0, e = run;
+            if (px < 0) s = -px;
+            if (px + e > rt->width) e = rt->width - px;
+            for (int i = s; i < e; i++) dst[px + i] = img->palette[idx[i]];
+            px += run;
+        }
+    }
+}
+
+void sprite_prepare_overlay(SpriteOverlay *ov, int width, int height, int x, int y, const SpriteImage *img) {
+    ov->img = *img;
+    ov->x = x;
+    ov->y = y;
+    ov->firstSpan = overlaySpansUsed;
+    ov->spanCount = -1;
+
+    int pixels = overlayPixelsUsed, spans = overlaySpansUsed;
+    for (int row = 0; row < img->h; row++) {
+        int py = y + row;
+        const uint8_t *line = img->spans + img->lines[row];
+        int count = *line++;
+        int px = x;
+        while (count--) {
+            px += line[0];
+            int run = line[1];
+            const uint8_t *idx = line + 2;
+            line += 2 + run;
+
+            int s = (px < 0) ? -px : 0, e = (px + run > width) ? width - px : run;
+            px += run;
+            if (py < 0 || py >= height || s >= e) continue;
+
+            uint32_t dst = py * width + px - run + s;
+            if ((pixels ^ dst) & 1) pixels++;
+            if (pixels + (e - s) > OVERLAY_PIXELS || spans == OVERLAY_SPANS) return;
+            overlaySpans[spans++] = (OverlaySpan){ dst, pixels, e - s };
+            for (int i = s; i < e; i++) overlayPixels[pixels++] = img->palette[idx[i]];
+        }
+    }
+
+    overlayPixelsUsed = pixels;
+    overlaySpansUsed = spans;
+    ov->spanCount = spans - ov->firstSpan;
+}
+
+void sprite_blit_overlay(const RenderTarget *rt, const SpriteOverlay *ov) {
+    if (ov->spanCount < 0) {
+        sprite_blit(rt, ov->x, ov->y, &ov->img);
+        return;
+    }
+    const OverlaySpan *sp = &overlaySpans[ov->firstSpan];
+    for (int i = 0; i < ov->spanCount; i++, sp++) {
+        uint16_t *dst = rt->pixels + sp->dst;
+        const uint16_t *src = overlayPixels + sp->src;
+        int n = sp->len;
+        if (sp->dst & 1) { *dst++ = *src++; n--; }
+        uint32_t *d = (uint32_t *)dst;
+        const uint32_t *s = (const uint32_t *)src;
+        for (; n >= 2; n -= 2) *d++ = *s++;
+        if (n) *(uint16_t *)d = *(const uint16_t *)s;
+    }
+}
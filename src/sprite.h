@@ -0,0 +1,55 @@
+#ifndef SPRITE_H
+#define SPRITE_H
+
+#include <stdint.h>
+#include "fixed.h"
+#include "screen.h"
+
+// one cropped frame of a paletted sprite strip, stored as opaque spans. each
+// line (a row or a column, fixed per strip) is a span count followed by
+// { skip, run, run palette indices } for every span
+typedef struct {
+    const uint8_t *spans;   // span data of this frame
+    const uint16_t *lines;  // start of each line, relative to spans
+    int w, h;
+    const uint16_t *palette;
+} SpriteImage;
+
+// an unscaled frame decoded once to RGB565 spans at a fixed, clipped position
+typedef struct {
+    SpriteImage img;  // drawn with sprite_blit() if it didn't fit the pool
+    int x, y;
+    int firstSpan, spanCount; // spanCount < 0: not decoded
+} SpriteOverlay;
+
+// overlay pool sizes, enough for the gun and shoot effect strips (14012
+// opaque pixels in 748 spans)
+#ifndef OVERLAY_PIXELS
+#define OVERLAY_PIXELS 15360
+#endif
+#ifndef OVERLAY_SPANS
+#define OVERLAY_SPANS 1024
+#endif
+
+// covered row spans remembered per column for front to back drawing, more
+// overlapping spans than this merge and may hide a sliver of a farther sprite
+#ifndef SPRITE_CLIP_SPANS
+#define SPRITE_CLIP_SPANS 6
+#endif
+
+// sprite_draw() and sprite_fill() must be called nearest first: rows a sprite
+// covered are never touched by later ones. forgets them for a new frame
+void sprite_clip_reset(int width);
+// scales img (column spans) to scrW x scrH pixels with its top left at (x, y).
+// columns where zbuf (one entry per target column) is nearer than depth are skipped
+void sprite_draw(const RenderTarget *rt, const fix_t *zbuf, fix_t depth, int x, int y, int scrW, int scrH, const SpriteImage *img);
+// solid w x h rectangle, with the same depth test and coverage as sprite_draw()
+void sprite_fill(const RenderTarget *rt, const fix_t *zbuf, fix_t depth, int x, int y, int w, int h, uint16_t color);
+// unscaled img (row spans) with its top left at (x, y), for the hud overlays
+void sprite_blit(const RenderTarget *rt, int x, int y, const SpriteImage *img);
+// decodes img (row spans) at (x, y) for a width x height target, once at startup
+void sprite_prepare_overlay(SpriteOverlay *ov, int width, int height, int x, int y, const SpriteImage *img);
+// rt must have the size the overlay was prepared for and 4-byte aligned pixels
+void sprite_blit_overlay(const RenderTarget *rt, const SpriteOverlay *ov);
+
+#endif
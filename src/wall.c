@@ -0,0 +1,269 @@
+#include <gint/display.h>
+#include "wall.h"
+#include "screen.h"
+#include "perf.h"
+#include "assets/wall_texture.h"
+
+#define CEILING_COLOR C_RGB(2, 2, 2)
+#define FLOOR_COLOR C_RGB(4, 4, 4)
+
+#define WALL_PALETTE_SIZE (sizeof(wall_palette) / sizeof(wall_palette[0]))
+
+// floor and ceiling read the 64x64 mip, small enough to stay in cache
+#define FLOOR_MIP 1
+#define FLOOR_SIZE (TEX_WIDTH >> FLOOR_MIP)
+#define FLOOR_SHIFT 6
+
+// wall_palette pre-multiplied by each shade level, bank b is shade (b + 0.5) * 256 / SHADE_BANKS
+static uint16_t shade_banks[SHADE_BANKS][WALL_PALETTE_SIZE];
+
+// rows [0, ceilEnd) and [floorStart, height) of each column are not wall
+static int16_t ceilEnd[SCREEN_WIDTH], floorStart[SCREEN_WIDTH];
+
+bool texturedFloor = true;
+
+void wall_init(void) {
+    for (int b = 0; b < SHADE_BANKS; b++) {
+        int shade = (b * 256 + 128) / SHADE_BANKS;
+        for (unsigned i = 0; i < WALL_PALETTE_SIZE; i++) {
+            uint16_t color = wall_palette[i];
+            int r = ((color >> 11) * shade) >> 8;
+            int g = (((color >> 6) & 0x1F) * shade) >> 8;
+            int b5 = ((color & 0x1F) * shade) >> 8;
+            shade_banks[b][i] = (r << 11) | (g << 6) | b5;
+        }
+    }
+}
+
+// shade * 1 / (1 + dist * 0.2)
+static const uint16_t *shade_palette(int shade, fix_t dist) {
+    int final_shade = (shade << FIX_SHIFT) / (FIX_ONE + dist / 5);
+    return (final_shade < SHADE_FULL) ? shade_banks[final_shade * SHADE_BANKS >> 8] : wall_palette;
+}
+
+// one row of a column, width 2 and 4 columns start on an even x so the
+// pixel pairs are 32-bit aligned (row strides are 792 and 396 bytes)
+static inline void store_px(uint16_t *dest, int width, uint16_t color) {
+    uint32_t pair = ((uint32_t)color << 16) | color;
+    switch (width) {
+        case 4: ((uint32_t *)dest)[1] = pair; /* fallthrough */
+        case 2: ((uint32_t *)dest)[0] = pair; break;
+        default: dest[0] = color;
+    }
+}
+
+// solid vertical span, width as in wall_draw_column()
+static void fill_span(uint16_t *dest, int stride, int rows, int width, uint16_t color) {
+    uint32_t pair = ((uint32_t)color << 16) | color;
+    uint32_t *d = (uint32_t *)dest;
+    int s = stride / 2;
+    switch (width) {
+        case 4: for (; rows > 0; rows--, d += s) { d[0] = pair; d[1] = pair; } break;
+        case 2: for (; rows > 0; rows--, d += s) d[0] = pair; break;
+        default: for (; rows > 0; rows--, dest += stride) dest[0] = color;
+    }
+}
+
+// textured column blitters, one per width. texPos must stay below the texture
+// size for all rows, wall_draw_column() splits the column where it wraps
+typedef void (*column_blit_t)(uint16_t *dest, int stride, int rows, const uint8_t *column, fix_t texPos, fix_t step, const uint16_t *palette);
+
+static void blit_column_1(uint16_t *dest, int stride, int rows, const uint8_t *column, fix_t texPos, fix_t step, const uint16_t *palette) {
+    for (; rows >= 2; rows -= 2) {
+        dest[0] = palette[column[texPos >> FIX_SHIFT]];
+        dest[stride] = palette[column[(texPos + step) >> FIX_SHIFT]];
+        texPos += 2 * step;
+        dest += 2 * stride;
+    }
+    if (rows) dest[0] = palette[column[texPos >> FIX_SHIFT]];
+}
+
+static void blit_column_2(uint16_t *dest, int stride, int rows, const uint8_t *column, fix_t texPos, fix_t step, const uint16_t *palette) {
+    uint32_t *d = (uint32_t *)dest;
+    int s = stride / 2;
+    for (; rows >= 2; rows -= 2) {
+        uint32_t c0 = palette[column[texPos >> FIX_SHIFT]];
+        uint32_t c1 = palette[column[(texPos + step) >> FIX_SHIFT]];
+        d[0] = (c0 << 16) | c0;
+        d[s] = (c1 << 16) | c1;
+        texPos += 2 * step;
+        d += 2 * s;
+    }
+    if (rows) {
+        uint32_t c = palette[column[texPos >> FIX_SHIFT]];
+        d[0] = (c << 16) | c;
+    }
+}
+
+static void blit_column_4(uint16_t *dest, int stride, int rows, const uint8_t *column, fix_t texPos, fix_t step, const uint16_t *palette) {
+    uint32_t *d = (uint32_t *)dest;
+    int s = stride / 2;
+    for (; rows >= 2; rows -= 2) {
+        uint32_t c0 = palette[column[texPos >> FIX_SHIFT]];
+        uint32_t c1 = palette[column[(texPos + step) >> FIX_SHIFT]];
+        c0 |= c0 << 16;
+        c1 |= c1 << 16;
+        d[0] = c0; d[1] = c0;
+        d[s] = c1; d[s + 1] = c1;
+        texPos += 2 * step;
+        d += 2 * s;
+    }
+    if (rows) {
+        uint32_t c = palette[column[texPos >> FIX_SHIFT]];
+        c |= c << 16;
+        d[0] = c; d[1] = c;
+    }
+}
+
+// runs of up to four rows cost more to measure than the texel fetches they
+// save (bench/wall_bench.c), so only walls over 512 px tall use magnify_column()
+#define MAGNIFY_STEP (FIX_ONE / 4)
+
+// close walls (step < 1): every texel covers a run of identical rows, so fetch
+// it once and fill the run. runs are floor or ceil of 1 / step, which minRun
+// gives up to the exact value without a division per texel
+static void magnify_column(uint16_t *dest, int stride, int rows, int width, const uint8_t *column, fix_t texPos, fix_t step, const uint16_t *palette) {
+    int minRun = (FIX_ONE - step) / step;
+    while (rows > 0) {
+        int t = texPos >> FIX_SHIFT;
+        fix_t toNext = ((t + 1) << FIX_SHIFT) - texPos;
+        int run = minRun;
+        while (run * step < toNext) run++;
+        if (run > rows) run = rows;
+        fill_span(dest, stride, run, width, palette[column[t]]);
+        dest += run * stride;
+        rows -= run;
+        texPos += run * step;
+    }
+}
+
+void wall_draw_column(const RenderTarget *rt, int x, int width, const RayHit *hit, int horiz, int texture) {
+    int height = rt->height;
+    int lineHeight = (height << FIX_SHIFT) / hit->perpDist;
+    if (lineHeight < 1) lineHeight = 1;
+    int drawStart = -lineHeight / 2 + height / 2 + horiz;
+    int drawEnd = lineHeight / 2 + height / 2 + horiz;
+
+    // mip whose texel step is closest to one pixel without going under it
+    int mip = 0;
+    while (mip < TEX_MIP_LEVELS - 1 && (lineHeight << (mip + 1)) <= TEX_HEIGHT) mip++;
+    int size = TEX_HEIGHT >> mip;
+
+    int texX = (hit->texU * size) >> FIX_SHIFT;
+
+    fix_t step_tex = (size << FIX_SHIFT) / lineHeight;
+    fix_t texPos = (drawStart - horiz - height / 2 + lineHeight / 2) * step_tex;
+
+    int y_start = (drawStart < 0) ? 0 : drawStart;
+    int y_end = (drawEnd >= height) ? height - 1 : drawEnd;
+
+    // ceiling above and floor below the wall, so each pixel is written once
+    int ceil_end = (y_start > height) ? height : y_start;
+    int floor_start = (y_end < -1) ? 0 : y_end + 1;
+    ceilEnd[x] = ceil_end;
+    floorStart[x] = floor_start;
+    if (!texturedFloor) {
+        fill_span(&rt->pixels[x], rt->width, ceil_end, width, CEILING_COLOR);
+        fill_span(&rt->pixels[floor_start * rt->width + x], rt->width, height - floor_start, width, FLOOR_COLOR);
+        PERF_ADD(PERF_FILL_PIXELS, (ceil_end + height - floor_start) * width);
+    }
+    if (y_start > y_end) return;
+
+    const uint16_t *palette = shade_palette((hit->side == 1) ? 180 : 255, hit->perpDist);
+
+    const uint8_t *column = &wall_texture_mips[mip][(texture * size + texX) * size];
+    uint16_t *dest = &rt->pixels[y_start * rt->width + x];
+    int rows = y_end - y_start + 1;
+    PERF_ADD(PERF_WALL_PIXELS, rows * width);
+
+    // the shade is already baked into the palette bank, so only the width varies
+    column_blit_t blit = (width == 4) ? blit_column_4 : (width == 2) ? blit_column_2 : blit_column_1;
+
+    // split where texPos wraps around the texture instead of masking every texel
+    fix_t texEnd = size << FIX_SHIFT;
+    texPos &= texEnd - 1;
+    while (rows > 0) {
+        // most columns don't wrap at all and skip the division
+        int run = rows;
+        if (texPos + (rows - 1) * step_tex >= texEnd) run = (texEnd - texPos + step_tex - 1) / step_tex;
+        if (step_tex < MAGNIFY_STEP) magnify_column(dest, rt->width, run, width, column, texPos, step_tex, palette);
+        else blit(dest, rt->width, run, column, texPos, step_tex, palette);
+        dest += run * rt->width;
+        rows -= run;
+        texPos += run * step_tex - texEnd;
+    }
+}
+
+// one floor or ceiling row, only where the column's wall doesn't reach row y
+static void floor_row(const RenderTarget *rt, int y, bool ceiling, int colWidth, fix_t u, fix_t v, fix_t stepU, fix_t stepV,
+                      const uint8_t *tex, const uint16_t *palette) {
+    uint16_t *row = &rt->pixels[y * rt->width];
+    stepU *= colWidth;
+    stepV *= colWidth;
+    for (int x = 0; x < rt->width; x += colWidth, u += stepU, v += stepV) {
+        if (ceiling ? y >= ceilEnd[x] : y < floorStart[x]) continue;
+        int tu = (u >> (FIX_SHIFT - FLOOR_SHIFT)) & (FLOOR_SIZE - 1);
+        int tv = (v >> (FIX_SHIFT - FLOOR_SHIFT)) & (FLOOR_SIZE - 1);
+        uint16_t color = palette[tex[tu * FLOOR_SIZE + tv]];
+        int width = (x + colWidth > rt->width) ? rt->width - x : colWidth;
+        store_px(&row[x], width, color);
+        PERF_ADD(PERF_FILL_PIXELS, width);
+    }
+}
+
+static void flat_row(const RenderTarget *rt, int y, bool ceiling, int colWidth) {
+    uint16_t *row = &rt->pixels[y * rt->width];
+    uint16_t color = ceiling ? CEILING_COLOR : FLOOR_COLOR;
+    for (int x = 0; x < rt->width; x += colWidth) {
+        if (ceiling ? y >= ceilEnd[x] : y < floorStart[x]) continue;
+        int width = (x + colWidth > rt->width) ? rt->width - x : colWidth;
+        store_px(&row[x], width, color);
+        PERF_ADD(PERF_FILL_PIXELS, width);
+    }
+}
+
+void wall_draw_floor(const RenderTarget *rt, fix_t posX, fix_t posY, int horiz, int colWidth, int texture) {
+    int height = rt->height;
+    int center = height / 2 + horiz;
+
+    // rays through the left and right screen edges
+    fix_t ray0X = ray_view.dirX - ray_view.planeX, ray0Y = ray_view.dirY - ray_view.planeY;
+    fix_t ray1X = ray_view.dirX + ray_view.planeX, ray1Y = ray_view.dirY + ray_view.planeY;
+
+    const uint8_t *floorTex = wall_texture_mips[FLOOR_MIP] + ((texture + 1) % WALL_LEVEL_TEXTURES) * FLOOR_SIZE * FLOOR_SIZE;
+    const uint8_t *ceilTex = wall_texture_mips[FLOOR_MIP] + ((texture + 2) % WALL_LEVEL_TEXTURES) * FLOOR_SIZE * FLOOR_SIZE;
+
+    // p is the row's distance from the horizon, floor row center + p and ceiling
+    // row center - p see the same distance. walk from the nearest rows outwards
+    int maxP = (center > height - center) ? center : height - center;
+    int budget = FLOOR_TEXEL_BUDGET;
+    int samples = (rt->width + colWidth - 1) / colWidth;
+    for (int p = maxP; p >= 1; p--) {
+        int yFloor = center + p, yCeil = center - p;
+        bool hasFloor = yFloor >= 0 && yFloor < height;
+        bool hasCeil = yCeil >= 0 && yCeil < height;
+        if (!hasFloor && !hasCeil) continue;
+
+        if (budget <= 0) {
+            if (hasFloor) flat_row(rt, yFloor, false, colWidth);
+            if (hasCeil) flat_row(rt, yCeil, true, colWidth);
+            continue;
+        }
+
+        // camera at half wall height
+        fix_t rowDist = ((height / 2) << FIX_SHIFT) / p;
+        fix_t stepU = fix_mul(rowDist, ray1X - ray0X) / rt->width;
+        fix_t stepV = fix_mul(rowDist, ray1Y - ray0Y) / rt->width;
+        fix_t u = posX + fix_mul(rowDist, ray0X);
+        fix_t v = posY + fix_mul(rowDist, ray0Y);
+
+        if (hasFloor) {
+            floor_row(rt, yFloor, false, colWidth, u, v, stepU, stepV, floorTex, shade_palette(255, rowDist));
+            budget -= samples;
+        }
+        if (hasCeil) {
+            floor_row(rt, yCeil, true, colWidth, u, v, stepU, stepV, ceilTex, shade_palette(180, rowDist));
+            budget -= samples;
+        }
+    }
+}
@@ -0,0 +1,32 @@
+#ifndef WALL_H
+#define WALL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "raycast.h"
+#include "screen.h"
+
+// number of precomputed distance shade levels, power of two up to 256
+#ifndef SHADE_BANKS
+#define SHADE_BANKS 32
+#endif
+
+// shades at or above this are drawn with the raw palette
+#define SHADE_FULL 240
+
+// texel samples the floor/ceiling caster may spend per frame, rows nearest to
+// the camera go first and the rest near the horizon are filled flat
+#ifndef FLOOR_TEXEL_BUDGET
+#define FLOOR_TEXEL_BUDGET 16384
+#endif
+
+// textured floor and ceiling, otherwise flat spans from the column pass
+extern bool texturedFloor;
+
+void wall_init(void);
+// width is 1, 2 or 4 pixels of the target
+void wall_draw_column(const RenderTarget *rt, int x, int width, const RayHit *hit, int horiz, int texture);
+// after all columns, only draws the pixels the walls left uncovered
+void wall_draw_floor(const RenderTarget *rt, fix_t posX, fix_t posY, int horiz, int colWidth, int texture);
+
+#endif